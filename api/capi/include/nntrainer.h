@@ -474,6 +474,64 @@ int ml_train_dataset_add_generator(ml_train_dataset_h dataset,
 int ml_train_dataset_add_file(ml_train_dataset_h dataset,
                               ml_train_dataset_mode_e mode, const char *file);
 
+/**
+ * @brief Adds a push source to @a dataset.
+ * @details Use this function to feed the dataset from any thread by calling
+ * ml_train_dataset_push(). The pushed samples are written to the buffer of
+ * the running epoch without an intermediate copy. The epoch ends when
+ * "epoch_samples" samples are pushed or "epoch_duration" milliseconds have
+ * passed, which can be set by ml_train_dataset_set_property_for_mode().
+ * "backpressure" decides if a sample is waited for room ("block", default) or
+ * dropped ("drop") when the buffer is full or no epoch is running.
+ * @since_tizen 8.0
+ * @param[in] dataset The NNTrainer dataset handle.
+ * @param[in] mode The phase where the pushed samples should be used.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Invalid parameter.
+ */
+int ml_train_dataset_add_push(ml_train_dataset_h dataset,
+                              ml_train_dataset_mode_e mode);
+
+/**
+ * @brief Pushes a sample to @a dataset.
+ * @details Use this function to push a sample to the push source added by
+ * ml_train_dataset_add_push(). This function can be called from any thread
+ * and waits for room of the sample unless "backpressure" is "drop".
+ * @since_tizen 8.0
+ * @param[in] dataset The NNTrainer dataset handle.
+ * @param[in] mode The phase where the sample should be used.
+ * @param[in] input Data of each input of the sample.
+ * @param[in] num_inputs Number of inputs of the sample.
+ * @param[in] label Data of each label of the sample.
+ * @param[in] num_labels Number of labels of the sample.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Invalid parameter.
+ * @retval #ML_ERROR_TRY_AGAIN The sample is dropped, or the push is closed.
+ */
+int ml_train_dataset_push(ml_train_dataset_h dataset,
+                          ml_train_dataset_mode_e mode, const float **input,
+                          unsigned int num_inputs, const float **label,
+                          unsigned int num_labels);
+
+/**
+ * @brief Closes the push source of @a dataset.
+ * @details Use this function when there is no more sample to push. The
+ * running epoch ends, and the waiting ml_train_dataset_push() calls return.
+ * @since_tizen 8.0
+ * @param[in] dataset The NNTrainer dataset handle.
+ * @param[in] mode The phase of the push source.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Invalid parameter.
+ */
+int ml_train_dataset_close_push(ml_train_dataset_h dataset,
+                                ml_train_dataset_mode_e mode);
+
 /**
  * @deprecated Deprecated since 6.5. Use ml_train_dataset_create() instead.
  * @brief Creates a dataset with files to feed to a neural network.
@@ -836,6 +836,97 @@ int ml_train_dataset_add_file(ml_train_dataset_h dataset,
                                file);
 }
 
+int ml_train_dataset_add_push(ml_train_dataset_h dataset,
+                              ml_train_dataset_mode_e mode) {
+  check_feature_state();
+  return ml_train_dataset_add_(dataset, mode, ml::train::DatasetType::PUSH);
+}
+
+/**
+ * @brief get the underlying dataset of the mode, the handle is not kept locked
+ * as pushing may wait for the model using the dataset
+ *
+ * @param[in] dataset dataset handle
+ * @param[in] mode mode
+ * @param[out] db underlying dataset
+ * @retval #ML_ERROR_NONE successful
+ * @retval #ML_ERROR_INVALID_PARAMETER when the dataset does not exist
+ */
+static int ml_train_dataset_get_(ml_train_dataset_h dataset,
+                                 ml_train_dataset_mode_e mode,
+                                 std::shared_ptr<ml::train::Dataset> &db) {
+  ml_train_dataset *nndataset;
+
+  ML_TRAIN_VERIFY_VALID_HANDLE(dataset);
+
+  {
+    ML_TRAIN_GET_VALID_DATASET_LOCKED(nndataset, dataset);
+    ML_TRAIN_ADOPT_LOCK(nndataset, dataset_lock);
+
+    db = nndataset->dataset[mode];
+  }
+
+  if (db == nullptr) {
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+int ml_train_dataset_push(ml_train_dataset_h dataset,
+                          ml_train_dataset_mode_e mode, const float **input,
+                          unsigned int num_inputs, const float **label,
+                          unsigned int num_labels) {
+  int status = ML_ERROR_NONE;
+  std::shared_ptr<ml::train::Dataset> db;
+
+  check_feature_state();
+  if (input == nullptr || num_inputs == 0 ||
+      (label == nullptr && num_labels != 0)) {
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  status = ml_train_dataset_get_(dataset, mode, db);
+  if (status != ML_ERROR_NONE) {
+    return status;
+  }
+
+  bool accepted = false;
+  returnable f = [&]() {
+    std::vector<const float *> inputs(input, input + num_inputs);
+    std::vector<const float *> labels(label, label + num_labels);
+    accepted = db->push(inputs, labels);
+    return ML_ERROR_NONE;
+  };
+
+  status = nntrainer_exception_boundary(f);
+  if (status == ML_ERROR_NONE && !accepted) {
+    status = ML_ERROR_TRY_AGAIN;
+  }
+
+  return status;
+}
+
+int ml_train_dataset_close_push(ml_train_dataset_h dataset,
+                                ml_train_dataset_mode_e mode) {
+  int status = ML_ERROR_NONE;
+  std::shared_ptr<ml::train::Dataset> db;
+
+  check_feature_state();
+
+  status = ml_train_dataset_get_(dataset, mode, db);
+  if (status != ML_ERROR_NONE) {
+    return status;
+  }
+
+  returnable f = [&db]() {
+    db->closePush();
+    return ML_ERROR_NONE;
+  };
+
+  return nntrainer_exception_boundary(f);
+}
+
 int ml_train_dataset_create_with_generator(ml_train_dataset_h *dataset,
                                            ml_train_datagen_cb train_cb,
                                            ml_train_datagen_cb valid_cb,
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include <nntrainer-api-common.h>
+#include <nntrainer_error.h>
 
 namespace ml {
 namespace train {
@@ -40,7 +41,8 @@ typedef std::function<std::remove_pointer<ml_train_datagen_cb>::type>
 enum class DatasetType {
   GENERATOR, /** Dataset with generators */
   FILE,      /** Dataset with files */
-  UNKNOWN    /** Unknown dataset type */
+  UNKNOWN,   /** Unknown dataset type */
+  PUSH       /** Dataset with samples pushed by Dataset::push() */
 };
 
 /**
@@ -71,6 +73,31 @@ public:
    *  { std::string property_name, std::string property_val, ...}
    */
   virtual void setProperty(const std::vector<std::string> &values) = 0;
+
+  /**
+   * @brief     push a sample to the dataset of DatasetType::PUSH, can be called
+   * from any thread
+   * @param[in] inputs data of each input of the sample
+   * @param[in] labels data of each label of the sample
+   * @retval    true if the sample is accepted, false if dropped by
+   * "backpressure=drop" or the push is closed
+   * @throw     std::invalid_argument if the dataset cannot be pushed to
+   */
+  virtual bool push(const std::vector<const float *> &inputs,
+                    const std::vector<const float *> &labels) {
+    throw nntrainer::exception::not_supported(
+      "push is not supported by the dataset");
+  }
+
+  /**
+   * @brief     close the dataset of DatasetType::PUSH, no more sample is
+   * accepted and the running epoch ends
+   * @throw     std::invalid_argument if the dataset cannot be pushed to
+   */
+  virtual void closePush() {
+    throw nntrainer::exception::not_supported(
+      "push is not supported by the dataset");
+  }
 };
 
 /**
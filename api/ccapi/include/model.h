@@ -18,11 +18,13 @@
 
 #if __cplusplus >= MIN_CPP_VERSION
 
+#include <functional>
 #include <string>
 #include <type_traits>
 #include <vector>
 
 #include <nntrainer-api-common.h>
+#include <nntrainer_error.h>
 
 #include <dataset.h>
 #include <layer.h>
@@ -67,6 +69,97 @@ for inference and training without any configurations*/
                                            where the binaray will be saved */
 };
 
+/**
+ * @brief Training metrics reported by the model while training
+ *
+ */
+struct TrainingMetrics {
+  unsigned int epoch;        /**< epoch, starting from 1 */
+  unsigned int iteration;    /**< iterations done in the epoch */
+  unsigned int num_samples;  /**< samples trained in the epoch */
+  float loss;                /**< mean training loss of the epoch so far */
+  float samples_per_second;  /**< training throughput of the epoch so far */
+  bool epoch_end;            /**< true if the epoch is done */
+  bool has_validation;       /**< true if the validation fields are set */
+  float validation_loss;     /**< validation loss at the end of the epoch */
+  float validation_accuracy; /**< validation accuracy in percent */
+};
+
+/**
+ * @brief     Statistics from running or training a model
+ */
+struct RunStats {
+  float accuracy;           /**< accuracy in percent, set when evaluated */
+  float loss;               /**< mean loss of the samples run so far */
+  int num_iterations;       /**< number of iterations done on this stat */
+  unsigned int num_samples; /**< number of samples done on this stat */
+  unsigned int
+    num_correct_predictions; /**< number of right sample on this run */
+
+  /**
+   * @brief Construct a new Run Stats object
+   *
+   */
+  RunStats() :
+    accuracy(0),
+    loss(0),
+    num_iterations(0),
+    num_samples(0),
+    num_correct_predictions(0) {}
+};
+
+class Model;
+
+/**
+ * @class   TrainingCallback Class
+ * @brief   Hooks called from the training thread while a model trains. The
+ * hooks do nothing by default
+ */
+class TrainingCallback {
+public:
+  /**
+   * @brief     Destructor of TrainingCallback Class
+   */
+  virtual ~TrainingCallback() = default;
+
+  /**
+   * @brief     Called when the training starts
+   * @param[in] model model to train
+   */
+  virtual void onTrainBegin(Model &model) {}
+
+  /**
+   * @brief     Called after each training iteration
+   * @param[in] model model being trained
+   * @param[in] epoch epoch running, starting from 1
+   * @param[in] stats running statistics of the training epoch
+   */
+  virtual void onIteration(Model &model, unsigned int epoch,
+                           const RunStats &stats) {}
+
+  /**
+   * @brief     Called after each validation, at the end of an epoch or when
+   * requested by Model::requestValidation()
+   * @param[in] model model being trained
+   * @param[in] epoch epoch running, starting from 1
+   * @param[in] stats statistics of the validation
+   */
+  virtual void onValidation(Model &model, unsigned int epoch,
+                            const RunStats &stats) {}
+
+  /**
+   * @brief     Called at the end of each epoch, after its validation
+   * @param[in] model model being trained
+   * @param[in] epoch epoch ended, starting from 1
+   * @param[in] training statistics of the training epoch
+   * @param[in] validation statistics of the validation of the epoch, nullptr
+   * if the epoch is not validated
+   */
+  virtual void onEpochEnd(Model &model, unsigned int epoch,
+                          const RunStats &training,
+                          const RunStats *validation) {}
+};
+
 /**
  * @class   Model Class
  * @brief   Model Class containing configuration, layers, optimizer and dataset
@@ -276,6 +369,112 @@ public:
    * @retval    loss value
    */
   virtual float getValidationLoss() = 0;
+
+  /**
+   * @brief     Set the callback receiving the training metrics. It is called
+   * from the reporting thread every "metrics_interval" milliseconds while an
+   * epoch runs and at the end of each epoch
+   * @param[in] callback callback to set, empty to unset
+   * @throw     nntrainer::exception::not_supported if the model does not
+   * report training metrics
+   */
+  virtual void
+  setMetricsCallback(std::function<void(const TrainingMetrics &)> callback) {
+    throw nntrainer::exception::not_supported(
+      "training metrics are not supported by the model");
+  }
+
+  /**
+   * @brief     Take the training metrics kept with "metrics=ring"
+   * @retval    metrics kept since the last call, oldest first
+   * @throw     nntrainer::exception::not_supported if the model does not
+   * report training metrics
+   */
+  virtual std::vector<TrainingMetrics> takeMetrics() {
+    throw nntrainer::exception::not_supported(
+      "training metrics are not supported by the model");
+  }
+
+  /**
+   * @brief     Add a callback to be called while the model trains. Training
+   * without a callback runs no hook
+   * @param[in] callback callback to add
+   * @throw     nntrainer::exception::not_supported if the model does not
+   * support training callbacks
+   */
+  virtual void
+  addTrainingCallback(std::shared_ptr<TrainingCallback> callback) {
+    throw nntrainer::exception::not_supported(
+      "training callbacks are not supported by the model");
+  }
+
+  /**
+   * @brief     Stop the running training after the current iteration. The
+   * rest of the running epoch is fetched but not trained on
+   * @note      This can be called from any thread
+   * @throw     nntrainer::exception::not_supported if the model does not
+   * support training callbacks
+   */
+  virtual void stopTraining() {
+    throw nntrainer::exception::not_supported(
+      "training callbacks are not supported by the model");
+  }
+
+  /**
+   * @brief     Validate the model after the current training iteration. It
+   * is ignored if there is no validation dataset
+   * @note      This can be called from any thread
+   * @throw     nntrainer::exception::not_supported if the model does not
+   * support training callbacks
+   */
+  virtual void requestValidation() {
+    throw nntrainer::exception::not_supported(
+      "training callbacks are not supported by the model");
+  }
+
+  /**
+   * @brief     Get the scale applied to the learning rate of the optimizer
+   * @retval    scale of the learning rate
+   * @throw     nntrainer::exception::not_supported if the model does not
+   * scale the learning rate
+   */
+  virtual float getLearningRateScale() {
+    throw nntrainer::exception::not_supported(
+      "learning rate scale is not supported by the model");
+  }
+
+  /**
+   * @brief     Set the scale applied to the learning rate of the optimizer,
+   * 1 by default. It is kept over the following trainings
+   * @param[in] scale scale of the learning rate, must be positive
+   * @throw     nntrainer::exception::not_supported if the model does not
+   * scale the learning rate
+   */
+  virtual void setLearningRateScale(float scale) {
+    throw nntrainer::exception::not_supported(
+      "learning rate scale is not supported by the model");
+  }
+
+  /**
+   * @brief     Run the inference of the model on a stream of inputs, copying
+   * the outputs into the memory of the caller
+   * @param[in] batch batch size of current input
+   * @param[in] input inputs as a list of each input data
+   * @param[in] output list of memory to copy each output data to
+   * @throw     nntrainer::exception::not_supported if the model cannot run
+   * the inference in place
+   * @note The inputs are not validated, the caller must give inputs of the
+   * input dimensions of the model in @a batch. The inputs are read in place,
+   * while the outputs of the model are copied into @a output on each call. The
+   * memory for the inference is kept allocated for the next call with the same
+   * @a batch.
+   */
+  virtual void streamInference(unsigned int batch,
+                               const std::vector<float *> &input,
+                               const std::vector<float *> &output) {
+    throw nntrainer::exception::not_supported(
+      "streamInference is not supported by the model");
+  }
 };
 
 /**
@@ -284,6 +483,51 @@ public:
 std::unique_ptr<Model>
 createModel(ModelType type, const std::vector<std::string> &properties = {});
 
+/**
+ * @brief Factory creator with constructor for training callback
+ * @details supported types are "early_stopping", "reduce_lr_on_plateau" and
+ * "periodic_validation"
+ */
+std::unique_ptr<TrainingCallback>
+createTrainingCallback(const std::string &type,
+                       const std::vector<std::string> &properties = {});
+
+namespace callback {
+
+/**
+ * @brief Helper function to create early stopping callback, which stops the
+ * training once the monitored statistic stops improving
+ * @details properties: monitor (loss, val_loss, val_accuracy), patience,
+ * min_delta
+ */
+inline std::unique_ptr<TrainingCallback>
+EarlyStopping(const std::vector<std::string> &properties = {}) {
+  return createTrainingCallback("early_stopping", properties);
+}
+
+/**
+ * @brief Helper function to create reduce lr on plateau callback, which scales
+ * the learning rate down once the monitored statistic stops improving
+ * @details properties: monitor (loss, val_loss, val_accuracy), patience,
+ * min_delta, factor, min_scale
+ */
+inline std::unique_ptr<TrainingCallback>
+ReduceLROnPlateau(const std::vector<std::string> &properties = {}) {
+  return createTrainingCallback("reduce_lr_on_plateau", properties);
+}
+
+/**
+ * @brief Helper function to create periodic validation callback, which
+ * validates the model every interval iterations of an epoch
+ * @details properties: interval
+ */
+inline std::unique_ptr<TrainingCallback>
+PeriodicValidation(const std::vector<std::string> &properties = {}) {
+  return createTrainingCallback("periodic_validation", properties);
+}
+
+} // namespace callback
+
 } // namespace train
 } // namespace ml
 
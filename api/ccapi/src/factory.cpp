@@ -22,6 +22,7 @@
 #include <neuralnet.h>
 #include <nntrainer_error.h>
 #include <optimizer.h>
+#include <training_callbacks.h>
 
 namespace ml {
 namespace train {
@@ -108,5 +109,11 @@ createDataset(DatasetType type, datagen_cb cb, void *user_data,
   return dataset;
 }
 
+std::unique_ptr<TrainingCallback>
+createTrainingCallback(const std::string &type,
+                       const std::vector<std::string> &properties) {
+  return nntrainer::createTrainingCallback(type, properties);
+}
+
 } // namespace train
 } // namespace ml
@@ -126,6 +126,10 @@ NNTRAINER_SRCS := $(NNTRAINER_ROOT)/nntrainer/models/neuralnet.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/models/model_loader.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/models/model_common_properties.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/models/dynamic_training_optimization.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/models/feature_cache.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/models/training_metrics.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/models/training_callbacks.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/models/weight_registry.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/dataset/iteration_queue.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/dataset/databuffer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/dataset/data_iteration.cpp \
@@ -133,6 +137,7 @@ NNTRAINER_SRCS := $(NNTRAINER_ROOT)/nntrainer/models/neuralnet.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/dataset/func_data_producer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/dataset/random_data_producers.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/dataset/raw_file_data_producer.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/dataset/push_data_producer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/tensor/tensor.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/tensor/lazy_tensor.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/tensor/manager.cpp \
@@ -149,6 +154,7 @@ NNTRAINER_SRCS := $(NNTRAINER_ROOT)/nntrainer/models/neuralnet.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/layers/input_layer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/layers/multiout_layer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/layers/fc_layer.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/layers/fused_epilogue.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/layers/bn_layer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/layers/loss/loss_layer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/layers/loss/mse_loss_layer.cpp \
@@ -198,6 +204,8 @@ NNTRAINER_SRCS := $(NNTRAINER_ROOT)/nntrainer/models/neuralnet.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/optimizers/sgd.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/optimizers/lr_scheduler_constant.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/optimizers/lr_scheduler_exponential.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/optimizers/lr_scheduler_step.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/optimizers/lr_scheduler_cosine.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/utils/util_func.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/utils/ini_wrapper.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/utils/profiler.cpp \
@@ -206,6 +214,7 @@ NNTRAINER_SRCS := $(NNTRAINER_ROOT)/nntrainer/models/neuralnet.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/compiler/ini_interpreter.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/compiler/flatten_realizer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/compiler/activation_realizer.cpp \
+                  $(NNTRAINER_ROOT)/nntrainer/compiler/fusion_realizer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/compiler/recurrent_realizer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/compiler/previous_input_realizer.cpp \
                   $(NNTRAINER_ROOT)/nntrainer/compiler/multiout_realizer.cpp \
@@ -22,6 +22,7 @@
 #include <unistd.h>
 
 #include <nntrainer_error.h>
+#include <weight_registry.h>
 
 #include "ml-api-common.h"
 #include "nnstreamer.h"
@@ -48,6 +49,12 @@
 
 static const gchar *nntrainer_accl_support[] = {NULL};
 
+/**
+ * @brief custom property of the path of the weights to reload from when the
+ * model is reloaded
+ */
+static const gchar *weights_path_key = "WeightsPath";
+
 /**
  * @brief   startup constructor
  *
@@ -88,10 +95,15 @@ static ml::train::TensorDim to_nntr_tensor_dim(const GstTensorInfo *info) {
 
 NNTrainerInference::NNTrainerInference(const std::string &model_config_) :
   batch_size(1),
-  model_config(model_config_) {
+  weights_version(0),
+  model_config(model_config_),
+  weights_key(nntrainer::WeightRegistry::resolveKey(model_config)) {
   loadModel();
   model->compile();
   model->initialize();
+
+  inputs.resize(getInputDimension().size());
+  outputs.resize(getOutputDimension().size());
 }
 
 const char *NNTrainerInference::getModelConfig() {
@@ -110,27 +122,51 @@ void NNTrainerInference::loadModel() {
 #endif
 }
 
+int NNTrainerInference::reloadWeights() {
+  if (weights_path.empty()) {
+    ml_loge("%s is not given, no weights to reload", weights_path_key);
+    return -EINVAL;
+  }
+
+  std::lock_guard<std::mutex> lock(model_lock);
+  try {
+    model->load(weights_path, ml::train::ModelFormat::MODEL_FORMAT_BIN);
+  } catch (std::exception &e) {
+    ml_loge("reloading weights failed, %s %s", typeid(e).name(), e.what());
+    return -1;
+  }
+
+  ml_logi("weights are reloaded from %s", weights_path.c_str());
+  return 0;
+}
+
 int NNTrainerInference::run(const GstTensorMemory *input,
                             GstTensorMemory *output) {
 #if (DBG)
   gint64 start_time = g_get_real_time();
 #endif
 
-  auto input_dims = getInputDimension();
-  auto output_dims = getOutputDimension();
-
-  std::vector<float *> inputs;
-  inputs.reserve(input_dims.size());
+  /// the dimensions are verified when set, so the memory of the frame is
+  /// handed over as is and the outputs are written to the memory given by the
+  /// pipeline
+  for (size_t idx = 0; idx < inputs.size(); idx++)
+    inputs[idx] = static_cast<float *>(input[idx].data);
 
-  for (size_t idx = 0; idx < input_dims.size(); idx++)
-    // do not allocate new, but instead use tensor::Map
-    inputs.emplace_back(static_cast<float *>(input[idx].data));
+  for (size_t idx = 0; idx < outputs.size(); idx++) {
+    if (output[idx].data == nullptr) {
+      return -1;
+    }
 
-  std::vector<float *> outputs;
-  std::vector<float *> labels;
+    outputs[idx] = static_cast<float *>(output[idx].data);
+  }
 
   try {
-    outputs = model->inference(batch_size, inputs, labels);
+    std::lock_guard<std::mutex> lock(model_lock);
+    /// a tensor_trainer of the same model config hands its weights over at
+    /// the end of every epoch, it is a lookup only if nothing is published
+    weights_version = nntrainer::WeightRegistry::Global().pull(
+      weights_key, *model, weights_version);
+    model->streamInference(batch_size, inputs, outputs);
   } catch (std::exception &e) {
     ml_loge("%s %s", typeid(e).name(), e.what());
     return -2;
@@ -139,14 +175,6 @@ int NNTrainerInference::run(const GstTensorMemory *input,
     return -3;
   }
 
-  for (size_t idx = 0; idx < output_dims.size(); idx++) {
-    if (outputs[idx] == nullptr) {
-      return -1;
-    }
-
-    output[idx].data = static_cast<void *>(outputs[idx]);
-  }
-
 #if (DBG)
   gint64 stop_time = g_get_real_time();
   g_message("Run() is finished: %" G_GINT64_FORMAT, (stop_time - start_time));
@@ -165,6 +193,31 @@ static void nntrainer_close(const GstTensorFilterProperties *prop,
   *private_data = NULL;
 }
 
+/**
+ * @brief get the value of a custom property of the filter
+ *
+ * @param custom custom properties of "key:value" separated by ","
+ * @param key key of the property
+ * @return std::string value, empty if not given
+ */
+static std::string get_custom_property(const char *custom, const gchar *key) {
+  std::string value;
+  if (custom == NULL)
+    return value;
+
+  gchar **options = g_strsplit(custom, ",", -1);
+  for (guint i = 0; options[i] != NULL; ++i) {
+    gchar **option = g_strsplit(options[i], ":", 2);
+    if (g_strv_length(option) == 2 &&
+        g_strcmp0(g_strstrip(option[0]), key) == 0)
+      value = g_strstrip(option[1]);
+    g_strfreev(option);
+  }
+  g_strfreev(options);
+
+  return value;
+}
+
 static int nntrainer_loadModelFile(const GstTensorFilterProperties *prop,
                                    void **private_data) {
   if (prop->num_models != 1)
@@ -182,6 +235,8 @@ static int nntrainer_loadModelFile(const GstTensorFilterProperties *prop,
 
   try {
     nntrainer = new NNTrainerInference(model_file);
+    nntrainer->setWeightsPath(
+      get_custom_property(prop->custom_properties, weights_path_key));
   } catch (std::exception &e) {
     ml_loge("%s %s", typeid(e).name(), e.what());
     return -1;
@@ -200,6 +255,25 @@ static int nntrainer_open(const GstTensorFilterProperties *prop,
   return status;
 }
 
+/**
+ * @brief reload the model when the model property is set again on an updatable
+ * filter. The weights of the same model are reloaded from the weights path, so
+ * a pipeline picks up the weights saved by a tensor_trainer in another process.
+ * A tensor_trainer in the same process needs no reload, its weights are handed
+ * over in memory on the next frame
+ */
+static int nntrainer_reloadModel(const GstTensorFilterProperties *prop,
+                                 void **private_data) {
+  NNTrainerInference *nntrainer =
+    static_cast<NNTrainerInference *>(*private_data);
+  g_return_val_if_fail(nntrainer && prop->num_models == 1, -EINVAL);
+
+  if (g_strcmp0(prop->model_files[0], nntrainer->getModelConfig()) != 0)
+    return nntrainer_loadModelFile(prop, private_data);
+
+  return nntrainer->reloadWeights();
+}
+
 static int nntrainer_run(const GstTensorFilterProperties *prop,
                          void **private_data, const GstTensorMemory *input,
                          GstTensorMemory *output) {
@@ -289,10 +363,11 @@ static GstTensorFilterFramework NNS_support_nntrainer = {
 void init_filter_nntrainer(void) {
   NNS_support_nntrainer.name = filter_subplugin_nntrainer;
   NNS_support_nntrainer.allow_in_place = FALSE;
-  NNS_support_nntrainer.allocate_in_invoke = TRUE;
+  NNS_support_nntrainer.allocate_in_invoke = FALSE;
   NNS_support_nntrainer.run_without_model = FALSE;
   NNS_support_nntrainer.verify_model_path = FALSE;
   NNS_support_nntrainer.invoke_NN = nntrainer_run;
+  NNS_support_nntrainer.reloadModel = nntrainer_reloadModel;
   NNS_support_nntrainer.destroyNotify = nntrainer_destroyNotify;
   NNS_support_nntrainer.checkAvailability = nntrainer_checkAvailability;
   NNS_support_nntrainer.getInputDimension = NULL;
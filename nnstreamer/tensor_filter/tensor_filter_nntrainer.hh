@@ -18,6 +18,7 @@
  */
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <nnstreamer_plugin_api.h>
@@ -86,19 +87,46 @@ public:
   }
 
   /**
-   * @brief run inference, output
+   * @brief run inference, output. The weights published by a tensor_trainer of
+   * the same model config in the process are pulled before, in memory
    *
    * @param input input tensor memory
-   * @param output output tensor memory
+   * @param output output tensor memory allocated by the pipeline, the outputs
+   * are written to
    * @return int 0 if success
    */
   int run(const GstTensorMemory *input, GstTensorMemory *output);
 
+  /**
+   * @brief Set the file to reload the weights from, such as the
+   * model_save_path of a tensor_trainer training the same model in another
+   * process
+   *
+   * @param path path of the weights file
+   */
+  void setWeightsPath(const std::string &path) { weights_path = path; }
+
+  /**
+   * @brief reload the weights from the weights path, waits for the running
+   * inference to finish
+   *
+   * @return int 0 if success
+   */
+  int reloadWeights();
+
 private:
   void loadModel();
 
   unsigned int batch_size;
 
+  std::vector<float *> inputs;  /**< data of the inputs of the frame */
+  std::vector<float *> outputs; /**< data of the outputs of the frame */
+
+  std::string weights_path;    /**< weights to reload, disabled if empty */
+  unsigned int weights_version; /**< version of the weights pulled, 0 if none */
+  std::mutex model_lock;        /**< guards the weights against the reload */
+
   std::string model_config;
+  std::string weights_key; /**< key of the weights in the WeightRegistry */
   std::unique_ptr<ml::train::Model> model;
 };
@@ -0,0 +1,349 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * NNStreamer Tensor_Trainer, nntrainer Module
+ * Copyright (C) 2026 agent <agent@local>
+ */
+/**
+ * @file   tensor_trainer_nntrainer.cc
+ * @date   19 October 2026
+ * @brief  nntrainer training module for tensor_trainer gstreamer plugin
+ * @see    http://github.com/nnstreamer/nnstreamer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ * This is the per-NN-framework plugin for tensor_trainer.
+ * Fill in "GstTensorTrainerFramework" for tensor_trainer.h/c
+ *
+ * The frames pushed by the pipeline are written to the push datasets of the
+ * model, which is trained on a thread of its own. The first
+ * num_training_samples frames of an epoch are used for training and the next
+ * num_validation_samples frames for validation. The weights are published to
+ * the WeightRegistry under the model config at the end of every epoch before
+ * the epoch completion is notified, so a tensor_filter of the same model config
+ * in the process picks them up in memory from its next frame. They are also
+ * saved to model_save_path if given, for a filter in another process.
+ *
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <stdexcept>
+
+#include <nntrainer_error.h>
+#include <weight_registry.h>
+
+#include "tensor_trainer_nntrainer.hh"
+
+#ifdef ml_loge
+#undef ml_loge
+#endif
+
+#ifdef ml_logi
+#undef ml_logi
+#endif
+
+#define ml_loge g_critical
+#define ml_logi g_message
+
+/**
+ * @brief   startup constructor
+ *
+ */
+void init_subplugin_nntrainer(void) __attribute__((constructor));
+
+/**
+ * @brief   startdown destructor
+ *
+ */
+void fini_subplugin_nntrainer(void) __attribute__((destructor));
+
+NNTrainerTrain::NNTrainerTrain(const GstTensorTrainerProperties *prop) :
+  model_config(prop->model_config),
+  weights_key(nntrainer::WeightRegistry::resolveKey(model_config)),
+  model_save_path(prop->model_save_path ? prop->model_save_path : ""),
+  model_load_path(prop->model_load_path ? prop->model_load_path : ""),
+  num_inputs(prop->num_inputs),
+  num_labels(prop->num_labels),
+  num_epochs(prop->num_epochs),
+  num_training_samples(prop->num_training_samples),
+  num_validation_samples(prop->num_validation_samples),
+  num_pushed(0),
+  stopped(false),
+  epoch_count(0),
+  training_loss(0.0),
+  validation_loss(0.0),
+  notifier(nullptr) {
+  NNTR_THROW_IF(num_training_samples == 0, std::invalid_argument)
+    << "num_training_samples must be greater than 0";
+  NNTR_THROW_IF(prop->input_meta.num_tensors != num_inputs + num_labels,
+                std::invalid_argument)
+    << "number of tensors of a frame does not match, given: "
+    << prop->input_meta.num_tensors
+    << " expected: " << num_inputs + num_labels;
+
+  for (unsigned int i = 0; i < prop->input_meta.num_tensors; ++i) {
+    const GstTensorInfo *info = prop->input_meta.info + i;
+    NNTR_THROW_IF(info->type != _NNS_FLOAT32, std::invalid_argument)
+      << "only float32 tensors are supported";
+
+    size_t len = gst_tensor_info_get_size(info) / sizeof(float);
+    (i < num_inputs ? input_lens : label_lens).push_back(len);
+  }
+
+  createModel();
+}
+
+NNTrainerTrain::~NNTrainerTrain() { stop(); }
+
+void NNTrainerTrain::createModel() {
+  model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+  model->load(model_config, ml::train::ModelFormat::MODEL_FORMAT_INI);
+  model->setProperty({"epochs=" + std::to_string(num_epochs)});
+  model->addTrainingCallback(std::make_shared<EpochCallback>(*this));
+
+  /// the frames are written to the iteration queue of the running epoch
+  train_dataset = ml::train::createDataset(
+    ml::train::DatasetType::PUSH,
+    {"epoch_samples=" + std::to_string(num_training_samples)});
+  model->setDataset(ml::train::DatasetModeType::MODE_TRAIN, train_dataset);
+  if (num_validation_samples > 0) {
+    valid_dataset = ml::train::createDataset(
+      ml::train::DatasetType::PUSH,
+      {"epoch_samples=" + std::to_string(num_validation_samples)});
+    model->setDataset(ml::train::DatasetModeType::MODE_VALID, valid_dataset);
+  }
+
+  NNTR_THROW_IF(model->compile() != ML_ERROR_NONE, std::invalid_argument)
+    << "compiling the model failed, config: " << model_config;
+  NNTR_THROW_IF(model->initialize() != ML_ERROR_NONE, std::invalid_argument)
+    << "initializing the model failed, config: " << model_config;
+
+  /// the tensors of a frame are copied as the inputs and labels of a sample
+  auto check_lens = [](const std::vector<ml::train::TensorDim> &dims,
+                       const std::vector<size_t> &lens, const char *what) {
+    NNTR_THROW_IF(dims.size() != lens.size(), std::invalid_argument)
+      << "number of " << what << " does not match, model: " << dims.size()
+      << " frame: " << lens.size();
+    for (unsigned int i = 0; i < dims.size(); ++i) {
+      NNTR_THROW_IF(dims[i].getFeatureLen() != lens[i], std::invalid_argument)
+        << "size of " << what << " " << i
+        << " does not match, model: " << dims[i].getFeatureLen()
+        << " frame: " << lens[i];
+    }
+  };
+  check_lens(model->getInputDimension(), input_lens, "inputs");
+  check_lens(model->getOutputDimension(), label_lens, "labels");
+
+  if (!model_load_path.empty())
+    model->load(model_load_path, ml::train::ModelFormat::MODEL_FORMAT_BIN);
+}
+
+void NNTrainerTrain::trainModel() {
+  try {
+    model->train();
+  } catch (std::exception &e) {
+    ml_loge("%s %s", typeid(e).name(), e.what());
+  } catch (...) {
+    ml_loge("unknown error type thrown");
+  }
+
+  if (notifier) {
+    nnstreamer_trainer_notify_event(notifier, TRAINER_EVENT_TRAINING_COMPLETION,
+                                    NULL);
+  }
+}
+
+void NNTrainerTrain::onEpochEnd(const ml::train::RunStats &training,
+                                const ml::train::RunStats *validation) {
+  /** the epoch cut short by stop() is not reported */
+  if (stopped)
+    return;
+
+  nntrainer::WeightRegistry::Global().publish(weights_key, *model);
+
+  /// a reader of the weights never sees a partially written file, as the
+  /// weights are written aside and renamed over the previous ones
+  if (!model_save_path.empty()) {
+    std::string tmp_path = model_save_path + ".tmp";
+    model->save(tmp_path, ml::train::ModelFormat::MODEL_FORMAT_BIN);
+    NNTR_THROW_IF(std::rename(tmp_path.c_str(), model_save_path.c_str()) != 0,
+                  std::runtime_error)
+      << "saving the weights to " << model_save_path << " failed";
+  }
+
+  training_loss = training.loss;
+  if (validation)
+    validation_loss = validation->loss;
+  epoch_count++;
+
+  if (notifier) {
+    nnstreamer_trainer_notify_event(notifier, TRAINER_EVENT_EPOCH_COMPLETION,
+                                    NULL);
+  }
+}
+
+void NNTrainerTrain::start(GstTensorTrainerEventNotifier *notifier_) {
+  NNTR_THROW_IF(train_thread.joinable(), std::runtime_error)
+    << "training is already started";
+
+  notifier = notifier_;
+  train_thread = std::thread(&NNTrainerTrain::trainModel, this);
+}
+
+void NNTrainerTrain::stop() {
+  stopped = true;
+  model->stopTraining();
+  train_dataset->closePush();
+  if (valid_dataset)
+    valid_dataset->closePush();
+
+  if (train_thread.joinable())
+    train_thread.join();
+}
+
+int NNTrainerTrain::pushData(const GstTensorMemory *input) {
+  std::vector<const float *> inputs(num_inputs), labels(num_labels);
+  for (unsigned int i = 0; i < num_inputs + num_labels; ++i) {
+    bool is_input = i < num_inputs;
+    size_t len = is_input ? input_lens[i] : label_lens[i - num_inputs];
+    if (input[i].size < len * sizeof(float)) {
+      ml_loge("size of the tensor %u is smaller than expected", i);
+      return -EINVAL;
+    }
+
+    const float *data = static_cast<const float *>(input[i].data);
+    (is_input ? inputs[i] : labels[i - num_inputs]) = data;
+  }
+
+  /// the frames of an epoch are for training first, then for validation
+  auto &dataset =
+    num_pushed < num_training_samples ? train_dataset : valid_dataset;
+  num_pushed =
+    (num_pushed + 1) % (num_training_samples + num_validation_samples);
+
+  try {
+    if (!dataset->push(inputs, labels)) {
+      ml_loge("training is stopped, the frame is dropped");
+      return -ESHUTDOWN;
+    }
+  } catch (std::exception &e) {
+    ml_loge("%s %s", typeid(e).name(), e.what());
+    return -EINVAL;
+  }
+
+  return 0;
+}
+
+void NNTrainerTrain::getStatus(GstTensorTrainerProperties *prop) {
+  prop->epoch_count = epoch_count;
+  prop->training_loss = training_loss;
+  prop->validation_loss = validation_loss;
+}
+
+static int nntrainer_create(const GstTensorTrainerFramework *fw,
+                            const GstTensorTrainerProperties *prop,
+                            void **private_data) {
+  g_return_val_if_fail(prop && prop->model_config && private_data, -EINVAL);
+
+  try {
+    *private_data = new NNTrainerTrain(prop);
+  } catch (std::exception &e) {
+    ml_loge("%s %s", typeid(e).name(), e.what());
+    return -1;
+  } catch (...) {
+    ml_loge("unknown error type thrown");
+    return -3;
+  }
+
+  return 0;
+}
+
+static int nntrainer_destroy(const GstTensorTrainerFramework *fw,
+                             const GstTensorTrainerProperties *prop,
+                             void **private_data) {
+  NNTrainerTrain *nntrainer = static_cast<NNTrainerTrain *>(*private_data);
+  if (!nntrainer)
+    return -EINVAL;
+
+  delete nntrainer;
+  *private_data = NULL;
+  return 0;
+}
+
+static int nntrainer_start(const GstTensorTrainerFramework *fw,
+                           const GstTensorTrainerProperties *prop,
+                           GstTensorTrainerEventNotifier *notifier,
+                           void *private_data) {
+  NNTrainerTrain *nntrainer = static_cast<NNTrainerTrain *>(private_data);
+  g_return_val_if_fail(nntrainer, -EINVAL);
+
+  try {
+    nntrainer->start(notifier);
+  } catch (std::exception &e) {
+    ml_loge("%s %s", typeid(e).name(), e.what());
+    return -1;
+  }
+
+  return 0;
+}
+
+static int nntrainer_stop(const GstTensorTrainerFramework *fw,
+                          const GstTensorTrainerProperties *prop,
+                          void **private_data) {
+  NNTrainerTrain *nntrainer = static_cast<NNTrainerTrain *>(*private_data);
+  g_return_val_if_fail(nntrainer, -EINVAL);
+
+  nntrainer->stop();
+  return 0;
+}
+
+static int nntrainer_push_data(const GstTensorTrainerFramework *fw,
+                               const GstTensorTrainerProperties *prop,
+                               void *private_data,
+                               const GstTensorMemory *input) {
+  NNTrainerTrain *nntrainer = static_cast<NNTrainerTrain *>(private_data);
+  g_return_val_if_fail(nntrainer && input, -EINVAL);
+
+  return nntrainer->pushData(input);
+}
+
+static int nntrainer_getStatus(const GstTensorTrainerFramework *fw,
+                               GstTensorTrainerProperties *prop,
+                               void *private_data) {
+  NNTrainerTrain *nntrainer = static_cast<NNTrainerTrain *>(private_data);
+  g_return_val_if_fail(nntrainer && prop, -EINVAL);
+
+  nntrainer->getStatus(prop);
+  return 0;
+}
+
+static gchar subplugin_nntrainer[] = "nntrainer";
+
+static int nntrainer_getFrameworkInfo(const GstTensorTrainerFramework *fw,
+                                      const GstTensorTrainerProperties *prop,
+                                      void *private_data,
+                                      GstTensorTrainerFrameworkInfo *fw_info) {
+  g_return_val_if_fail(fw_info, -EINVAL);
+
+  fw_info->name = subplugin_nntrainer;
+  return 0;
+}
+
+static GstTensorTrainerFramework NNS_Trainer_support_nntrainer = {
+  .version = GST_TENSOR_TRAINER_FRAMEWORK_V1,
+  .create = nntrainer_create,
+  .destroy = nntrainer_destroy,
+  .start = nntrainer_start,
+  .stop = nntrainer_stop,
+  .push_data = nntrainer_push_data,
+  .getStatus = nntrainer_getStatus,
+  .getFrameworkInfo = nntrainer_getFrameworkInfo,
+};
+
+void init_subplugin_nntrainer(void) {
+  nnstreamer_trainer_probe(&NNS_Trainer_support_nntrainer);
+}
+
+void fini_subplugin_nntrainer(void) {
+  nnstreamer_trainer_exit(subplugin_nntrainer);
+}
@@ -0,0 +1,157 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * NNStreamer Tensor_Trainer, nntrainer Module
+ * Copyright (C) 2026 agent <agent@local>
+ */
+/**
+ * @file   tensor_trainer_nntrainer.hh
+ * @date   19 October 2026
+ * @brief  nntrainer training module for tensor_trainer gstreamer plugin header
+ * @note   The class has been exposed from tensor_trainer_nntrainer.cc to
+ * unittest
+ * @see    http://github.com/nnstreamer/nnstreamer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ * This is the per-NN-framework plugin for tensor_trainer.
+ * Fill in "GstTensorTrainerFramework" for tensor_trainer.h/c
+ *
+ */
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nnstreamer_plugin_api_trainer.h>
+#include <nnstreamer_plugin_api_util.h>
+
+#include <dataset.h>
+#include <model.h>
+
+/**
+ * @brief NNTrainerTrain wrapper for nnstreamer trainer subplugin
+ *
+ */
+class NNTrainerTrain {
+public:
+  /**
+   * @brief Construct a new NNTrainerTrain object
+   *
+   * @param prop tensor trainer subplugin properties
+   */
+  NNTrainerTrain(const GstTensorTrainerProperties *prop);
+
+  /**
+   * @brief Destroy the NNTrainerTrain object, stops the training
+   *
+   */
+  ~NNTrainerTrain();
+
+  /**
+   * @brief start training in the background
+   *
+   * @param notifier notifier of the training events
+   */
+  void start(GstTensorTrainerEventNotifier *notifier);
+
+  /**
+   * @brief stop training, the frames not trained on are dropped
+   *
+   */
+  void stop();
+
+  /**
+   * @brief push a frame of the pipeline to the dataset of its turn, blocks
+   * until the model runs an epoch of the dataset
+   *
+   * @param input inputs followed by labels of the frame
+   * @return int 0 if success
+   */
+  int pushData(const GstTensorMemory *input);
+
+  /**
+   * @brief fill the status of the last epoch trained, can be called from any
+   * thread
+   *
+   * @param[out] prop properties to fill the status in
+   */
+  void getStatus(GstTensorTrainerProperties *prop);
+
+private:
+  /**
+   * @brief training callback which reports the end of an epoch to the trainer
+   *
+   */
+  class EpochCallback : public ml::train::TrainingCallback {
+  public:
+    /**
+     * @brief Construct a new Epoch Callback object
+     *
+     * @param trainer_ trainer to report to
+     */
+    EpochCallback(NNTrainerTrain &trainer_) : trainer(trainer_) {}
+
+    /**
+     * @copydoc ml::train::TrainingCallback::onEpochEnd
+     */
+    void onEpochEnd(ml::train::Model &model, unsigned int epoch,
+                    const ml::train::RunStats &training,
+                    const ml::train::RunStats *validation) override {
+      trainer.onEpochEnd(training, validation);
+    }
+
+  private:
+    NNTrainerTrain &trainer;
+  };
+
+  /**
+   * @brief create, compile and initialize the model
+   *
+   */
+  void createModel();
+
+  /**
+   * @brief train the model, the body of the training thread
+   *
+   */
+  void trainModel();
+
+  /**
+   * @brief publish the weights to the filters of the same model config and the
+   * status of an epoch trained, and notify the end of the epoch. Called on the
+   * training thread after the validation
+   *
+   * @param training statistics of the training
+   * @param validation statistics of the validation, nullptr if not validated
+   */
+  void onEpochEnd(const ml::train::RunStats &training,
+                  const ml::train::RunStats *validation);
+
+  std::string model_config;
+  std::string weights_key; /**< key of the weights in the WeightRegistry */
+  std::string model_save_path;
+  std::string model_load_path;
+
+  unsigned int num_inputs;
+  unsigned int num_labels;
+  unsigned int num_epochs;
+  unsigned int num_training_samples;
+  unsigned int num_validation_samples;
+
+  std::vector<size_t> input_lens; /**< number of elements of each input */
+  std::vector<size_t> label_lens; /**< number of elements of each label */
+
+  std::shared_ptr<ml::train::Dataset> train_dataset;
+  std::shared_ptr<ml::train::Dataset> valid_dataset;
+  unsigned int num_pushed; /**< number of frames pushed in this epoch */
+
+  std::atomic<bool> stopped;             /**< true once stop() is called */
+  std::atomic<unsigned int> epoch_count; /**< number of epochs trained */
+  std::atomic<double> training_loss;     /**< loss of the last epoch */
+  std::atomic<double> validation_loss;   /**< loss of the last validation */
+
+  GstTensorTrainerEventNotifier *notifier;
+  std::unique_ptr<ml::train::Model> model;
+  std::thread train_thread;
+};
@@ -50,7 +50,9 @@
 #include <identity_layer.h>
 #include <input_layer.h>
 #include <lr_scheduler_constant.h>
+#include <lr_scheduler_cosine.h>
 #include <lr_scheduler_exponential.h>
+#include <lr_scheduler_step.h>
 #include <lstm.h>
 #include <lstmcell.h>
 #include <mol_attention_layer.h>
@@ -227,6 +229,12 @@ static void add_default_object(AppContext &ac) {
   ac.registerFactory(
     nntrainer::createLearningRateScheduler<ExponentialLearningRateScheduler>,
     ExponentialLearningRateScheduler::type, LRType::EXPONENTIAL);
+  ac.registerFactory(
+    nntrainer::createLearningRateScheduler<StepLearningRateScheduler>,
+    StepLearningRateScheduler::type, LRType::STEP);
+  ac.registerFactory(
+    nntrainer::createLearningRateScheduler<CosineLearningRateScheduler>,
+    CosineLearningRateScheduler::type, LRType::COSINE);
 
   using LayerType = ml::train::LayerType;
   ac.registerFactory(nntrainer::createLayer<InputLayer>, InputLayer::type,
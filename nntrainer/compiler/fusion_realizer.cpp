@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file fusion_realizer.cpp
+ * @date 19 October 2026
+ * @brief NNTrainer graph realizer which fuses batch normalization and
+ * activation into the preceding conv2d / fully connected layer for inference
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug No known bugs except for NYI items
+ */
+#include <fusion_realizer.h>
+#include <remap_realizer.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include <activation_layer.h>
+#include <bn_layer.h>
+#include <common_properties.h>
+#include <conv2d_layer.h>
+#include <fc_layer.h>
+#include <layer_node.h>
+#include <node_exporter.h>
+
+namespace nntrainer {
+
+FusionRealizer::~FusionRealizer() {}
+
+/**
+ * @brief get the properties of the batch normalization to hand over to the
+ * producer
+ *
+ * @param bn batch normalization node
+ * @param channel_axis channel axis of the producer output
+ * @param[out] props properties to set to the producer
+ * @retval true if the batch normalization can be fused
+ */
+static bool getFusedBNProperties(const LayerNode &bn, unsigned int channel_axis,
+                                 std::vector<std::string> &props) {
+  static const std::unordered_set<std::string> handed_over = {
+    "epsilon", "moving_mean_initializer", "moving_variance_initializer",
+    "beta_initializer", "gamma_initializer"};
+
+  Exporter e;
+  bn.exportTo(e, ExportMethods::METHOD_STRINGVECTOR);
+  auto exported = e.getResult<ExportMethods::METHOD_STRINGVECTOR>();
+
+  props = {"fused_batch_normalization=true"};
+  for (auto &[key, value] : *exported) {
+    if (key == "axis" && std::stoul(value) != channel_axis)
+      return false;
+    if (handed_over.count(key))
+      props.push_back(key + "=" + value);
+  }
+  return true;
+}
+
+GraphRepresentation
+FusionRealizer::realize(const GraphRepresentation &reference) {
+  std::unordered_map<std::string, std::vector<std::shared_ptr<LayerNode>>>
+    consumers;
+  for (auto &node : reference) {
+    for (unsigned int i = 0; i < node->getNumInputConnections(); ++i) {
+      consumers[node->getInputConnectionName(i)].push_back(node);
+    }
+  }
+
+  /// the node is fused only if it is the only consumer of the producer
+  auto only_consumer =
+    [&consumers](const std::string &name) -> std::shared_ptr<LayerNode> {
+    auto iter = consumers.find(name);
+    if (iter == consumers.end() || iter->second.size() != 1 ||
+        iter->second.front()->getNumInputConnections() != 1)
+      return nullptr;
+    return iter->second.front();
+  };
+
+  std::unordered_set<std::string> fused;
+  std::unordered_map<std::string /**< fused_layer_name */,
+                     std::string /**< producer_name */>
+    remap_table;
+
+  for (auto &node : reference) {
+    unsigned int channel_axis;
+    if (node->getType() == Conv2DLayer::type)
+      channel_axis = 1;
+    else if (node->getType() == FullyConnectedLayer::type)
+      channel_axis = 3;
+    else
+      continue;
+
+    std::string tail = node->getName();
+    auto next = only_consumer(tail);
+
+    std::vector<std::string> bn_props;
+    if (next && next->getType() == BatchNormalizationLayer::type &&
+        getFusedBNProperties(*next, channel_axis, bn_props)) {
+      node->setProperty(bn_props);
+      fused.insert(next->getName());
+      tail = next->getName();
+      next = only_consumer(tail);
+    }
+
+    /// an activation without consumers is kept for the loss
+    if (next && next->getType() == ActivationLayer::type &&
+        consumers.count(next->getName())) {
+      props::Activation act_prop;
+      act_prop.set(next->getActivationType());
+      node->setProperty({"fused_activation=" + to_string(act_prop)});
+      fused.insert(next->getName());
+      tail = next->getName();
+    }
+
+    if (tail != node->getName())
+      remap_table.insert({tail, node->getName()});
+  }
+
+  GraphRepresentation processed;
+  processed.reserve(reference.size() - fused.size());
+  for (auto &node : reference) {
+    if (!fused.count(node->getName()))
+      processed.push_back(node);
+  }
+
+  return RemapRealizer([&remap_table](std::string &name, unsigned &idx) {
+           if (auto iter = remap_table.find(name); iter != remap_table.end()) {
+             name = iter->second;
+           }
+         })
+    .realize(processed);
+}
+
+} // namespace nntrainer
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file fusion_realizer.h
+ * @date 19 October 2026
+ * @brief NNTrainer graph realizer which fuses batch normalization and
+ * activation into the preceding conv2d / fully connected layer for inference
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug No known bugs except for NYI items
+ */
+#ifndef __FUSION_REALIZER_H__
+#define __FUSION_REALIZER_H__
+
+#include <memory>
+#include <vector>
+
+#include <realizer.h>
+
+namespace nntrainer {
+
+/**
+ * @brief Graph realizer which fuses producer -> batch normalization ->
+ * activation chains, where the producer is conv2d or fully connected. The
+ * fused layers are removed and their consumers are connected to the producer.
+ *
+ * @note the fused graph can only be used for inference. The weights of the
+ * batch normalization are kept in the producer in the same order, so a model
+ * file saved without fusion can be loaded.
+ * @note activations which are an output of the graph are kept, as the loss
+ * may need to see them
+ */
+class FusionRealizer final : public GraphRealizer {
+public:
+  /**
+   * @brief Destroy the Graph Realizer object
+   *
+   */
+  ~FusionRealizer();
+
+  /**
+   * @brief graph realizer creates a new graph based on the reference
+   *
+   */
+  GraphRepresentation realize(const GraphRepresentation &reference) override;
+};
+
+} // namespace nntrainer
+
+#endif // __FUSION_REALIZER_H__
@@ -27,6 +27,7 @@ TfOpNode::TfOpNode() :
   node_owned_variable(),
   op_type(tflite::BuiltinOperator_ADD),
   builtin_ops(),
+  builtin_ops_fn(nullptr),
   builtin_option_type(tflite::BuiltinOptions_NONE){};
 
 void TfOpNode::setLayerNode(const LayerNode &layer) {
@@ -80,6 +81,9 @@ void TfOpNode::finalize() {
 
 flatbuffers::Offset<void>
 TfOpNode::getBuiltinOps(flatbuffers::FlatBufferBuilder &f) const {
+  if (builtin_ops_fn)
+    return builtin_ops_fn(f);
+
   switch (op_type) {
   case tflite::BuiltinOperator_FULLY_CONNECTED:
     return tflite::CreateFullyConnectedOptions(f).Union();
@@ -95,4 +99,10 @@ void TfOpNode::setBuiltinOptions(
   builtin_option_type = builtin_option_type_;
 }
 
+void TfOpNode::setBuiltinOptionsFn(tflite::BuiltinOptions builtin_option_type_,
+                                   BuiltinOpsFn builtin_ops_fn_) {
+  builtin_ops_fn = builtin_ops_fn_;
+  builtin_option_type = builtin_option_type_;
+}
+
 } // namespace nntrainer
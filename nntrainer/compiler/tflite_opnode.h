@@ -36,6 +36,9 @@ public:
   using TransformFn =
     std::function<std::vector<Tensor>(std::vector<const Tensor *> &)>;
 
+  using BuiltinOpsFn = std::function<flatbuffers::Offset<void>(
+    flatbuffers::FlatBufferBuilder &)>;
+
   /**
    * @brief Construct a new Tf object
    *
@@ -80,6 +83,16 @@ public:
   void setBuiltinOptions(tflite::BuiltinOptions builtin_option_type_,
                          const flatbuffers::Offset<void> &builtin_ops_);
 
+  /**
+   * @brief Set the Builtin Options object which is built when the node is
+   * serialized, for the options which depend on the layer properties
+   *
+   * @param builtin_option_type_ builtin option type
+   * @param builtin_ops_fn_ function to build the builtin options
+   */
+  void setBuiltinOptionsFn(tflite::BuiltinOptions builtin_option_type_,
+                           BuiltinOpsFn builtin_ops_fn_);
+
   /**
    * @brief Get the Inputs object
    *
@@ -182,6 +195,7 @@ private:
 
   /// retrieve this from export_to
   flatbuffers::Offset<void> builtin_ops;
+  BuiltinOpsFn builtin_ops_fn; /**< builds builtin_ops if set */
   tflite::BuiltinOptions builtin_option_type;
 };
 
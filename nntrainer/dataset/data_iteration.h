@@ -124,6 +124,14 @@ public:
    */
   void setEndSample();
 
+  /**
+   * @brief Get the sample indices of the batch, the nth element is the index
+   * of the nth sample given to the data producer
+   *
+   * @return std::vector<unsigned int> sample indices until the end sample
+   */
+  std::vector<unsigned int> getIndices() const;
+
 private:
   std::vector<Tensor> inputs, labels;
   std::vector<Sample> samples;
@@ -179,8 +187,23 @@ public:
    */
   const std::vector<Tensor> &getLabelsRef() const { return labels; }
 
+  /**
+   * @brief Set the index of the sample given to the data producer
+   *
+   * @param index_ index of the sample
+   */
+  void setIndex(unsigned int index_) { index = index_; }
+
+  /**
+   * @brief Get the index of the sample given to the data producer
+   *
+   * @return unsigned int index of the sample
+   */
+  unsigned int getIndex() const { return index; }
+
 private:
   std::vector<Tensor> inputs, labels;
+  unsigned int index; /**< index of the sample in the data producer */
 };
 
 } // namespace nntrainer
@@ -15,6 +15,7 @@
 
 #include <functional>
 #include <limits>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -24,6 +25,7 @@
 namespace nntrainer {
 
 class Exporter;
+class IterationQueue;
 enum class ExportMethods;
 
 /**
@@ -125,6 +127,39 @@ public:
    * @return bool true if thread safe.
    */
   virtual bool isMultiThreadSafe() const { return false; }
+
+  /**
+   * @brief fill the samples of an epoch to the queue by the producer itself.
+   * This is for the producers fed from outside, which cannot generate a sample
+   * upon request. If this returns true, the generator is not called
+   * @note the call returns when the epoch has ended
+   *
+   * @param iq iteration queue of the epoch
+   * @return bool true if the producer has filled the queue
+   */
+  virtual bool fill(IterationQueue &iq) { return false; }
+
+  /**
+   * @brief push a sample to the producer
+   *
+   * @param inputs data of the inputs of a sample
+   * @param labels data of the labels of a sample
+   * @return bool true if the sample is accepted, false if dropped
+   * @throw std::invalid_argument if the producer cannot be pushed to
+   */
+  virtual bool push(const std::vector<const float *> &inputs,
+                    const std::vector<const float *> &labels) {
+    throw std::invalid_argument("push is not supported by the producer");
+  }
+
+  /**
+   * @brief close the producer to push, no more sample is accepted
+   *
+   * @throw std::invalid_argument if the producer cannot be pushed to
+   */
+  virtual void closePush() {
+    throw std::invalid_argument("push is not supported by the producer");
+  }
 };
 } // namespace nntrainer
 #endif // __DATA_PRODUCER_H__
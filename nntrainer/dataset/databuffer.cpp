@@ -101,14 +101,20 @@ DataBuffer::startFetchWorker(const std::vector<TensorDim> &input_dims,
 
   /// case of generator
   if (size == DataProducer::SIZE_UNDEFINED) {
-    return std::async(std::launch::async, [iq, generator] {
+    return std::async(std::launch::async, [iq, generator, producer = producer] {
       auto notifier = NotifyOnDestruct(iq.get());
+      /// the producer fed from outside fills the queue by itself
+      if (producer->fill(*iq)) {
+        return iq;
+      }
+
       for (unsigned int i = 0; i < DataProducer::SIZE_UNDEFINED; ++i) {
         /// below loop can be parallelized
         auto sample_view = iq->requestEmptySlot();
         NNTR_THROW_IF(sample_view.isEmpty(), std::runtime_error)
           << "[Databuffer] Cannot fill empty buffer";
         auto &sample = sample_view.get();
+        sample.setIndex(i);
         try {
           bool last =
             generator(i, sample.getInputsRef(), sample.getLabelsRef());
@@ -141,8 +147,9 @@ DataBuffer::startFetchWorker(const std::vector<TensorDim> &input_dims,
       NNTR_THROW_IF(sample_view.isEmpty(), std::runtime_error)
         << "[Databuffer] Cannot fill empty buffer";
       auto &sample = sample_view.get();
+      sample.setIndex(shuffle ? idxes[i] : i);
       try {
-        generator(shuffle ? idxes[i] : i, sample.getInputsRef(),
+        generator(sample.getIndex(), sample.getInputsRef(),
                   sample.getLabelsRef());
       } catch (std::exception &e) {
         ml_loge("Fetching sample failed, Error: %s", e.what());
@@ -171,47 +178,10 @@ DataBuffer::getGenerator(const std::vector<TensorDim> &input_dims,
           producer->size(input_dims, label_dims)};
 }
 
-void DataBuffer::displayProgress(const int count, float loss) {
-  int barWidth = 20;
-  /** this is temporary measure, will be getting this as an argument */
-  int batch_size = 1;
-  int samples_per_epoch = 0;
-
-  std::stringstream ssInt;
-  ssInt << count * batch_size;
-
-  std::string str = ssInt.str();
-  int len = str.size();
-
-  if (samples_per_epoch == 0) {
-    int pad_left = (barWidth - len) / 2;
-    int pad_right = barWidth - pad_left - len;
-    std::string out_str =
-      std::string(pad_left, ' ') + str + std::string(pad_right, ' ');
-    std::cout << " [ ";
-    std::cout << out_str;
-    std::cout << " ] "
-              << " ( Training Loss: " << loss << " )\r";
-  } else {
-    float progress;
-    if (batch_size > samples_per_epoch)
-      progress = 1.0;
-    else
-      progress = (((float)(count * batch_size)) / (float)samples_per_epoch);
-
-    int pos = barWidth * progress;
-    std::cout << " [ ";
-    for (int l = 0; l < barWidth; ++l) {
-      if (l <= pos)
-        std::cout << "=";
-      else
-        std::cout << " ";
-    }
-    std::cout << " ] " << int(progress * 100.0) << "% ( Training Loss: " << loss
-              << " )\r";
-  }
-
-  std::cout.flush();
+unsigned int DataBuffer::size(const std::vector<TensorDim> &input_dims,
+                              const std::vector<TensorDim> &label_dims) const {
+  NNTR_THROW_IF(!producer, std::invalid_argument) << "producer does not exist";
+  return producer->size(input_dims, label_dims);
 }
 
 void DataBuffer::setProperty(const std::vector<std::string> &values) {
@@ -224,6 +194,17 @@ void DataBuffer::setProperty(const std::vector<std::string> &values) {
   }
 }
 
+bool DataBuffer::push(const std::vector<const float *> &inputs,
+                      const std::vector<const float *> &labels) {
+  NNTR_THROW_IF(!producer, std::invalid_argument) << "producer is empty";
+  return producer->push(inputs, labels);
+}
+
+void DataBuffer::closePush() {
+  NNTR_THROW_IF(!producer, std::invalid_argument) << "producer is empty";
+  producer->closePush();
+}
+
 const std::string DataBuffer::getType() const {
   NNTR_THROW_IF(!producer, std::invalid_argument) << "producer is empty";
   return producer->getType();
@@ -114,12 +114,15 @@ public:
                const std::vector<TensorDim> &label_dims);
 
   /**
-   * @brief     Display Progress
-   * @param[in] count calculated set ( batch_size size )
-   * @param[in] type buffer type ( MODE_TRAIN, MODE_VALID, MODE_TEST )
-   * @retval void
+   * @brief Get the number of samples the producer gives in an epoch
+   *
+   * @param input_dims dimension of input_dims
+   * @param label_dims dimension of label_dims
+   * @return unsigned int number of samples, DataProducer::SIZE_UNDEFINED if
+   * the producer is a generator of unknown size
    */
-  void displayProgress(const int count, float loss);
+  unsigned int size(const std::vector<TensorDim> &input_dims,
+                    const std::vector<TensorDim> &label_dims) const;
 
   /**
    * @brief     set property
@@ -129,6 +132,18 @@ public:
    */
   void setProperty(const std::vector<std::string> &values) override;
 
+  /**
+   * @copydoc ml::train::Dataset::push(const std::vector<const float *>
+   * &inputs, const std::vector<const float *> &labels)
+   */
+  bool push(const std::vector<const float *> &inputs,
+            const std::vector<const float *> &labels) override;
+
+  /**
+   * @copydoc ml::train::Dataset::closePush()
+   */
+  void closePush() override;
+
   /**
    * @brief Get the Type of underlying producer
    *
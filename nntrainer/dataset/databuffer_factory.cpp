@@ -15,6 +15,7 @@
 #include <data_producer.h>
 #include <func_data_producer.h>
 #include <nntrainer_error.h>
+#include <push_data_producer.h>
 #include <raw_file_data_producer.h>
 
 namespace nntrainer {
@@ -29,6 +30,9 @@ std::unique_ptr<DataBuffer> createDataBuffer(DatasetType type) {
   case DatasetType::FILE:
     dp = std::make_unique<RawFileDataProducer>();
     break;
+  case DatasetType::PUSH:
+    dp = std::make_unique<PushDataProducer>();
+    break;
   case DatasetType::UNKNOWN:
     [[fallthrough]];
   default:
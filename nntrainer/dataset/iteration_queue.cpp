@@ -90,6 +90,16 @@ ScopedView<Sample> IterationQueue::requestEmptySlot() {
   return view;
 }
 
+bool IterationQueue::hasEmptySlot() {
+  std::scoped_lock lg(empty_mutex);
+  if (being_filled != nullptr &&
+      current_iterator + 1 != being_filled->get().end()) {
+    return true;
+  }
+
+  return !empty_q.isEmpty();
+}
+
 ScopedView<Iteration> IterationQueue::requestFilledSlot() {
   std::scoped_lock lock(filled_mutex);
 
@@ -118,11 +128,17 @@ ScopedView<Iteration> IterationQueue::requestFilledSlot() {
   }
 
   return ScopedView<Iteration>(
-    &iteration->get(), [this, iteration] { markEmpty(iteration); },
+    &iteration->get(),
+    [this, iteration] {
+      markEmpty(iteration);
+      notifyEmptied();
+    },
     [this, iteration] {
       std::unique_lock lock(filled_mutex);
       flow_state.store(FlowState::FLOW_STATE_STOPPED);
       markEmpty(iteration);
+      lock.unlock();
+      notifyEmptied();
     });
 }
 
@@ -165,6 +181,18 @@ void IterationQueue::markEmpty(MarkableIteration *iteration) {
   empty_q.push(iteration);
 }
 
+void IterationQueue::setOnEmptied(std::function<void(void)> &&on_emptied_) {
+  std::scoped_lock lg(on_emptied_mutex);
+  on_emptied = std::move(on_emptied_);
+}
+
+void IterationQueue::notifyEmptied() {
+  std::scoped_lock lg(on_emptied_mutex);
+  if (on_emptied) {
+    on_emptied();
+  }
+}
+
 IterationQueue::MarkableIteration::MarkableIteration(
   const std::vector<ml::train::TensorDim> &input_dims,
   const std::vector<ml::train::TensorDim> &label_dims, IterationQueue *iq) :
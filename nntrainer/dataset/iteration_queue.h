@@ -226,6 +226,16 @@ public:
    */
   ScopedView<Sample> requestEmptySlot();
 
+  /**
+   * @brief check if requestEmptySlot() can give a sample without waiting for
+   * an iteration to be emptied
+   * @note the result is only valid while no one else is requesting an empty
+   * slot
+   *
+   * @return bool true if an empty sample is available
+   */
+  bool hasEmptySlot();
+
   /**
    * @brief request filled iteration from the queue.
    * @note User must check if ScopedView actually has a value by calling
@@ -263,6 +273,17 @@ public:
    */
   void notifyEndOfRequestEmpty();
 
+  /**
+   * @brief set the callback to be called when an iteration requested by
+   * requestFilledSlot() is given back, so that its slot can be filled again
+   * @note the callback is called from the thread giving the iteration back,
+   * without holding a lock of the queue. Unsetting it waits for the running
+   * callback to return.
+   *
+   * @param on_emptied_ callback to set, nullptr to unset
+   */
+  void setOnEmptied(std::function<void(void)> &&on_emptied_);
+
 private:
   /**
    * @brief A wrapper object around @c Iteration which marks filled when filling
@@ -360,6 +381,12 @@ private:
    */
   void markEmpty(MarkableIteration *iteration) /** noexcept */;
 
+  /**
+   * @brief call the callback set by setOnEmptied(), if any
+   *
+   */
+  void notifyEmptied();
+
   std::vector<MarkableIteration> iterations; /**< allocated iterations */
   MarkableIteration *being_filled; /**< last iteration that is being filled */
   std::vector<Sample>::iterator
@@ -376,6 +403,9 @@ private:
     notify_emptied_cv; /**< conditional variable to wait based on the
                            num_being_filled */
   std::atomic<FlowState> flow_state; /**< flow state of the queue */
+  std::mutex on_emptied_mutex;       /**< mutex guarding on_emptied */
+  std::function<void(void)>
+    on_emptied; /**< called when a filled iteration is given back */
 
   unsigned int batch_size;
   ViewQueue<MarkableIteration> empty_q;  /**< iterations to be filled */
@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   push_data_producer.cpp
+ * @date   19 October 2026
+ * @brief  This file contains a data producer which is pushed samples to
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <push_data_producer.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include <base_properties.h>
+#include <iteration_queue.h>
+#include <nntrainer_error.h>
+#include <node_exporter.h>
+
+namespace nntrainer {
+
+/**
+ * @brief Enumeration of the backpressure policies
+ *
+ */
+struct BackpressureInfo {
+  using Enum = PushDataProducer::Backpressure;
+  static constexpr std::initializer_list<Enum> EnumList = {Enum::BLOCK,
+                                                           Enum::DROP};
+
+  static constexpr const char *EnumStr[] = {"block", "drop"};
+};
+
+/**
+ * @brief Props containing the backpressure policy
+ *
+ */
+class PropsBackpressure final : public EnumProperty<BackpressureInfo> {
+public:
+  /**
+   * @brief Construct a new props backpressure object with a default value
+   *
+   * @param value default value
+   */
+  PropsBackpressure(
+    BackpressureInfo::Enum value = BackpressureInfo::Enum::BLOCK) {
+    set(value);
+  }
+  using prop_tag = enum_class_prop_tag;
+  static constexpr const char *key = "backpressure"; /**< unique key */
+};
+
+/**
+ * @brief Props containing the number of samples of an epoch, 0 if unbounded
+ *
+ */
+class PropsEpochSamples : public Property<unsigned int> {
+public:
+  /**
+   * @brief Construct a new props epoch samples object with a default value
+   *
+   * @param value default value
+   */
+  PropsEpochSamples(unsigned int value = 0) { set(value); }
+  static constexpr const char *key = "epoch_samples"; /**< unique key */
+  using prop_tag = uint_prop_tag;                     /**< property type */
+};
+
+/**
+ * @brief Props containing the duration of an epoch in milliseconds, 0 if
+ * unbounded
+ *
+ */
+class PropsEpochDuration : public Property<unsigned int> {
+public:
+  /**
+   * @brief Construct a new props epoch duration object with a default value
+   *
+   * @param value default value
+   */
+  PropsEpochDuration(unsigned int value = 0) { set(value); }
+  static constexpr const char *key = "epoch_duration"; /**< unique key */
+  using prop_tag = uint_prop_tag;                      /**< property type */
+};
+
+PushDataProducer::PushDataProducer() :
+  push_props(new Props()),
+  iq(nullptr),
+  count(0),
+  closed(false) {}
+
+PushDataProducer::~PushDataProducer() {}
+
+const std::string PushDataProducer::getType() const {
+  return PushDataProducer::type;
+}
+
+void PushDataProducer::setProperty(const std::vector<std::string> &properties) {
+  auto left = loadProperties(properties, *push_props);
+  NNTR_THROW_IF(!left.empty(), std::invalid_argument)
+    << "There are unparsed properties, size: " << left.size();
+}
+
+DataProducer::Generator
+PushDataProducer::finalize(const std::vector<TensorDim> &input_dims,
+                           const std::vector<TensorDim> &label_dims,
+                           void *user_data) {
+  std::scoped_lock lk(m);
+  input_lens.clear();
+  for (auto const &dim : input_dims) {
+    input_lens.push_back(dim.getFeatureLen());
+  }
+
+  label_lens.clear();
+  for (auto const &dim : label_dims) {
+    label_lens.push_back(dim.getFeatureLen());
+  }
+
+  return DataProducer::Generator();
+}
+
+bool PushDataProducer::fill(IterationQueue &iq_) {
+  auto epoch_samples = std::get<PropsEpochSamples>(*push_props).get();
+  auto epoch_duration = std::get<PropsEpochDuration>(*push_props).get();
+
+  /** a blocked push() waits for the consumer to give a slot back. The
+   * callback takes m, so it is set and unset without holding m */
+  iq_.setOnEmptied([this] {
+    std::scoped_lock lk(m);
+    cv.notify_all();
+  });
+
+  std::unique_lock lk(m);
+  if (!closed) {
+    iq = &iq_;
+    count = 0;
+    cv.notify_all();
+
+    auto is_full = [this, epoch_samples] {
+      return closed || (epoch_samples != 0 && count >= epoch_samples);
+    };
+
+    if (epoch_duration != 0) {
+      auto until = std::chrono::steady_clock::now() +
+                   std::chrono::milliseconds(epoch_duration);
+      cv.wait_until(lk, until, is_full);
+      /** an epoch must have a sample to run on */
+      cv.wait(lk, [this, &is_full] { return is_full() || count != 0; });
+    } else {
+      cv.wait(lk, is_full);
+    }
+
+    /** the pushers write under the lock, so nothing is being written here */
+    iq = nullptr;
+  }
+  lk.unlock();
+
+  iq_.setOnEmptied(nullptr);
+  return true;
+}
+
+bool PushDataProducer::push(const std::vector<const float *> &inputs,
+                            const std::vector<const float *> &labels) {
+  NNTR_THROW_IF(std::any_of(inputs.begin(), inputs.end(),
+                            [](const float *data) { return !data; }) ||
+                  std::any_of(labels.begin(), labels.end(),
+                              [](const float *data) { return !data; }),
+                std::invalid_argument)
+    << "[PushDataProducer] given data is null";
+
+  bool drop = std::get<PropsBackpressure>(*push_props).get() ==
+              PushDataProducer::Backpressure::DROP;
+  auto epoch_samples = std::get<PropsEpochSamples>(*push_props).get();
+
+  std::unique_lock lk(m);
+  auto can_write = [this, epoch_samples] {
+    return closed ||
+           (iq != nullptr && (epoch_samples == 0 || count < epoch_samples) &&
+            iq->hasEmptySlot());
+  };
+
+  if (drop) {
+    if (!can_write() || closed) {
+      return false;
+    }
+  } else {
+    /** woken by fill(), closePush() or the queue giving a slot back */
+    cv.wait(lk, can_write);
+    if (closed) {
+      return false;
+    }
+  }
+
+  NNTR_THROW_IF(inputs.size() != input_lens.size() ||
+                  labels.size() != label_lens.size(),
+                std::invalid_argument)
+    << "[PushDataProducer] number of data does not match, inputs: "
+    << inputs.size() << " expected: " << input_lens.size()
+    << " labels: " << labels.size() << " expected: " << label_lens.size();
+
+  {
+    /** the pushers write under the lock, so the free slot is still there */
+    auto sample_view = iq->requestEmptySlot();
+    auto &sample = sample_view.get();
+    sample.setIndex(count);
+
+    auto &input_tensors = sample.getInputsRef();
+    for (unsigned int i = 0; i < inputs.size(); ++i) {
+      std::copy(inputs[i], inputs[i] + input_lens[i],
+                input_tensors[i].getData());
+    }
+
+    auto &label_tensors = sample.getLabelsRef();
+    for (unsigned int i = 0; i < labels.size(); ++i) {
+      std::copy(labels[i], labels[i] + label_lens[i],
+                label_tensors[i].getData());
+    }
+  }
+
+  count++;
+  cv.notify_all();
+  return true;
+}
+
+void PushDataProducer::closePush() {
+  std::scoped_lock lk(m);
+  closed = true;
+  cv.notify_all();
+}
+
+} // namespace nntrainer
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   push_data_producer.h
+ * @date   19 October 2026
+ * @brief  This file contains a data producer which is pushed samples to
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#ifndef __PUSH_DATA_PRODUCER_H__
+#define __PUSH_DATA_PRODUCER_H__
+
+#include <data_producer.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nntrainer {
+
+class PropsBackpressure;
+class PropsEpochSamples;
+class PropsEpochDuration;
+
+/**
+ * @brief PushDataProducer which is fed by push() from any thread. The pushed
+ * samples are written directly to the iteration queue of the running epoch.
+ *
+ * An epoch ends when "epoch_samples" samples have been pushed or when
+ * "epoch_duration" milliseconds have passed with at least one sample pushed,
+ * whichever comes first. If neither is set, the epoch lasts until closePush().
+ * When there is no room for a sample, either because the queue is full or no
+ * epoch is running, push() waits if "backpressure=block" and drops the sample
+ * if "backpressure=drop".
+ */
+class PushDataProducer final : public DataProducer {
+public:
+  /**
+   * @brief backpressure policy when a sample cannot be written right away
+   *
+   */
+  enum class Backpressure {
+    BLOCK, /**< wait until there is room for the sample */
+    DROP   /**< drop the sample */
+  };
+
+  /**
+   * @brief Construct a new Push Data Producer object
+   *
+   */
+  PushDataProducer();
+
+  /**
+   * @brief Destroy the Push Data Producer object
+   *
+   */
+  ~PushDataProducer();
+
+  inline static const std::string type = "push";
+
+  /**
+   * @copydoc DataProducer::getType()
+   */
+  const std::string getType() const override;
+
+  /**
+   * @copydoc DataProducer::setProeprty(const std::vector<std::string>
+   * &properties)
+   */
+  void setProperty(const std::vector<std::string> &properties) override;
+
+  /**
+   * @copydoc DataProducer::finalize(const std::vector<TensorDim>, const
+   * std::vector<TensorDim>, void* user_data)
+   * @note the returned generator is empty, samples are given by fill()
+   */
+  DataProducer::Generator finalize(const std::vector<TensorDim> &input_dims,
+                                   const std::vector<TensorDim> &label_dims,
+                                   void *user_data = nullptr) override;
+
+  /**
+   * @copydoc DataProducer::fill(IterationQueue &iq)
+   */
+  bool fill(IterationQueue &iq) override;
+
+  /**
+   * @copydoc DataProducer::push(const std::vector<const float *> &inputs,
+   * const std::vector<const float *> &labels)
+   */
+  bool push(const std::vector<const float *> &inputs,
+            const std::vector<const float *> &labels) override;
+
+  /**
+   * @copydoc DataProducer::closePush()
+   * @note the running epoch ends, and the following epochs end right away
+   */
+  void closePush() override;
+
+private:
+  using Props =
+    std::tuple<PropsBackpressure, PropsEpochSamples, PropsEpochDuration>;
+  std::unique_ptr<Props> push_props;
+
+  std::vector<size_t> input_lens; /**< number of elements of each input */
+  std::vector<size_t> label_lens; /**< number of elements of each label */
+
+  std::mutex m;
+  std::condition_variable cv;
+  IterationQueue *iq; /**< queue of the running epoch, nullptr if none */
+  unsigned int count; /**< number of samples pushed in the running epoch */
+  bool closed;
+};
+
+} // namespace nntrainer
+
+#endif // __PUSH_DATA_PRODUCER_H__
@@ -213,45 +213,51 @@ int NetworkGraph::checkCompiledGraph() {
   return ML_ERROR_NONE;
 }
 
-void NetworkGraph::markNodesForBackwarding() {
-  /** accumulate all the nodes which must support backwarding */
-  std::unordered_set<std::string> must_support_backwarding;
+void NetworkGraph::markNodesToLoss() {
+  nodes_to_loss.clear();
+
+  /** a node leads to a loss if it computes one or if any consumer does */
+  for (auto iter = crbegin(); iter != crend(); iter++) {
+    auto const &lnode = *iter;
+    bool to_loss = lnode->requireLabel();
+    for (auto i = 0u, num_node = lnode->getNumOutputConnections();
+         i < num_node && !to_loss; ++i) {
+      auto conn = lnode->getOutputConnection(i);
+      to_loss = conn && nodes_to_loss.count(conn->getName());
+    }
 
-  /**
-   * if a node is trainable, then all the nodes ahead of it must support
-   * backwarding operation
-   */
-  for (auto iter = cbegin(); iter != cend(); iter++) {
-    auto lnode = (*iter);
-    if (lnode->getTrainable() ||
-        must_support_backwarding.find(lnode->getName()) !=
-          must_support_backwarding.end()) {
-      if (lnode->getTrainable()) {
-        lnode->needsCalcGradient(true);
-      }
-#ifdef ENABLE_TEST
-      if (lnode->supportBackwarding() && !optimize_memory) {
-        lnode->needsCalcDerivative(true);
-      }
-#endif
+    if (to_loss)
+      nodes_to_loss.insert(lnode->getName());
+  }
+}
 
-      for (auto i = 0u, num_node = lnode->getNumOutputConnections();
-           i < num_node; ++i) {
-        auto conn = lnode->getOutputConnection(i);
-        if (!conn) {
-          continue;
-        }
+void NetworkGraph::markNodeForBackwarding(LayerNode &lnode, bool has_weights) {
+  /** the nodes which do not lead to a loss get no derivative to backward */
+  if (!nodes_to_loss.count(lnode.getName()))
+    return;
 
-        must_support_backwarding.insert(conn->getName());
-      }
-    }
-  }
+  /** a layer without weights is treated as a non-trainable layer */
+  if (lnode.getTrainable() && has_weights)
+    lnode.needsCalcGradient(true);
 
-  /** mark all the required nodes support backwarding */
-  for (auto const &node_name : must_support_backwarding) {
-    auto ln = LNODE(graph.getNode(node_name)).get();
-    ln->needsCalcDerivative(true);
+  /**
+   * if a node before this one is backwarded, this node must pass the
+   * derivative back to it
+   */
+  bool after_backwarded = false;
+  for (auto i = 0u; i < lnode.getNumInputConnections(); ++i) {
+    auto producer = getLayerNode(lnode.getInputConnectionName(i));
+    after_backwarded = after_backwarded || producer->needsCalcGradient() ||
+                       producer->needsCalcDerivative();
   }
+
+  if (after_backwarded)
+    lnode.needsCalcDerivative(true);
+#ifdef ENABLE_TEST
+  else if (lnode.needsCalcGradient() && lnode.supportBackwarding() &&
+           !optimize_memory)
+    lnode.needsCalcDerivative(true);
+#endif
 }
 
 void NetworkGraph::setBatchSize(unsigned int batch_size) {
@@ -259,8 +265,10 @@ void NetworkGraph::setBatchSize(unsigned int batch_size) {
     return;
 
   this->batch_size = batch_size;
-  if (!input_list.empty() && getInputDimension()[0].batch() == batch_size)
+  if (!input_list.empty() && getInputDimension()[0].batch() == batch_size) {
+    run_batch_size = batch_size;
     return;
+  }
 
   auto allocated = tensor_manager->isAllocated();
 
@@ -298,6 +306,27 @@ void NetworkGraph::setBatchSize(unsigned int batch_size) {
     input_dims[idx] = tensor_manager->getTensor(input_list[idx])->getDim();
   for (unsigned int idx = 0; idx < label_list.size(); idx++)
     label_dims[idx] = tensor_manager->getTensor(label_list[idx])->getDim();
+
+  run_batch_size = batch_size;
+}
+
+void NetworkGraph::setRunBatchSize(unsigned int batch) {
+  NNTR_THROW_IF(batch == 0 || batch > batch_size, std::invalid_argument)
+    << "run batch size must be in (0, " << batch_size << "], given: " << batch;
+  NNTR_THROW_IF(!tensor_manager->isAllocated(), std::runtime_error)
+    << "tensors must be allocated to set the run batch size";
+
+  if (batch != run_batch_size)
+    updateRunBatchSize(batch);
+}
+
+void NetworkGraph::updateRunBatchSize(unsigned int batch) {
+  for (auto iter = cbegin(); iter != cend(); iter++) {
+    if ((*iter)->isFinalized())
+      (*iter)->setBatch(batch);
+  }
+  tensor_manager->setBatchSize(batch);
+  run_batch_size = batch;
 }
 
 void NetworkGraph::applyGradients(
@@ -330,10 +359,21 @@ void NetworkGraph::applyGradients(
 }
 
 sharedConstTensors NetworkGraph::forwarding(bool training) const {
+  std::function<void(std::shared_ptr<LayerNode>, bool)> forwarding_op =
+    [](std::shared_ptr<LayerNode> node, bool training) -> void {
+    node->forwarding(training);
+  };
+
+  return forwarding(training, forwarding_op);
+}
+
+sharedConstTensors NetworkGraph::forwarding(
+  bool training,
+  std::function<void(std::shared_ptr<LayerNode>, bool)> &forwarding_op) const {
   for (auto iter = cbegin(); iter != cend(); iter++) {
     auto const &ln = *iter;
     START_PROFILE(profile_keys.at(ln->getType()));
-    ln->forwarding(training);
+    forwarding_op(ln, training);
     END_PROFILE(profile_keys.at(ln->getType()));
   }
 
@@ -440,6 +480,9 @@ LayerNode *NetworkGraph::computeBackwardEnd() {
  */
 void NetworkGraph::allocateTensors(ExecutionMode exec_mode_) {
   exec_mode = exec_mode_;
+  if (!tensor_manager->isAllocated())
+    zeroCopyOptimize();
+
   if (exec_mode == ExecutionMode::INFERENCE)
     /**
      * get the order of execution/usage order for the forwarding of the last
@@ -548,10 +591,15 @@ NetworkGraph::canExecuteInPlace(const std::shared_ptr<LayerNode> &lnode) {
 
   /**
    * layers whose backwarding is not dependent on input/output but only its
-   * derivatives and weights, if any - batch normalization
+   * derivatives and weights, if any - batch normalization, and activation
+   * keeping the derivative mask
    */
   auto io_independent_backwarding =
     [](const std::shared_ptr<LayerNode> &lnode) {
+      if (lnode->getType() == ActivationLayer::type) {
+        auto act = dynamic_cast<const ActivationLayer *>(lnode->getLayer());
+        return act != nullptr && act->usesDerivativeMask();
+      }
       return lnode->getType() == BatchNormalizationLayer::type;
     };
 
@@ -647,6 +695,110 @@ void NetworkGraph::inPlaceOptimize() {
   }
 }
 
+/**
+ * @brief get the elementwise offsets of @a parts inside @a whole, if every part
+ * is a contiguous block of @a whole and they are laid out in order
+ *
+ * @param whole dimension of the joined tensor
+ * @param parts dimensions of the parts
+ * @param[out] offsets offsets of the parts
+ * @retval true if the parts are contiguous blocks of @a whole
+ */
+static bool getContiguousOffsets(const TensorDim &whole,
+                                 const std::vector<TensorDim> &parts,
+                                 std::vector<unsigned int> &offsets) {
+  offsets.clear();
+  unsigned int offset = 0;
+  for (auto &part : parts) {
+    /** every dimension before the joined axis must be 1 */
+    unsigned int leading = 1;
+    for (unsigned int i = 0; i < TensorDim::MAXDIM; ++i) {
+      if (part.getTensorDim(i) != whole.getTensorDim(i)) {
+        if (leading != 1)
+          return false;
+        break;
+      }
+      leading *= whole.getTensorDim(i);
+    }
+
+    offsets.push_back(offset);
+    offset += part.getDataLen();
+  }
+
+  return offset == whole.getDataLen();
+}
+
+void NetworkGraph::zeroCopyOptimize() {
+  tensor_manager->clearMergedTensors();
+  if (!optimize_memory)
+    return;
+
+  /**
+   * a consumer modifying its input in place would also modify the other side
+   * of the placement, and an output without consumer is never written. No-op
+   * in-place layers pass their input through, so their consumers are checked.
+   */
+  std::function<bool(const std::shared_ptr<LayerNode> &)> has_safe_consumers =
+    [this, &has_safe_consumers](const std::shared_ptr<LayerNode> &lnode) {
+      auto consumers = lnode->getOutputConnections();
+      if (consumers.size() != lnode->getNumOutputs())
+        return false;
+      return std::all_of(
+        consumers.begin(), consumers.end(),
+        [this, &has_safe_consumers](const std::string &name) {
+          auto consumer = getLayerNode(name);
+          if (consumer->executeInPlace() == InPlace::NONE)
+            return true;
+          return (consumer->getType() == FlattenLayer::type ||
+                  consumer->getType() == MultiOutLayer::type) &&
+                 has_safe_consumers(consumer);
+        });
+    };
+
+  std::vector<unsigned int> offsets;
+  for (auto iter = cbegin(); iter != cend(); iter++) {
+    auto const &lnode = *iter;
+    bool is_concat = lnode->getType() == ConcatLayer::type;
+    bool is_split = lnode->getType() == SplitLayer::type;
+    if ((!is_concat && !is_split) || !has_safe_consumers(lnode))
+      continue;
+
+    auto &rc = lnode->getRunContext();
+    /** concat places its inputs in its output, split the other way round */
+    unsigned int num_parts = is_concat ? rc.getNumInputs() : rc.getNumOutputs();
+    auto whole = [&rc, is_concat](bool grad) -> const Tensor & {
+      if (is_concat)
+        return grad ? rc.getOutputGradUnsafe(0) : rc.getOutput(0);
+      return grad ? rc.getInputGrad(0) : rc.getInput(0);
+    };
+    auto part = [&rc, is_concat](unsigned int idx, bool grad) -> Tensor & {
+      if (is_concat)
+        return grad ? rc.getInputGrad(idx) : rc.getInput(idx);
+      return grad ? rc.getOutputGradUnsafe(idx) : rc.getOutput(idx);
+    };
+    bool has_grad =
+      is_concat ? rc.outputHasGradient(0) : rc.inputHasGradient(0);
+    for (unsigned int i = 0; i < num_parts; ++i)
+      has_grad = has_grad && (is_concat ? rc.inputHasGradient(i)
+                                        : rc.outputHasGradient(i));
+
+    std::vector<TensorDim> part_dims;
+    for (unsigned int i = 0; i < num_parts; ++i)
+      part_dims.push_back(part(i, false).getDim());
+    if (!getContiguousOffsets(whole(false).getDim(), part_dims, offsets))
+      continue;
+
+    /** the layer copies the parts which could not be placed */
+    for (unsigned int i = 0; i < num_parts; ++i) {
+      tensor_manager->mergeTensors(part(i, false).getName(),
+                                   whole(false).getName(), offsets[i]);
+      if (has_grad)
+        tensor_manager->mergeTensors(part(i, true).getName(),
+                                     whole(true).getName(), offsets[i]);
+    }
+  }
+}
+
 /**
  * @brief Set the Inplace Shared Memory Config By Layer object
  *
@@ -657,10 +809,14 @@ void NetworkGraph::inPlaceOptimize() {
 static void
 setInplaceSharedMemoryConfigByLayer(const std::shared_ptr<LayerNode> &lnode,
                                     bool &shared_var, bool &shared_grad) {
-  /** for multiout layer, variables are shared but gradients are not */
+  /**
+   * for multiout layer, variables are shared but gradients are summed, so only
+   * the gradient of the first output is shared to be summed into in place.
+   * This is decided in finalizeContext() as it depends on the backwarding.
+   */
   if (lnode->getType() == MultiOutLayer::type) {
     shared_var = true;
-    shared_grad = false;
+    shared_grad = true;
   } else {
     shared_var = true;
     shared_grad = true;
@@ -675,6 +831,24 @@ setInplaceSharedMemoryConfigByLayer(const std::shared_ptr<LayerNode> &lnode,
    */
 }
 
+/**
+ * @brief Trim the lifespan of a tensor to the backwarding steps a node runs
+ *
+ * @param ls lifespan requested
+ * @param steps calc gradient and calc derivative lifespans of the steps run
+ * @return TensorLifespan the lifespan without the steps which are not run
+ */
+static TensorLifespan trimLifespan(TensorLifespan ls, TensorLifespan steps) {
+  if (ls == TensorLifespan::EPOCH_LIFESPAN ||
+      ls == TensorLifespan::MAX_LIFESPAN)
+    return ls;
+
+  return static_cast<TensorLifespan>(
+    static_cast<unsigned int>(ls) &
+    (static_cast<unsigned int>(steps) |
+     static_cast<unsigned int>(TensorLifespan::FORWARD_FUNC_LIFESPAN)));
+}
+
 std::vector<Var_Grad *>
 NetworkGraph::finalizeContext(const std::shared_ptr<LayerNode> &lnode,
                               const std::vector<Var_Grad *> &prev_inputs) {
@@ -688,6 +862,22 @@ NetworkGraph::finalizeContext(const std::shared_ptr<LayerNode> &lnode,
   /** finalize the layer and get the final context */
   auto init_context = lnode->finalize(input_dims);
 
+  /**
+   * the tensors are only kept for the backwarding steps the node runs. The
+   * derivatives and gradients of the others are not allocated.
+   */
+  markNodeForBackwarding(*lnode, !init_context.getWeightsSpec().empty());
+  TensorLifespan steps = TensorLifespan::UNMANAGED;
+  if (lnode->needsCalcGradient())
+    steps = enum_class_or(steps, TensorLifespan::CALC_GRAD_LIFESPAN);
+  if (lnode->needsCalcDerivative())
+    steps = enum_class_or(steps, TensorLifespan::CALC_DERIV_LIFESPAN);
+#ifdef ENABLE_TEST
+  /// the derivatives are kept for the tests to verify them
+  if (nodes_to_loss.count(lnode->getName()) && !optimize_memory)
+    steps = enum_class_or(steps, TensorLifespan::CALC_DERIV_LIFESPAN);
+#endif
+
   /**
    * Request manager for either a pre-allocated output as input or a newly
    * allocated input. This is neccesary for manager to know when this input
@@ -699,7 +889,7 @@ NetworkGraph::finalizeContext(const std::shared_ptr<LayerNode> &lnode,
                  std::back_inserter(input_names),
                  [](auto const &vg) { return vg->getName(); });
   const std::vector<Var_Grad *> &inputs = tensor_manager->requestInputs(
-    gnode, init_context.getInputDimensions(), input_names);
+    gnode, init_context.getInputDimensions(), input_names, steps);
 
   /** In-Place optimizations */
   /**
@@ -708,6 +898,19 @@ NetworkGraph::finalizeContext(const std::shared_ptr<LayerNode> &lnode,
    * node is going to be used with in-place optimizations.
    */
   auto out_specs = init_context.getOutSpecs();
+  for (unsigned int i = 0; i < out_specs.size(); ++i) {
+    auto &s = out_specs.at(i);
+    s.variable_spec.ls = trimLifespan(s.variable_spec.ls, steps);
+    if (!s.gradient_spec || i >= lnode->getNumOutputConnections())
+      continue;
+
+    /// the derivative is never given if the consumer does not lead to a loss
+    auto conn = lnode->getOutputConnection(i);
+    bool to_loss = conn && nodes_to_loss.count(conn->getName());
+    s.gradient_spec->ls = trimLifespan(
+      s.gradient_spec->ls, to_loss ? steps : TensorLifespan::UNMANAGED);
+  }
+
   /// @note try move inplace control to finalize
   bool shared_var = false, shared_grad = false;
   if (lnode->executeInPlace() != InPlace::NONE) {
@@ -719,7 +922,14 @@ NetworkGraph::finalizeContext(const std::shared_ptr<LayerNode> &lnode,
           TensorSpecV2::RequestType::READ_ONLY_VIEW;
         s.variable_spec.reference_name = inputs[0]->getName();
       }
-      if (shared_grad && s.gradient_spec) {
+      /**
+       * multiout sums the other derivatives into its input derivative, which
+       * is only managed when the node calculates its derivative
+       */
+      bool share_multiout_grad = i == 0 && lnode->needsCalcDerivative();
+      if (shared_grad && s.gradient_spec &&
+          s.gradient_spec->ls != TensorLifespan::UNMANAGED &&
+          (lnode->getType() != MultiOutLayer::type || share_multiout_grad)) {
         s.gradient_spec->request_type =
           TensorSpecV2::RequestType::READ_ONLY_VIEW;
         s.gradient_spec->reference_name = inputs[0]->getGradientName();
@@ -752,6 +962,10 @@ NetworkGraph::finalizeContext(const std::shared_ptr<LayerNode> &lnode,
     out_specs, Manager::TensorGroupType::OUTPUT, lnode->getExecutionOrder(),
     lnode->getName());
 
+  auto tensor_specs = init_context.getTensorsSpec();
+  for (auto &spec : tensor_specs)
+    std::get<4>(spec) = trimLifespan(std::get<4>(spec), steps);
+
   /** create shared weight names if requested */
   std::vector<std::string> shared_weight_names;
   std::vector<std::string> shared_tensor_names;
@@ -792,17 +1006,16 @@ NetworkGraph::finalizeContext(const std::shared_ptr<LayerNode> &lnode,
 
     const auto &w_specs = init_context.getWeightsSpec();
     for (auto i = 0u; i < w_specs.size(); ++i) {
-      shared_weight_names.emplace_back(std::get<7>(w_specs.at(i)));
+      shared_weight_names.emplace_back(std::get<8>(w_specs.at(i)));
     }
   }
 
   lnode->configureRunContext(
-    // TODO: update weights spec for trainable based on layer trainable prop
     tensor_manager->requestWeights(gnode, init_context.getWeightsSpec(),
-                                   lnode->getTrainable(), shared_weight_names),
+                                   lnode->needsCalcGradient(),
+                                   shared_weight_names),
     inputs, outputs,
-    tensor_manager->requestTensors(gnode, init_context.getTensorsSpec(),
-                                   shared_tensor_names));
+    tensor_manager->requestTensors(gnode, tensor_specs, shared_tensor_names));
 
   return outputs;
 }
@@ -821,6 +1034,8 @@ int NetworkGraph::initialize(const std::vector<Connection> &model_input_names,
     return node->getInputConnections().empty();
   };
 
+  markNodesToLoss();
+
   for (unsigned int idx = 0; idx < graph.size(); ++idx) {
     std::vector<Var_Grad *> inputs = {};
     auto const &lnode = getSortedLayerNode(idx);
@@ -989,9 +1204,8 @@ int NetworkGraph::initialize(const std::vector<Connection> &model_input_names,
   identify_external_tensors(model_label_names, is_label_node,
                             identify_as_model_label);
 
-  /** mark the nodes which will be backwarded during the graph operation */
+  /** the nodes to backward are marked while finalizing them */
   try {
-    markNodesForBackwarding();
     backward_iter_end = computeBackwardEnd();
   } catch (std::exception &e) {
     ml_loge(
@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <stack>
+#include <unordered_set>
 #include <vector>
 
 #include <execution_mode.h>
@@ -44,6 +45,7 @@ public:
     graph(),
     compiled(false),
     batch_size(0),
+    run_batch_size(0),
     graph_exec_end(0),
     backward_iter_end(nullptr),
     forward_iter_end(nullptr),
@@ -136,6 +138,15 @@ public:
    */
   void setBatchSize(unsigned int batch_size);
 
+  /**
+   * @brief     set the batch to run on the allocated tensors, which views the
+   * leading samples of the planned memory without reallocation
+   * @param[in] batch batch to run, the batch size restores the full batch
+   * @throw     std::invalid_argument if @a batch is 0 or over the batch size
+   * @throw     std::runtime_error if the tensors are not allocated
+   */
+  void setRunBatchSize(unsigned int batch);
+
   /**
    * @brief try apply gradient if possible
    * @note if it is not the last of the gradient access, this is noop
@@ -154,6 +165,16 @@ public:
    */
   sharedConstTensors forwarding(bool training = false) const;
 
+  /**
+   * @brief     forwarding network graph
+   * @param[in] training true if forwarding is on training
+   * @param[in] forwarding_op operation for the forwarding of each node
+   * @retval output tensors
+   */
+  sharedConstTensors forwarding(
+    bool training,
+    std::function<void(std::shared_ptr<LayerNode>, bool)> &forwarding_op) const;
+
   /**
    * @brief     backwarding the network graph
    * @param[in] iteration current iteration number
@@ -232,6 +253,13 @@ public:
    */
   unsigned int getBatchSize() const;
 
+  /**
+   * @brief check if the tensors of the graph are allocated
+   *
+   * @retval true if the tensors are allocated
+   */
+  bool isAllocated() const { return tensor_manager->isAllocated(); }
+
   /**
    * @brief     Copy the graph
    * @param[in] from Graph Object to copy
@@ -278,6 +306,9 @@ public:
    */
   void deallocateTensors(bool dealloc_weights = false) {
     tensor_manager->deallocateTensors(dealloc_weights);
+    /** the next allocation must be planned for the full batch */
+    if (run_batch_size != batch_size)
+      updateRunBatchSize(batch_size);
   }
 
   /**
@@ -346,6 +377,7 @@ private:
   GraphCore graph;             /** core graph object */
   bool compiled;               /**< if the model graph is compiled */
   unsigned int batch_size;     /**< current batch_size */
+  unsigned int run_batch_size; /**< batch viewed by the allocated tensors */
   unsigned int graph_exec_end; /**< Inclusive, last execution order of the
                                   given graph */
   LayerNode
@@ -371,6 +403,8 @@ private:
     profile_keys; /**< profile keys based on the layer type */
   std::vector<Weight *>
     clip_weights; /**< weights with global norm based clipping enabled */
+  std::unordered_set<std::string>
+    nodes_to_loss; /**< nodes which a loss is computed from */
 
   /**
    * @brief     topological sort
@@ -396,9 +430,21 @@ private:
   int checkCompiledGraph();
 
   /**
-   * @brief     mark nodes required for backwarding.
+   * @brief     mark the nodes which a loss is computed from. The other nodes
+   * are never backwarded.
+   */
+  void markNodesToLoss();
+
+  /**
+   * @brief     mark if the node runs calcGradient and calcDerivative, given
+   * the trainable nodes before it
+   *
+   * @param lnode node to mark, its inputs must already be marked
+   * @param has_weights true if the layer of the node requested weights
+   * @throw std::invalid_argument if the derivative is needed but the layer
+   * does not support backwarding
    */
-  void markNodesForBackwarding();
+  void markNodeForBackwarding(LayerNode &lnode, bool has_weights);
 
   /**
    * @brief     adding loss layer at last position
@@ -458,11 +504,28 @@ private:
   void setExternalTensors(const std::vector<Tensor> &data,
                           const std::vector<std::string> names);
 
+  /**
+   * @brief     update the batch of the tensors of the nodes and of the
+   * inputs/outputs, allocated tensors are viewed in place
+   * @param[in] batch batch to update to
+   */
+  void updateRunBatchSize(unsigned int batch);
+
   /**
    * @brief     Optimize the graph memory utilization for in-place operations
    */
   void inPlaceOptimize();
 
+  /**
+   * @brief     Place the inputs of concat layers in their output and the
+   * outputs of split layers in their input, where the layout for the current
+   * dimension allows, so that they do not need to be copied
+   *
+   * @note the placement is decided again for every allocation as it depends
+   * on the batch size
+   */
+  void zeroCopyOptimize();
+
   /**
    * @brief     Check if the given node can execute in-place
    *
@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <iostream>
@@ -292,6 +294,162 @@ float ActiFunc::leakyReluPrime(float x) {
   return x >= 0.0f ? 1.0f : NEGATIVE_SLOPE;
 }
 
+/**
+ * @brief number of elements from which the mask is stored and read in
+ * parallel
+ */
+static constexpr unsigned int mask_parallel_threshold = 1u << 16;
+
+/**
+ * @brief convert to half precision, rounding to the nearest even
+ *
+ * @param value value to convert
+ * @return uint16_t bits of the half precision value
+ */
+static uint16_t toHalf(float value) {
+  uint32_t x;
+  std::memcpy(&x, &value, sizeof(x));
+
+  uint16_t sign = (x >> 16) & 0x8000;
+  int exp = static_cast<int>((x >> 23) & 0xff) - 127 + 15;
+  uint32_t mant = x & 0x7fffff;
+
+  if (exp >= 31)
+    return sign | 0x7c00;
+
+  unsigned int shift = 13;
+  if (exp <= 0) {
+    /// subnormal, the implicit bit is shifted into the mantissa
+    if (exp < -10)
+      return sign;
+    mant |= 0x800000;
+    shift = 14 - exp;
+    exp = 0;
+  }
+
+  uint32_t half = (static_cast<uint32_t>(exp) << 10) | (mant >> shift);
+  uint32_t rem = mant & ((1u << shift) - 1);
+  uint32_t mid = 1u << (shift - 1);
+  if (rem > mid || (rem == mid && (half & 1)))
+    ++half;
+  return sign | static_cast<uint16_t>(half);
+}
+
+/**
+ * @brief convert from half precision
+ *
+ * @param half bits of the half precision value
+ * @return float value
+ */
+static float fromHalf(uint16_t half) {
+  uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+  uint32_t exp = (half >> 10) & 0x1f;
+  uint32_t mant = half & 0x3ff;
+
+  if (exp == 0) {
+    float value = mant * (1.0f / (1 << 24));
+    return sign ? -value : value;
+  }
+
+  uint32_t x = sign | (mant << 13) |
+               (exp == 31 ? 0x7f800000 : (exp + 127 - 15) << 23);
+  float value;
+  std::memcpy(&value, &x, sizeof(value));
+  return value;
+}
+
+bool ActiFunc::supportDerivativeMask(ActivationType acti_type) {
+  return acti_type == ActivationType::ACT_RELU ||
+         acti_type == ActivationType::ACT_LEAKY_RELU ||
+         acti_type == ActivationType::ACT_SIGMOID ||
+         acti_type == ActivationType::ACT_TANH;
+}
+
+unsigned int ActiFunc::getDerivativeMaskLength(ActivationType acti_type,
+                                               unsigned int len) {
+  NNTR_THROW_IF(!supportDerivativeMask(acti_type), std::invalid_argument)
+    << "derivative mask is not supported for the activation";
+
+  if (acti_type == ActivationType::ACT_RELU ||
+      acti_type == ActivationType::ACT_LEAKY_RELU)
+    return (len + 31) / 32;
+  return (len + 1) / 2;
+}
+
+void ActiFunc::run_mask_fn(Tensor const &output, Tensor &mask) const {
+  const unsigned int batch = output.batch();
+  const unsigned int len = output.getDim().getFeatureLen();
+  const unsigned int mask_len = mask.getDim().getFeatureLen();
+  const float *out = output.getData();
+
+  if (activation_type == ActivationType::ACT_RELU ||
+      activation_type == ActivationType::ACT_LEAKY_RELU) {
+    auto prime = activation_type == ActivationType::ACT_RELU ? reluPrime
+                                                             : leakyReluPrime;
+    uint32_t *bits = reinterpret_cast<uint32_t *>(mask.getData());
+    const unsigned int words = batch * mask_len;
+
+#pragma omp parallel for if (batch * len >= mask_parallel_threshold)
+    for (unsigned int w = 0; w < words; ++w) {
+      unsigned int begin = w % mask_len * 32;
+      unsigned int end = std::min(begin + 32, len);
+      const float *o = out + w / mask_len * len;
+
+      uint32_t word = 0;
+      for (unsigned int i = begin; i < end; ++i)
+        word |= static_cast<uint32_t>(prime(o[i]) == 1.0f) << (i - begin);
+      bits[w] = word;
+    }
+    return;
+  }
+
+  auto prime = activation_type == ActivationType::ACT_SIGMOID ? sigmoidPrime
+                                                              : tanhPrime;
+  uint16_t *halves = reinterpret_cast<uint16_t *>(mask.getData());
+  const unsigned int size = batch * len;
+
+#pragma omp parallel for if (size >= mask_parallel_threshold)
+  for (unsigned int e = 0; e < size; ++e)
+    halves[e / len * mask_len * 2 + e % len] = toHalf(prime(out[e]));
+}
+
+Tensor &ActiFunc::run_mask_prime_fn(Tensor const &mask, Tensor &ret,
+                                    Tensor const &deriv) const {
+  NNTR_THROW_IF(deriv.getStrides() != deriv.getDim().computeStrides() ||
+                  ret.getStrides() != ret.getDim().computeStrides(),
+                std::invalid_argument)
+    << "derivative mask requires contiguous derivatives";
+
+  const unsigned int len = ret.getDim().getFeatureLen();
+  const unsigned int mask_len = mask.getDim().getFeatureLen();
+  const unsigned int size = ret.size();
+  const float *d = deriv.getData();
+  float *r = ret.getData();
+
+  if (activation_type == ActivationType::ACT_RELU ||
+      activation_type == ActivationType::ACT_LEAKY_RELU) {
+    const float low =
+      activation_type == ActivationType::ACT_RELU ? 0.0f : NEGATIVE_SLOPE;
+    const uint32_t *bits = reinterpret_cast<const uint32_t *>(mask.getData());
+
+#pragma omp parallel for if (size >= mask_parallel_threshold)
+    for (unsigned int e = 0; e < size; ++e) {
+      unsigned int i = e % len;
+      bool set = (bits[e / len * mask_len + i / 32] >> (i % 32)) & 1u;
+      r[e] = set ? d[e] : d[e] * low;
+    }
+    return ret;
+  }
+
+  const uint16_t *halves =
+    reinterpret_cast<const uint16_t *>(mask.getData());
+
+#pragma omp parallel for if (size >= mask_parallel_threshold)
+  for (unsigned int e = 0; e < size; ++e)
+    r[e] = d[e] * fromHalf(halves[e / len * mask_len * 2 + e % len]);
+  return ret;
+}
+
 void ActiFunc::executeInPlace(bool val) {
   if (val && !supportInPlace())
     throw std::runtime_error("Error setting activation layer to work in-place");
@@ -64,6 +64,45 @@ public:
    */
   Tensor &run_prime_fn(Tensor &in, Tensor &ret, Tensor const &deriv);
 
+  /**
+   * @brief store the derivative of the activation as a compressed mask,
+   * computed from the output of the activation
+   *
+   * @param[in] output output of the activation
+   * @param[out] mask mask of (batch, 1, 1, getDerivativeMaskLength())
+   */
+  void run_mask_fn(Tensor const &output, Tensor &mask) const;
+
+  /**
+   * @brief run prime function from the mask stored by run_mask_fn
+   *
+   * @param[in] mask : mask
+   * @param[out] ret : output, may share the memory with @a deriv
+   * @param[in] deriv : derivative
+   * @retVal    Tensor
+   */
+  Tensor &run_mask_prime_fn(Tensor const &mask, Tensor &ret,
+                            Tensor const &deriv) const;
+
+  /**
+   * @brief check if the derivative can be kept as a mask, which is a bit per
+   * element for relu and leaky relu, and half precision for sigmoid and tanh
+   *
+   * @param[in] acti_type activation type
+   * @retval true if the mask is supported
+   */
+  static bool supportDerivativeMask(ActivationType acti_type);
+
+  /**
+   * @brief get the number of floats holding the mask of a batch
+   *
+   * @param[in] acti_type activation type
+   * @param[in] len number of elements of a batch
+   * @return unsigned int length of the mask
+   */
+  static unsigned int getDerivativeMaskLength(ActivationType acti_type,
+                                              unsigned int len);
+
   /**
    * @copydoc Layer::supportInPlace()
    */
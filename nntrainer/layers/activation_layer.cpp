@@ -16,6 +16,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <vector>
 
@@ -33,7 +34,8 @@
 namespace nntrainer {
 ActivationLayer::ActivationLayer() :
   Layer(),
-  activation_props(new PropTypes(props::Activation())) {
+  activation_props(new PropTypes(props::Activation(), props::DerivativeMask())),
+  mask_idx(std::numeric_limits<unsigned>::max()) {
   acti_func.setActiFunc(ActivationType::ACT_NONE);
 }
 
@@ -50,13 +52,36 @@ void ActivationLayer::finalize(InitLayerContext &context) {
     << "requires exactly one input, but given: " << context.getNumInputs()
     << ", check graph connection if it is correct";
 
-  /// @todo for only certain types of activation needs lifespan of
-  /// forward_derivative order
+  const TensorDim &in_dim = context.getInputDimensions()[0];
+  NNTR_THROW_IF(usesDerivativeMask() &&
+                  !ActiFunc::supportDerivativeMask(act.get()),
+                std::invalid_argument)
+    << "activation layer, " << context.getName()
+    << " cannot keep the derivative mask of activation: " << to_string(act);
+
+  /**
+   * with the derivative mask, the output is not needed for backwarding and
+   * the planner may reuse it once the next layer is done with it. The mask
+   * takes 1/32 of the output for relu and 1/2 for sigmoid and tanh.
+   *
+   * @todo for only certain types of activation needs lifespan of
+   * forward_derivative order
+   */
   std::vector<VarGradSpecV2> out_specs;
-  out_specs.push_back(
-    InitLayerContext::outSpec(context.getInputDimensions()[0], "out",
-                              TensorLifespan::FORWARD_DERIV_LIFESPAN));
+  out_specs.push_back(InitLayerContext::outSpec(
+    in_dim, "out",
+    usesDerivativeMask() ? TensorLifespan::FORWARD_FUNC_LIFESPAN
+                         : TensorLifespan::FORWARD_DERIV_LIFESPAN));
   context.requestOutputs(std::move(out_specs));
+
+  if (usesDerivativeMask()) {
+    mask_idx = context.requestTensor(
+      TensorDim(in_dim.batch(), 1, 1,
+                ActiFunc::getDerivativeMaskLength(act.get(),
+                                                  in_dim.getFeatureLen())),
+      "derivative_mask", Tensor::Initializer::NONE, false,
+      TensorLifespan::FORWARD_DERIV_LIFESPAN);
+  }
   acti_func.executeInPlace(context.executeInPlace());
 }
 
@@ -64,16 +89,33 @@ void ActivationLayer::forwarding(RunLayerContext &context, bool training) {
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
   acti_func.run_fn(input_, hidden_);
+
+  if (training && usesDerivativeMask())
+    acti_func.run_mask_fn(hidden_, context.getTensor(mask_idx));
 }
 
 void ActivationLayer::calcDerivative(RunLayerContext &context) {
   const Tensor &deriv = context.getIncomingDerivative(SINGLE_INOUT_IDX);
   Tensor &ret = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
-  Tensor &out = context.getOutput(SINGLE_INOUT_IDX);
 
+  if (usesDerivativeMask()) {
+    acti_func.run_mask_prime_fn(context.getTensor(mask_idx), ret, deriv);
+    return;
+  }
+
+  Tensor &out = context.getOutput(SINGLE_INOUT_IDX);
   acti_func.run_prime_fn(out, ret, deriv);
 }
 
+void ActivationLayer::setBatch(RunLayerContext &context, unsigned int batch) {
+  if (usesDerivativeMask())
+    context.updateTensor(mask_idx, batch);
+}
+
+bool ActivationLayer::usesDerivativeMask() const {
+  return std::get<props::DerivativeMask>(*activation_props).get();
+}
+
 void ActivationLayer::exportTo(Exporter &exporter,
                                const ExportMethods &method) const {
   exporter.saveResult(*activation_props, method, this);
@@ -79,12 +79,27 @@ public:
    */
   bool supportInPlace() const override { return acti_func.supportInPlace(); }
 
+  /**
+   * @copydoc Layer::setBatch(RunLayerContext &context, unsigned int batch)
+   */
+  void setBatch(RunLayerContext &context, unsigned int batch) override;
+
+  /**
+   * @brief check if the layer keeps the derivative mask instead of its output
+   * for backwarding, which makes the backwarding independent of the input and
+   * the output
+   *
+   * @retval true if the derivative mask is used
+   */
+  bool usesDerivativeMask() const;
+
   inline static const std::string type = "activation";
 
 private:
-  using PropTypes = std::tuple<props::Activation>;
+  using PropTypes = std::tuple<props::Activation, props::DerivativeMask>;
 
   std::unique_ptr<PropTypes> activation_props; /**< activation props */
+  unsigned int mask_idx; /**< index of the derivative mask */
 
   ActiFunc acti_func; /**< activation function from activation type */
 };
@@ -21,6 +21,10 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include <bn_layer.h>
 #include <layer_context.h>
 #include <lazy_tensor.h>
@@ -33,21 +37,209 @@ namespace nntrainer {
 
 static constexpr size_t SINGLE_INOUT_IDX = 0;
 
-enum BNParams {
-  mu,
-  var,
-  gamma,
-  beta,
-  deviation,
-  invstd,
-  cvar,
-  t_reduced,
-  t_full
+enum BNParams { mu, var, gamma, beta, deviation, invstd };
+
+/**
+ * @brief number of elements from which the kernels below are run in parallel
+ */
+static constexpr unsigned int bn_parallel_threshold = 1u << 15;
+
+/**
+ * @brief rows merged at once when the normalized axis is the innermost one.
+ * This is fixed so that the result does not depend on the number of threads
+ */
+static constexpr unsigned int bn_row_block = 64;
+
+/**
+ * @brief layout of a tensor seen as [outer, channel, inner] where channel is
+ * the normalized axis
+ */
+struct ChannelLayout {
+  unsigned int outer;   /**< product of the dimensions before the axis */
+  unsigned int channel; /**< size of the normalized axis */
+  unsigned int inner;   /**< product of the dimensions after the axis */
 };
 
+/**
+ * @brief get the channel layout of the given dimension
+ */
+static ChannelLayout getChannelLayout(const TensorDim &dim,
+                                      unsigned int axis) {
+  ChannelLayout l = {1, dim.getTensorDim(axis), 1};
+  for (unsigned int i = 0; i < axis; ++i)
+    l.outer *= dim.getTensorDim(i);
+  for (unsigned int i = axis + 1; i < TensorDim::MAXDIM; ++i)
+    l.inner *= dim.getTensorDim(i);
+  return l;
+}
+
+/**
+ * @brief merge moments (count, mean, m2) of a chunk into running moments with
+ * Chan's update of Welford's algorithm
+ */
+static inline void mergeMoments(float &count, float &mean, float &m2,
+                                float chunk_count, float chunk_mean,
+                                float chunk_m2) {
+  float total = count + chunk_count;
+  float delta = chunk_mean - mean;
+  mean += delta * chunk_count / total;
+  m2 += chunk_m2 + delta * delta * count * chunk_count / total;
+  count = total;
+}
+
+/**
+ * @brief compute the mean and the (biased) variance of every channel in a
+ * single sweep over @a x
+ * @note a run of the same channel is reduced while it is in cache and merged
+ * into the channel moments. When the channel is the innermost axis, blocks of
+ * rows are reduced in parallel instead and merged in order.
+ */
+static void channelMoments(const float *x, const ChannelLayout &l, float *mean,
+                           float *var) {
+  const unsigned int len = l.outer * l.channel * l.inner;
+
+  if (l.inner > 1) {
+#pragma omp parallel for if (len >= bn_parallel_threshold)
+    for (unsigned int c = 0; c < l.channel; ++c) {
+      float count = 0.0f, m = 0.0f, m2 = 0.0f;
+      for (unsigned int o = 0; o < l.outer; ++o) {
+        const float *run = x + (o * l.channel + c) * l.inner;
+        float sum = 0.0f;
+        for (unsigned int i = 0; i < l.inner; ++i)
+          sum += run[i];
+        float run_mean = sum / l.inner;
+        float run_m2 = 0.0f;
+        for (unsigned int i = 0; i < l.inner; ++i)
+          run_m2 += (run[i] - run_mean) * (run[i] - run_mean);
+        mergeMoments(count, m, m2, l.inner, run_mean, run_m2);
+      }
+      mean[c] = m;
+      var[c] = m2 / count;
+    }
+    return;
+  }
+
+  const unsigned int blocks = (l.outer + bn_row_block - 1) / bn_row_block;
+  std::vector<float> block_mean(blocks * l.channel, 0.0f);
+  std::vector<float> block_m2(blocks * l.channel, 0.0f);
+
+#pragma omp parallel for if (len >= bn_parallel_threshold)
+  for (unsigned int b = 0; b < blocks; ++b) {
+    const unsigned int begin = b * bn_row_block;
+    const unsigned int end = std::min(begin + bn_row_block, l.outer);
+    float *bm = block_mean.data() + b * l.channel;
+    float *bm2 = block_m2.data() + b * l.channel;
+
+    for (unsigned int o = begin; o < end; ++o) {
+      const float *row = x + o * l.channel;
+      for (unsigned int c = 0; c < l.channel; ++c)
+        bm[c] += row[c];
+    }
+    for (unsigned int c = 0; c < l.channel; ++c)
+      bm[c] /= end - begin;
+    for (unsigned int o = begin; o < end; ++o) {
+      const float *row = x + o * l.channel;
+      for (unsigned int c = 0; c < l.channel; ++c)
+        bm2[c] += (row[c] - bm[c]) * (row[c] - bm[c]);
+    }
+  }
+
+  for (unsigned int c = 0; c < l.channel; ++c) {
+    float count = 0.0f, m = 0.0f, m2 = 0.0f;
+    for (unsigned int b = 0; b < blocks; ++b) {
+      float rows = std::min(bn_row_block, l.outer - b * bn_row_block);
+      mergeMoments(count, m, m2, rows, block_mean[b * l.channel + c],
+                   block_m2[b * l.channel + c]);
+    }
+    mean[c] = m;
+    var[c] = m2 / count;
+  }
+}
+
+/**
+ * @brief compute sum(dy) and sum(dy * deviation) of every channel in a single
+ * sweep over @a dy and @a dev
+ */
+static void channelGradSums(const float *dy, const float *dev,
+                            const ChannelLayout &l, float *sum_dy,
+                            float *sum_dy_dev) {
+  const unsigned int len = l.outer * l.channel * l.inner;
+
+  if (l.inner > 1) {
+#pragma omp parallel for if (len >= bn_parallel_threshold)
+    for (unsigned int c = 0; c < l.channel; ++c) {
+      float s = 0.0f, sd = 0.0f;
+      for (unsigned int o = 0; o < l.outer; ++o) {
+        const unsigned int offset = (o * l.channel + c) * l.inner;
+        float run_s = 0.0f, run_sd = 0.0f;
+        for (unsigned int i = 0; i < l.inner; ++i) {
+          run_s += dy[offset + i];
+          run_sd += dy[offset + i] * dev[offset + i];
+        }
+        s += run_s;
+        sd += run_sd;
+      }
+      sum_dy[c] = s;
+      sum_dy_dev[c] = sd;
+    }
+    return;
+  }
+
+  const unsigned int blocks = (l.outer + bn_row_block - 1) / bn_row_block;
+  std::vector<float> block_s(blocks * l.channel, 0.0f);
+  std::vector<float> block_sd(blocks * l.channel, 0.0f);
+
+#pragma omp parallel for if (len >= bn_parallel_threshold)
+  for (unsigned int b = 0; b < blocks; ++b) {
+    const unsigned int end = std::min((b + 1) * bn_row_block, l.outer);
+    float *bs = block_s.data() + b * l.channel;
+    float *bsd = block_sd.data() + b * l.channel;
+    for (unsigned int o = b * bn_row_block; o < end; ++o) {
+      const float *dy_row = dy + o * l.channel;
+      const float *dev_row = dev + o * l.channel;
+      for (unsigned int c = 0; c < l.channel; ++c) {
+        bs[c] += dy_row[c];
+        bsd[c] += dy_row[c] * dev_row[c];
+      }
+    }
+  }
+
+  std::fill(sum_dy, sum_dy + l.channel, 0.0f);
+  std::fill(sum_dy_dev, sum_dy_dev + l.channel, 0.0f);
+  for (unsigned int b = 0; b < blocks; ++b) {
+    for (unsigned int c = 0; c < l.channel; ++c) {
+      sum_dy[c] += block_s[b * l.channel + c];
+      sum_dy_dev[c] += block_sd[b * l.channel + c];
+    }
+  }
+}
+
+/**
+ * @brief call op(c, begin, end) for every run [begin, end) of channel c, where
+ * runs are split over the threads
+ */
+template <typename T>
+static void forEachChannelRun(const ChannelLayout &l, T op) {
+  const unsigned int len = l.outer * l.channel * l.inner;
+  const unsigned int runs = l.outer * l.channel;
+
+  if (l.inner > 1) {
+#pragma omp parallel for if (len >= bn_parallel_threshold)
+    for (unsigned int r = 0; r < runs; ++r)
+      op(r % l.channel, r * l.inner, (r + 1) * l.inner);
+    return;
+  }
+
+  /// the channel is innermost, so visit a whole row for each channel index
+#pragma omp parallel for if (len >= bn_parallel_threshold)
+  for (unsigned int o = 0; o < l.outer; ++o)
+    for (unsigned int c = 0; c < l.channel; ++c)
+      op(c, o * l.channel + c, o * l.channel + c + 1);
+}
+
 BatchNormalizationLayer::BatchNormalizationLayer() :
   Layer(),
-  divider(0),
+  axis(0),
   bn_props(props::Epsilon(), props::BNPARAMS_MU_INIT(),
            props::BNPARAMS_VAR_INIT(), props::BNPARAMS_BETA_INIT(),
            props::BNPARAMS_GAMMA_INIT(), props::Momentum(), props::Axis(),
@@ -79,29 +271,13 @@ void BatchNormalizationLayer::finalize(InitLayerContext &context) {
 
   /// @note this logic cannot tell channel is actually 1 or it is just not used.
   auto &axis_prop = std::get<props::Axis>(bn_props);
-  unsigned int axis;
   if (axis_prop.empty())
     axis = in_dim.channel() > 1 ? 1 : 3;
   else
     axis = axis_prop.get();
 
-  /**
-   * @todo This can be speedup by employing transpose for convolution. With
-   * transpose, the channel dimension can be made last, and the remaining
-   * dimensions can be squeezed. This would allow the sum and average to be
-   * faster, and no temporary allocations inside them.
-   */
-
   dim.setTensorDim(axis, in_dim.getTensorDim(axis));
 
-  divider = 1;
-  for (unsigned int i = 0; i < 4; ++i) {
-    if (axis != i) {
-      axes_to_reduce.push_back(i);
-      divider *= in_dim.getTensorDim(i);
-    }
-  }
-
   wt_idx[BNParams::mu] =
     context.requestWeight(dim, bnparams_mu, WeightRegularizer::NONE, 1.0f, 0.0f,
                           "moving_mean", false);
@@ -127,27 +303,6 @@ void BatchNormalizationLayer::finalize(InitLayerContext &context) {
   wt_idx[BNParams::invstd] =
     context.requestTensor(dim, "invstd", Tensor::Initializer::NONE, false,
                           TensorLifespan::ITERATION_LIFESPAN);
-  /**
-   * Temporary tensor to store the full sized tensors in order to allow batch
-   * norm to execute in-place. Running in-place leads to same memory footprint
-   * for this layer in its backwarding, but reduces the peak memory requirement
-   * as the output of this layer need not be stored all the time.
-   */
-  wt_idx[BNParams::t_full] =
-    context.requestTensor(in_dim, "tensor_full", Tensor::Initializer::NONE,
-                          false, TensorLifespan::CALC_DERIV_LIFESPAN);
-  /**
-   * caches variance + epsilon as well.
-   */
-  wt_idx[BNParams::cvar] =
-    context.requestTensor(dim, "cvar", Tensor::Initializer::NONE, false,
-                          TensorLifespan::ITERATION_LIFESPAN);
-  /**
-   * Temporary tensor to store the reduced tensors along the axes_to_reduce.
-   */
-  wt_idx[BNParams::t_reduced] =
-    context.requestTensor(dim, "tensor_reduced", Tensor::Initializer::NONE,
-                          false, TensorLifespan::FORWARD_DERIV_LIFESPAN);
 }
 
 void BatchNormalizationLayer::setProperty(
@@ -170,40 +325,56 @@ void BatchNormalizationLayer::forwarding(RunLayerContext &context,
 
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
-  Tensor &deviation = context.getTensor(wt_idx[BNParams::deviation]);
   Tensor &invstd = context.getTensor(wt_idx[BNParams::invstd]);
 
-  /** @todo these are not needed for inference, support optimizing these */
-  Tensor &t_reduced = context.getTensor(wt_idx[BNParams::t_reduced]);
-  /** use hidden_ as temporary tensor before setting the result in hidden */
-  Tensor t_full = hidden_;
-  Tensor &cvar = context.getTensor(wt_idx[BNParams::cvar]);
-
-  if (training) {
-    input_.average(axes_to_reduce, t_reduced);
-    input_.subtract(t_reduced, deviation);
+  const ChannelLayout l = getChannelLayout(input_.getDim(), axis);
+  const float *in = input_.getData();
+  float *out = hidden_.getData();
+  float *mu_ = mu.getData();
+  float *var_ = var.getData();
+  const float *gamma_ = gamma.getData();
+  const float *beta_ = beta.getData();
+  float *invstd_ = invstd.getData();
+
+  if (!training) {
+    /// fold the statistics and the affine transform into one scale and shift
+    std::vector<float> scale(l.channel), shift(l.channel);
+    for (unsigned int c = 0; c < l.channel; ++c) {
+      invstd_[c] = 1.0f / std::sqrt(var_[c] + epsilon);
+      scale[c] = gamma_[c] * invstd_[c];
+      shift[c] = beta_[c] - mu_[c] * scale[c];
+    }
 
-    mu.multiply_i(momentum);
-    mu.add_i(t_reduced, 1 - momentum);
+    forEachChannelRun(l, [&](unsigned int c, unsigned int begin,
+                             unsigned int end) {
+      for (unsigned int i = begin; i < end; ++i)
+        out[i] = in[i] * scale[c] + shift[c];
+    });
+    return;
+  }
 
-    deviation.pow(2.0f, t_full);
-    t_full.average(axes_to_reduce, cvar);
+  Tensor &deviation = context.getTensor(wt_idx[BNParams::deviation]);
+  float *dev = deviation.getData();
 
-    var.multiply_i(momentum);
-    var.add_i(cvar, 1 - momentum);
+  std::vector<float> mean(l.channel), cvar(l.channel), scale(l.channel);
+  channelMoments(in, l, mean.data(), cvar.data());
 
-    cvar.add_i(epsilon);
-    cvar.pow(-0.5f, invstd);
-  } else {
-    input_.subtract(mu, deviation);
-    /** @todo do below 2 lines only for first iteration */
-    var.add(epsilon, invstd);
-    invstd.pow_i(-0.5f);
+  for (unsigned int c = 0; c < l.channel; ++c) {
+    mu_[c] = momentum * mu_[c] + (1 - momentum) * mean[c];
+    var_[c] = momentum * var_[c] + (1 - momentum) * cvar[c];
+    invstd_[c] = 1.0f / std::sqrt(cvar[c] + epsilon);
+    scale[c] = gamma_[c] * invstd_[c];
   }
 
-  deviation.multiply(invstd, hidden_);
-  hidden_.multiply_i(gamma);
-  hidden_.add_i(beta);
+  /// input and output may share the memory, read before writing
+  forEachChannelRun(l, [&](unsigned int c, unsigned int begin,
+                           unsigned int end) {
+    for (unsigned int i = begin; i < end; ++i) {
+      float d = in[i] - mean[c];
+      dev[i] = d;
+      out[i] = d * scale[c] + beta_[c];
+    }
+  });
 }
 
 void BatchNormalizationLayer::calcDerivative(RunLayerContext &context) {
@@ -213,46 +384,65 @@ void BatchNormalizationLayer::calcDerivative(RunLayerContext &context) {
   Tensor &dx = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
   Tensor &deviation = context.getTensor(wt_idx[BNParams::deviation]);
   Tensor &invstd = context.getTensor(wt_idx[BNParams::invstd]);
-  Tensor &cvar = context.getTensor(wt_idx[BNParams::cvar]);
-
-  Tensor &t_reduced = context.getTensor(wt_idx[BNParams::t_reduced]);
-  Tensor &t_full = context.getTensor(wt_idx[BNParams::t_full]);
 
-  deviation.multiply(deriv, t_full);
-  t_full.average(axes_to_reduce, t_reduced);
-  t_reduced.divide_i(cvar);
-  deviation.multiply_i(t_reduced);
+  const ChannelLayout l = getChannelLayout(deriv.getDim(), axis);
+  const float *dy = deriv.getData();
+  const float *dev = deviation.getData();
+  const float *gamma_ = gamma.getData();
+  const float *invstd_ = invstd.getData();
+  float *dx_ = dx.getData();
 
+  std::vector<float> sum_dy(l.channel), sum_dy_dev(l.channel);
   if (context.getTrainable()) {
-    /**
-     * This calculates dgamma tensor.
-     */
-    Tensor &dgamma = context.getWeightGrad(wt_idx[BNParams::gamma]);
-    t_full.multiply_i(invstd);
-    t_full.sum(axes_to_reduce, dgamma);
-
-    /**
-     * This implementation depends on the pre-calculated dbeta calculated.
-     */
-    Tensor &dbeta = context.getWeightGrad(wt_idx[BNParams::beta]);
-    dbeta.divide(divider, t_reduced);
+    /// reuse the sums of calcGradient, dbeta = sum(dy) and dgamma = sum(dy *
+    /// deviation) * invstd
+    const float *dgamma =
+      context.getWeightGrad(wt_idx[BNParams::gamma]).getData();
+    const float *dbeta =
+      context.getWeightGrad(wt_idx[BNParams::beta]).getData();
+    for (unsigned int c = 0; c < l.channel; ++c) {
+      sum_dy[c] = dbeta[c];
+      sum_dy_dev[c] = dgamma[c] / invstd_[c];
+    }
   } else {
-    deriv.average(axes_to_reduce, t_reduced);
+    channelGradSums(dy, dev, l, sum_dy.data(), sum_dy_dev.data());
   }
 
-  deriv.subtract(t_reduced, dx);
-  dx.subtract_i(deviation);
+  /**
+   * dx = gamma * invstd * (dy - mean(dy) - deviation * mean(dy * deviation) *
+   * invstd^2), folded into per-channel coefficients
+   */
+  const float divider = l.outer * l.inner;
+  std::vector<float> k(l.channel), a(l.channel), b(l.channel);
+  for (unsigned int c = 0; c < l.channel; ++c) {
+    k[c] = gamma_[c] * invstd_[c];
+    a[c] = sum_dy[c] / divider;
+    b[c] = sum_dy_dev[c] * invstd_[c] * invstd_[c] / divider;
+  }
 
-  invstd.multiply_i(gamma);
-  dx.multiply_i(invstd);
+  forEachChannelRun(l, [&](unsigned int c, unsigned int begin,
+                           unsigned int end) {
+    for (unsigned int i = begin; i < end; ++i)
+      dx_[i] = k[c] * (dy[i] - a[c] - dev[i] * b[c]);
+  });
 }
 
 void BatchNormalizationLayer::calcGradient(RunLayerContext &context) {
-  /** dgamma is calculated in calcDerivative. dbeta is calculated here */
+  /** dgamma and dbeta are reduced together, calcDerivative reuses them */
+  Tensor &dgamma = context.getWeightGrad(wt_idx[BNParams::gamma]);
   Tensor &dbeta = context.getWeightGrad(wt_idx[BNParams::beta]);
   const Tensor &deriv = context.getIncomingDerivative(SINGLE_INOUT_IDX);
+  Tensor &deviation = context.getTensor(wt_idx[BNParams::deviation]);
+  Tensor &invstd = context.getTensor(wt_idx[BNParams::invstd]);
+
+  const ChannelLayout l = getChannelLayout(deriv.getDim(), axis);
+  float *dgamma_ = dgamma.getData();
+  const float *invstd_ = invstd.getData();
 
-  deriv.sum(axes_to_reduce, dbeta);
+  channelGradSums(deriv.getData(), deviation.getData(), l, dbeta.getData(),
+                  dgamma_);
+  for (unsigned int c = 0; c < l.channel; ++c)
+    dgamma_[c] *= invstd_[c];
 }
 
 void BatchNormalizationLayer::exportTo(Exporter &exporter,
@@ -263,19 +453,6 @@ void BatchNormalizationLayer::exportTo(Exporter &exporter,
 void BatchNormalizationLayer::setBatch(RunLayerContext &context,
                                        unsigned int batch) {
   context.updateTensor(wt_idx[BNParams::deviation], batch);
-  context.updateTensor(wt_idx[BNParams::t_full], batch);
-
-  /// reset divider
-  divider = 1;
-  auto input_dim = context.getInput(0).getDim();
-  for (auto axis : axes_to_reduce) {
-    if (axis == 0) {
-      /// @note input dim batch is not updated, it will be more sensible we
-      /// update batch before any node comes to this spot
-      divider *= batch;
-    }
-    divider *= input_dim.getTensorDim(axis);
-  }
 }
 
 } /* namespace nntrainer */
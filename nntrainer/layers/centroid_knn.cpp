@@ -12,11 +12,15 @@
  * @details This layer takes centroid and calculate l2 distance
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <limits>
 #include <regex>
 #include <sstream>
+#include <vector>
 
+#include <blas_interface.h>
 #include <centroid_knn.h>
 #include <layer_context.h>
 #include <nntrainer_error.h>
@@ -31,7 +35,14 @@ static constexpr size_t SINGLE_INOUT_IDX = 0;
 
 enum KNNParams { map, num_samples };
 
-CentroidKNN::CentroidKNN() : Layer(), centroid_knn_props(props::NumClass()) {
+/**
+ * @brief number of input elements of a batch from which the classes and the
+ * samples are processed in parallel
+ */
+static constexpr unsigned int knn_parallel_threshold = 1u << 15;
+
+CentroidKNN::CentroidKNN() :
+  Layer(), centroid_knn_props(props::NumClass()), norm_valid(false) {
   weight_idx.fill(std::numeric_limits<unsigned>::max());
 }
 
@@ -68,58 +79,92 @@ void CentroidKNN::finalize(nntrainer::InitLayerContext &context) {
   weight_idx[KNNParams::num_samples] = context.requestWeight(
     samples_seen, nntrainer::Tensor::Initializer::ZEROS,
     nntrainer::WeightRegularizer::NONE, 1.0f, 0.0f, "num_samples", false);
+
+  /// the norms are computed from the map once it is initialized
+  centroid_norm.assign(num_class, 0.0f);
+  norm_valid = false;
+}
+
+void CentroidKNN::weightsLoaded(nntrainer::RunLayerContext &context) {
+  norm_valid = false;
 }
 
 void CentroidKNN::forwarding(nntrainer::RunLayerContext &context,
                              bool training) {
   auto &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
   auto &input_ = context.getInput(SINGLE_INOUT_IDX);
-  const auto &input_dim = input_.getDim();
 
   auto &map = context.getWeight(weight_idx[KNNParams::map]);
   auto &num_samples = context.getWeight(weight_idx[KNNParams::num_samples]);
-  auto feature_len = input_dim.getFeatureLen();
 
-  auto get_distance = [](const nntrainer::Tensor &a,
-                         const nntrainer::Tensor &b) {
-    return -a.subtract(b).l2norm();
-  };
+  const unsigned int batch = input_.batch();
+  const unsigned int num_class = std::get<props::NumClass>(centroid_knn_props);
+  const unsigned int feature_len = input_.getDim().getFeatureLen();
+  const bool parallel = batch * feature_len >= knn_parallel_threshold;
+
+  const float *input_data = input_.getData();
+  float *map_data = map.getData();
+  float *seen = num_samples.getData();
+  float *norm = centroid_norm.data();
 
   if (training) {
-    auto &label = context.getLabel(SINGLE_INOUT_IDX);
-    auto ans = label.argmax();
-
-    for (unsigned int b = 0; b < input_.batch(); ++b) {
-      auto saved_feature =
-        map.getSharedDataTensor({feature_len}, ans[b] * feature_len);
-
-      //  nntrainer::Tensor::Map(map.getData(), {feature_len},
-      // ans[b] * feature_len);
-      auto num_sample = num_samples.getValue(0, 0, 0, ans[b]);
-      auto current_feature = input_.getBatchSlice(b, 1);
-      saved_feature.multiply_i(num_sample);
-      saved_feature.add_i(current_feature);
-      saved_feature.divide_i(num_sample + 1);
-      num_samples.setValue(0, 0, 0, ans[b], num_sample + 1);
+    auto ans = context.getLabel(SINGLE_INOUT_IDX).argmax();
+
+    /// the samples of the batch grouped by class, keeping the batch order
+    std::vector<unsigned int> begin(num_class + 1, 0), order(batch);
+    for (unsigned int b = 0; b < batch; ++b)
+      begin[ans[b] + 1]++;
+    for (unsigned int c = 0; c < num_class; ++c)
+      begin[c + 1] += begin[c];
+    std::vector<unsigned int> pos(begin.begin(), begin.end() - 1);
+    for (unsigned int b = 0; b < batch; ++b)
+      order[pos[ans[b]]++] = b;
+
+    /// centroid = (centroid * seen + sum of the new samples) / (seen + new)
+#pragma omp parallel for if (parallel)
+    for (unsigned int c = 0; c < num_class; ++c) {
+      const unsigned int new_samples = begin[c + 1] - begin[c];
+      if (new_samples == 0)
+        continue;
+
+      float *centroid = map_data + c * feature_len;
+      sscal(feature_len, seen[c], centroid, 1);
+      for (unsigned int s = begin[c]; s < begin[c + 1]; ++s)
+        saxpy(feature_len, 1.0f, input_data + order[s] * feature_len, 1,
+              centroid, 1);
+      sscal(feature_len, 1.0f / (seen[c] + new_samples), centroid, 1);
+      seen[c] += new_samples;
+      norm[c] = sdot(feature_len, centroid, 1, centroid, 1);
     }
   }
 
-  for (unsigned int i = 0; i < std::get<props::NumClass>(centroid_knn_props);
-       ++i) {
-    auto saved_feature =
-      map.getSharedDataTensor({feature_len}, i * feature_len);
-    // nntrainer::Tensor::Map(map.getData(), {feature_len}, i * feature_len);
-
-    auto num_sample = num_samples.getValue(0, 0, 0, i);
-
-    for (unsigned int b = 0; b < input_.batch(); ++b) {
-      auto current_feature = input_.getBatchSlice(b, 1);
+  /// the map is initialized or loaded after the norms were computed
+  if (!norm_valid) {
+#pragma omp parallel for if (parallel)
+    for (unsigned int c = 0; c < num_class; ++c) {
+      const float *centroid = map_data + c * feature_len;
+      norm[c] = sdot(feature_len, centroid, 1, centroid, 1);
+    }
+    norm_valid = true;
+  }
 
-      if (num_sample == 0) {
-        hidden_.setValue(b, 0, 0, i, std::numeric_limits<float>::min());
+  /// |x - c|^2 = |x|^2 + |c|^2 - 2 x.c, with x.c of all pairs in one gemm
+  Tensor input_2d =
+    input_.getSharedDataTensor({batch, 1, 1, feature_len}, 0, true);
+  input_2d.dot(map, hidden_, false, true);
+
+  float *distance = hidden_.getData();
+#pragma omp parallel for if (parallel)
+  for (unsigned int b = 0; b < batch; ++b) {
+    const float *x = input_data + b * feature_len;
+    const float x_norm = sdot(feature_len, x, 1, x, 1);
+
+    float *row = distance + b * num_class;
+    for (unsigned int c = 0; c < num_class; ++c) {
+      if (seen[c] == 0) {
+        row[c] = std::numeric_limits<float>::min();
       } else {
-        hidden_.setValue(b, 0, 0, i,
-                         get_distance(current_feature, saved_feature));
+        row[c] = -std::sqrt(std::max(0.0f, x_norm + norm[c] - 2 * row[c]));
       }
     }
   }
@@ -14,6 +14,7 @@
 #ifndef __CENTROID_KNN_H__
 #define __CENTROID_KNN_H__
 #include <string>
+#include <vector>
 
 #include <common_properties.h>
 #include <layer_devel.h>
@@ -91,11 +92,18 @@ public:
    */
   void setProperty(const std::vector<std::string> &values) override;
 
+  /**
+   * @copydoc Layer::weightsLoaded(RunLayerContext &context)
+   */
+  void weightsLoaded(nntrainer::RunLayerContext &context) override;
+
   inline static const std::string type = "centroid_knn";
 
 private:
   std::tuple<props::NumClass> centroid_knn_props;
   std::array<unsigned int, 2> weight_idx; /**< indices of the weights */
+  std::vector<float> centroid_norm; /**< squared norms of the centroids */
+  bool norm_valid; /**< true if centroid_norm follows the map */
 };
 } // namespace nntrainer
 
@@ -105,6 +105,10 @@ PoolSize::PoolSize(unsigned int value) { set(value); }
 
 Stride::Stride(unsigned int value) { set(value); }
 
+Groups::Groups(unsigned int value) { set(value); }
+
+Dilation::Dilation(unsigned int value) { set(value); }
+
 /**
  * @brief unsigned integer property, internally used to parse padding values
  *
@@ -287,6 +291,8 @@ bool BasicRegularizer::isValid(
 
 FlipDirection::FlipDirection(FlipDirectionInfo::Enum value) { set(value); }
 
+ConvAlgorithm::ConvAlgorithm(ConvAlgorithmInfo::Enum value) { set(value); }
+
 void GenericShape::set(const TensorDim &value) {
   TensorDim ret = value;
   ret.setDynDimFlag(0b1000);
@@ -299,6 +305,14 @@ void GenericShape::set(const TensorDim &value) {
   Property<TensorDim>::set(ret);
 }
 
+bool LearningRateMultiplier::isValid(const float &value) const {
+  return value > 0.0f;
+}
+
+bool MinLearningRate::isValid(const float &value) const {
+  return value >= 0.0f;
+}
+
 } // namespace props
 
 template <>
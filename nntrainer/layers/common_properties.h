@@ -121,6 +121,18 @@ public:
   static constexpr const char *key = "disable_bias";
 };
 
+/**
+ * @brief FusedBatchNormalization property, true if the layer absorbed the
+ * batch normalization layer after it
+ *
+ */
+class FusedBatchNormalization : public nntrainer::Property<bool> {
+public:
+  static constexpr const char *key =
+    "fused_batch_normalization";  /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+};
+
 /**
  * @brief Integrate bias_ih and bias_hh to bias_h to use only 1 bias (Used in
  * rnn variant)
@@ -358,6 +370,39 @@ public:
   using prop_tag = uint_prop_tag;              /**< property type */
 };
 
+/**
+ * @brief Groups property, the input channels and the filters are split to
+ * this many groups, and each group of filters convolves the matching group of
+ * input channels only. groups == input channels is a depthwise convolution
+ *
+ */
+class Groups : public nntrainer::PositiveIntegerProperty {
+public:
+  /**
+   * @brief Construct a new Groups object with a default value 1
+   *
+   */
+  Groups(unsigned int value = 1);
+  static constexpr const char *key = "groups"; /**< unique key to access */
+  using prop_tag = uint_prop_tag;              /**< property type */
+};
+
+/**
+ * @brief Dilation property, the kernel elements are applied this far apart
+ * from each other, which widens the kernel without adding weights
+ *
+ */
+class Dilation : public nntrainer::PositiveIntegerProperty {
+public:
+  /**
+   * @brief Construct a new Dilation object with a default value 1
+   *
+   */
+  Dilation(unsigned int value = 1);
+  static constexpr const char *key = "dilation"; /**< unique key to access */
+  using prop_tag = uint_prop_tag;                /**< property type */
+};
+
 /**
  * @brief Padding2D property, this is used to calculate padding2D
  * @details Padding2D is saved as a string. Upon calling Padding2D::compute,
@@ -790,6 +835,23 @@ public:
   static constexpr const char *key = "activation";
 };
 
+/**
+ * @brief DerivativeMask property, if true the activation keeps a compressed
+ * derivative for backwarding instead of its output
+ *
+ */
+class DerivativeMask : public nntrainer::Property<bool> {
+public:
+  /**
+   * @brief Construct a new DerivativeMask object
+   *
+   */
+  DerivativeMask(bool val = false) : nntrainer::Property<bool>(val) {}
+  static constexpr const char *key =
+    "derivative_mask";            /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+};
+
 /**
  * @brief HiddenStateActivation Enumeration Information
  *
@@ -824,6 +886,17 @@ public:
   static constexpr const char *key = "recurrent_activation";
 };
 
+/**
+ * @brief FusedActivation Enumeration Information, activation applied on the
+ * output of a layer which absorbed the activation layer after it
+ *
+ */
+class FusedActivation final : public EnumProperty<ActivationTypeInfo> {
+public:
+  using prop_tag = enum_class_prop_tag;
+  static constexpr const char *key = "fused_activation";
+};
+
 /**
  * @brief     Enumeration of tensor initialization type
  */
@@ -1005,6 +1078,63 @@ public:
   static constexpr const char *key = "pooling";
 };
 
+/**
+ * @brief     Enumeration of convolution algorithm
+ */
+struct ConvAlgorithmInfo {
+  /**
+   * @brief   Convolution algorithm class
+   */
+  enum class Enum {
+    automatic = 0, /**< select from the shape of the layer */
+    im2col = 1,    /**< unroll the patches to columns, then a gemm */
+    gemm = 2,      /**< a gemm on the input for 1x1 kernels, no unrolling */
+    winograd = 3,  /**< winograd F(2x2, 3x3) for 3x3 kernels of stride 1 */
+    direct = 4     /**< direct loops for the inputs with a few channels */
+  };
+  static constexpr std::initializer_list<Enum> EnumList = {
+    Enum::automatic, Enum::im2col, Enum::gemm, Enum::winograd, Enum::direct};
+
+  static constexpr const char *EnumStr[] = {"auto", "im2col", "gemm",
+                                            "winograd", "direct"};
+};
+
+/**
+ * @brief ConvAlgorithm property, algorithm which computes the convolution.
+ * If the algorithm does not support the shape of the layer, finalize fails
+ *
+ */
+class ConvAlgorithm final : public EnumProperty<ConvAlgorithmInfo> {
+public:
+  /**
+   * @brief Construct a new ConvAlgorithm object
+   *
+   * @param value value to set, defaults to automatic
+   */
+  ConvAlgorithm(
+    ConvAlgorithmInfo::Enum value = ConvAlgorithmInfo::Enum::automatic);
+  using prop_tag = enum_class_prop_tag;
+  static constexpr const char *key = "conv_algorithm";
+};
+
+/**
+ * @brief Im2ColCache property, if true the convolution keeps the unrolled
+ * input of the whole batch from forwarding to calcGradient instead of
+ * unrolling it again, at the expense of the memory
+ *
+ */
+class Im2ColCache : public nntrainer::Property<bool> {
+public:
+  /**
+   * @brief Construct a new Im2ColCache object
+   *
+   */
+  Im2ColCache(bool val = false) : nntrainer::Property<bool>(val) {}
+  static constexpr const char *key =
+    "im2col_cache";               /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+};
+
 /**
  * @brief     Enumeration of flip direction
  */
@@ -1109,6 +1239,27 @@ public:
   using prop_tag = float_prop_tag; /**< property type */
 };
 
+/**
+ * @brief properties for the multiplier of the learning rate of the weights of
+ * a layer
+ *
+ */
+class LearningRateMultiplier : public Property<float> {
+public:
+  static constexpr const char *key =
+    "learning_rate_multiplier";    /**< unique key to access */
+  using prop_tag = float_prop_tag; /**< property type */
+
+  /**
+   * @brief LearningRateMultiplier validator
+   *
+   * @param value float to validate
+   * @retval true if it is greater than 0.0
+   * @retval false if it is smaller or equal than 0.0
+   */
+  bool isValid(const float &value) const override;
+};
+
 /**
  * @brief Learning Rate props
  *
@@ -1140,6 +1291,50 @@ public:
   using prop_tag = uint_prop_tag;                   /**< property type */
 };
 
+/**
+ * @brief warmup steps property, iterations over which the learning rate
+ * linearly rises to its value
+ *
+ */
+class WarmupSteps : public Property<unsigned int> {
+public:
+  static constexpr const char *key =
+    "warmup_steps";               /**< unique key to access */
+  using prop_tag = uint_prop_tag; /**< property type */
+};
+
+/**
+ * @brief min learning rate property, the learning rate decays down to it
+ *
+ */
+class MinLearningRate : public Property<float> {
+public:
+  static constexpr const char *key =
+    "min_learning_rate";           /**< unique key to access */
+  using prop_tag = float_prop_tag; /**< property type */
+
+  /**
+   * @brief MinLearningRate validator
+   *
+   * @param value float to validate
+   * @retval true if it is greater or equal than 0.0
+   * @retval false if it is smaller than 0.0
+   */
+  bool isValid(const float &value) const override;
+};
+
+/**
+ * @brief learning rate scheduler property, type of the learning rate
+ * scheduler of an optimizer
+ *
+ */
+class LearningRateSchedulerType : public Property<std::string> {
+public:
+  static constexpr const char *key =
+    "learning_rate_scheduler";   /**< unique key to access */
+  using prop_tag = str_prop_tag; /**< property type */
+};
+
 } // namespace props
 } // namespace nntrainer
 
@@ -107,8 +107,8 @@ void ConcatLayer::finalize(InitLayerContext &context) {
 
 void ConcatLayer::forwarding(RunLayerContext &context, bool training) {
   /**
-   * @todo avoid copy by creating input here as a shared_tensor of the output
-   * here and then this layer can be in_place as well
+   * inputs which are placed in the output by the network graph, when the
+   * layout allows, are already in place and are not copied
    */
   Tensor &output = context.getOutput(SINGLE_INOUT_IDX);
 
@@ -124,7 +124,10 @@ void ConcatLayer::forwarding(RunLayerContext &context, bool training) {
     input.reshape(irh);
 
     /** loop over the dimensions before the concat dimension */
-    for (unsigned int batch = 0; batch < output.batch(); batch++) {
+    for (unsigned int batch = 0;
+         batch < output.batch() &&
+         input.getData() != output.getAddress(0, 0, output_height_offset, 0);
+         batch++) {
       /** loop over the concat dimension itself */
       for (unsigned int count = 0; count < irh.height(); count++) {
         Tensor dest_tensor = Tensor::Map(
@@ -145,10 +148,7 @@ void ConcatLayer::forwarding(RunLayerContext &context, bool training) {
 }
 
 void ConcatLayer::calcDerivative(RunLayerContext &context) {
-  /**
-   * @todo avoid copy by creating input here as a shared_tensor of the output
-   * here and then this layer can be in_place as well
-   */
+  /** derivatives placed in the incoming derivative are not copied */
   Tensor output = context.getIncomingDerivative(SINGLE_INOUT_IDX);
 
   output.reshape(output_reshape_helper);
@@ -162,7 +162,10 @@ void ConcatLayer::calcDerivative(RunLayerContext &context) {
     input.reshape(irh);
 
     /** loop over the dimensions before the concat dimension */
-    for (unsigned int batch = 0; batch < output.batch(); batch++) {
+    for (unsigned int batch = 0;
+         batch < output.batch() &&
+         input.getData() != output.getAddress(0, 0, output_height_offset, 0);
+         batch++) {
       /** loop over the concat dimension itself */
       for (unsigned int count = 0; count < irh.height(); count++) {
         const Tensor source_tensor = Tensor::Map(
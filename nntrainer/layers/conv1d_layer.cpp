@@ -17,7 +17,6 @@
 #include <string>
 
 #include <conv1d_layer.h>
-#include <conv2d_layer.h>
 #include <layer_context.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
@@ -28,13 +27,243 @@ namespace nntrainer {
 
 static constexpr size_t SINGLE_INOUT_IDX = 0;
 
+enum Conv1DParams { weight, bias, inter_result };
+
+namespace {
+
+/**
+ * @brief number of output elements from which the kernels run in parallel
+ */
+static constexpr unsigned int conv1d_parallel_threshold = 1u << 15;
+
+/**
+ * @brief maximum kernel size for which the direct convolution is selected,
+ * unrolling the input does not pay off below
+ */
+static constexpr unsigned int direct_max_kernel = 3;
+
+/**
+ * @brief geometry of a convolution along the width
+ */
+struct Conv1DGeometry {
+  unsigned int batch;        /**< batch size */
+  unsigned int in_c, in_w;   /**< input channel, width */
+  unsigned int out_c, out_w; /**< output channel, width */
+  unsigned int k, s, d;      /**< kernel size, stride, dilation */
+  int pl;                    /**< padding left */
+
+  /**
+   * @brief Construct a new Conv1D Geometry object
+   *
+   * @param in_dim input dimension
+   * @param out_dim output dimension
+   * @param kernel_size kernel size
+   * @param stride stride
+   * @param dilation dilation
+   * @param padding_left padding on the left
+   */
+  Conv1DGeometry(const TensorDim &in_dim, const TensorDim &out_dim,
+                 unsigned int kernel_size, unsigned int stride,
+                 unsigned int dilation, unsigned int padding_left) :
+    batch(in_dim.batch()),
+    in_c(in_dim.channel()),
+    in_w(in_dim.width()),
+    out_c(out_dim.channel()),
+    out_w(out_dim.width()),
+    k(kernel_size),
+    s(stride),
+    d(dilation),
+    pl(padding_left) {}
+
+  /**
+   * @brief get the output columns whose input column lies inside of the input
+   * for the kernel element @a kk, [ow_begin, ow_end)
+   *
+   * @return int input column of the output column 0, may be negative
+   */
+  int columns(unsigned int kk, unsigned int &ow_begin,
+              unsigned int &ow_end) const {
+    int first = static_cast<int>(kk * d) - pl;
+    int last = static_cast<int>(in_w) - 1 - first;
+    ow_begin = first >= 0 ? 0 : std::min(out_w, (-first + s - 1) / s);
+    ow_end = last < 0 ? ow_begin
+                      : std::max(ow_begin, std::min(out_w, last / s + 1));
+    return first;
+  }
+};
+
+/**
+ * @brief     convolution by direct loops, no workspace is needed. Every
+ * kernel element is applied to a whole output row, so the inner loop runs
+ * over the width without any bound check. The batches and the output
+ * channels run in parallel
+ *
+ * @param[in] in input
+ * @param[in] filter filter
+ * @param[out] out output
+ * @param[in] g geometry of the convolution
+ */
+static void directConv1D(const float *in, const float *filter, float *out,
+                         const Conv1DGeometry &g) {
+  const unsigned int rows = g.batch * g.out_c;
+
+#pragma omp parallel for if (rows * g.out_w >= conv1d_parallel_threshold)
+  for (unsigned int bk = 0; bk < rows; ++bk) {
+    float *o = out + bk * g.out_w;
+    std::fill_n(o, g.out_w, 0.0f);
+
+    const float *x = in + bk / g.out_c * g.in_c * g.in_w;
+    const float *f = filter + bk % g.out_c * g.in_c * g.k;
+    for (unsigned int c = 0; c < g.in_c; ++c) {
+      const float *in_row = x + c * g.in_w;
+      for (unsigned int kk = 0; kk < g.k; ++kk) {
+        unsigned int ow_begin, ow_end;
+        int first = g.columns(kk, ow_begin, ow_end);
+
+        float wt = f[c * g.k + kk];
+        for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+          o[ow] += wt * in_row[static_cast<int>(ow * g.s) + first];
+      }
+    }
+  }
+}
+
+/**
+ * @brief     derivative of the input of the direct convolution, the batches
+ * and the input channels run in parallel
+ *
+ * @param[in] deriv incoming derivative
+ * @param[in] filter filter
+ * @param[out] in_deriv derivative of the input
+ * @param[in] g geometry of the convolution
+ */
+static void directConv1DDerivative(const float *deriv, const float *filter,
+                                   float *in_deriv, const Conv1DGeometry &g) {
+  const unsigned int rows = g.batch * g.in_c;
+
+#pragma omp parallel for if (rows * g.in_w >= conv1d_parallel_threshold)
+  for (unsigned int bc = 0; bc < rows; ++bc) {
+    float *in_row = in_deriv + bc * g.in_w;
+    std::fill_n(in_row, g.in_w, 0.0f);
+
+    const float *d = deriv + bc / g.in_c * g.out_c * g.out_w;
+    const unsigned int c = bc % g.in_c;
+    for (unsigned int k = 0; k < g.out_c; ++k) {
+      const float *d_row = d + k * g.out_w;
+      const float *f = filter + (k * g.in_c + c) * g.k;
+      for (unsigned int kk = 0; kk < g.k; ++kk) {
+        unsigned int ow_begin, ow_end;
+        int first = g.columns(kk, ow_begin, ow_end);
+
+        float wt = f[kk];
+        for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+          in_row[static_cast<int>(ow * g.s) + first] += wt * d_row[ow];
+      }
+    }
+  }
+}
+
+/**
+ * @brief     gradient of the filter of the direct convolution summed over the
+ * batch, the output channels run in parallel
+ *
+ * @param[in] deriv incoming derivative
+ * @param[in] in input
+ * @param[out] filter_grad gradient of the filter
+ * @param[in] g geometry of the convolution
+ */
+static void directConv1DGradient(const float *deriv, const float *in,
+                                 float *filter_grad, const Conv1DGeometry &g) {
+  const unsigned int feature = g.in_c * g.k;
+  const unsigned int work = g.batch * g.out_c * g.out_w;
+
+#pragma omp parallel for if (work >= conv1d_parallel_threshold)
+  for (unsigned int k = 0; k < g.out_c; ++k) {
+    float *f = filter_grad + k * feature;
+    std::fill_n(f, feature, 0.0f);
+
+    for (unsigned int b = 0; b < g.batch; ++b) {
+      const float *d_row = deriv + (b * g.out_c + k) * g.out_w;
+      const float *x = in + b * g.in_c * g.in_w;
+      for (unsigned int c = 0; c < g.in_c; ++c) {
+        const float *in_row = x + c * g.in_w;
+        for (unsigned int kk = 0; kk < g.k; ++kk) {
+          unsigned int ow_begin, ow_end;
+          int first = g.columns(kk, ow_begin, ow_end);
+
+          float sum = 0.0f;
+          for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+            sum += d_row[ow] * in_row[static_cast<int>(ow * g.s) + first];
+          f[c * g.k + kk] += sum;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief     unroll the input of a batch over the width. Row (c * k + kk) of
+ * the column matrix is the input row c shifted for the kernel element kk, so
+ * the rows are contiguous and the filter multiplies it without a transpose
+ *
+ * @param[in] in input of a batch
+ * @param[out] col column matrix, (channel * kernel size, output width)
+ * @param[in] g geometry of the convolution
+ */
+static void im2col1D(const float *in, float *col, const Conv1DGeometry &g) {
+  const unsigned int work = g.in_c * g.k * g.out_w;
+
+#pragma omp parallel for if (work >= conv1d_parallel_threshold)
+  for (unsigned int c = 0; c < g.in_c; ++c) {
+    const float *in_row = in + c * g.in_w;
+    for (unsigned int kk = 0; kk < g.k; ++kk) {
+      unsigned int ow_begin, ow_end;
+      int first = g.columns(kk, ow_begin, ow_end);
+
+      float *col_row = col + (c * g.k + kk) * g.out_w;
+      std::fill(col_row, col_row + ow_begin, 0.0f);
+      for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+        col_row[ow] = in_row[static_cast<int>(ow * g.s) + first];
+      std::fill(col_row + ow_end, col_row + g.out_w, 0.0f);
+    }
+  }
+}
+
+/**
+ * @brief     fold the column matrix back to the input of a batch, the
+ * overlapping elements are summed
+ *
+ * @param[in] col column matrix, (channel * kernel size, output width)
+ * @param[out] in input of a batch
+ * @param[in] g geometry of the convolution
+ */
+static void col2im1D(const float *col, float *in, const Conv1DGeometry &g) {
+  const unsigned int work = g.in_c * g.k * g.out_w;
+
+#pragma omp parallel for if (work >= conv1d_parallel_threshold)
+  for (unsigned int c = 0; c < g.in_c; ++c) {
+    float *in_row = in + c * g.in_w;
+    std::fill_n(in_row, g.in_w, 0.0f);
+    for (unsigned int kk = 0; kk < g.k; ++kk) {
+      unsigned int ow_begin, ow_end;
+      int first = g.columns(kk, ow_begin, ow_end);
+
+      const float *col_row = col + (c * g.k + kk) * g.out_w;
+      for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+        in_row[static_cast<int>(ow * g.s) + first] += col_row[ow];
+    }
+  }
+}
+
+} // namespace
+
 Conv1DLayer::Conv1DLayer(const std::array<unsigned int, 2> &padding_) :
   LayerImpl(),
   padding(padding_),
   conv_props(props::FilterSize(), props::KernelSize(), props::Stride(),
-             props::Padding2D()) {
+             props::Padding2D(), props::Dilation(), props::ConvAlgorithm()),
+  algorithm(props::ConvAlgorithmInfo::Enum::automatic) {
   wt_idx.fill(std::numeric_limits<unsigned>::max());
-  conv2d_layer = std::make_unique<Conv2DLayer>();
 }
 
 Conv1DLayer::~Conv1DLayer() {}
@@ -44,41 +273,182 @@ void Conv1DLayer::finalize(InitLayerContext &context) {
     throw std::invalid_argument("Convolution layer takes only one input");
   }
 
-  if (context.getInputDimensions()[SINGLE_INOUT_IDX].height() != 1) {
+  const TensorDim &in_dim = context.getInputDimensions()[SINGLE_INOUT_IDX];
+  if (in_dim.height() != 1) {
     throw std::invalid_argument("Conv1D layer requires input with height 1");
   }
 
-  /** set the given properties as key value pair */
-  auto setPropertyKV = [this](const std::string &key,
-                              const std::string &value) {
-    auto const &prop = key + "=" + value;
-    conv2d_layer->setProperty({prop});
-  };
-
-  setPropertyKV(props::FilterSize::key,
-                std::to_string(std::get<props::FilterSize>(conv_props).get()));
-  setPropertyKV(
-    props::KernelSize::key,
-    "1," + std::to_string(std::get<props::KernelSize>(conv_props).get()));
-  setPropertyKV(props::Stride::key,
-                "1," +
-                  std::to_string(std::get<props::Stride>(conv_props).get()));
-  setPropertyKV(props::Padding2D::key,
-                std::get<props::Padding2D>(conv_props).get());
-
-  conv2d_layer->finalize(context);
+  auto &weight_regularizer =
+    std::get<props::WeightRegularizer>(*layer_impl_props);
+  auto &weight_regularizer_constant =
+    std::get<props::WeightRegularizerConstant>(*layer_impl_props);
+  auto &weight_initializer =
+    std::get<props::WeightInitializer>(*layer_impl_props);
+  auto &weight_decay = std::get<props::WeightDecay>(*layer_impl_props);
+  auto &bias_decay = std::get<props::BiasDecay>(*layer_impl_props);
+  auto &bias_initializer = std::get<props::BiasInitializer>(*layer_impl_props);
+  auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+
+  unsigned int filter_size = std::get<props::FilterSize>(conv_props);
+  unsigned int kernel_size = std::get<props::KernelSize>(conv_props);
+  unsigned int stride = std::get<props::Stride>(conv_props);
+  unsigned int dilation = std::get<props::Dilation>(conv_props);
+
+  /// same layout as a conv2d with a kernel of height 1
+  TensorDim dim = TensorDim(filter_size, in_dim.channel(), 1, kernel_size);
+  TensorDim bias_dim = TensorDim(1, filter_size, 1, 1);
+
+  /// only the width is padded, with the kernel spanning its dilation
+  unsigned int eff_kernel = (kernel_size - 1) * dilation + 1;
+  auto padding_ =
+    std::get<props::Padding2D>(conv_props)
+      .compute(in_dim, TensorDim(filter_size, in_dim.channel(), 1, eff_kernel),
+               {1, stride});
+  padding = {padding_[2], padding_[3]};
+
+  wt_idx[Conv1DParams::weight] = context.requestWeight(
+    dim, weight_initializer, weight_regularizer, weight_regularizer_constant,
+    weight_decay, "filter", true);
+
+  if (disable_bias.empty() || disable_bias.get() == false) {
+    wt_idx[Conv1DParams::bias] =
+      context.requestWeight(bias_dim, bias_initializer, WeightRegularizer::NONE,
+                            1.0f, bias_decay, "bias", true);
+  }
+
+  unsigned int eff_in_width = in_dim.width() + padding[0] + padding[1];
+  if (eff_in_width < eff_kernel) {
+    throw std::invalid_argument(
+      "Failed to initialize: in size + padding is smaller than effective "
+      "kernel");
+  }
+
+  TensorDim out_dim(in_dim.batch(), filter_size, 1,
+                    (eff_in_width - eff_kernel) / stride + 1);
+  context.setOutputDimensions({out_dim});
+
+  algorithm = std::get<props::ConvAlgorithm>(conv_props).get();
+  if (algorithm == props::ConvAlgorithmInfo::Enum::automatic) {
+    algorithm = kernel_size <= direct_max_kernel
+                  ? props::ConvAlgorithmInfo::Enum::direct
+                  : props::ConvAlgorithmInfo::Enum::im2col;
+  }
+
+  NNTR_THROW_IF(algorithm != props::ConvAlgorithmInfo::Enum::direct &&
+                  algorithm != props::ConvAlgorithmInfo::Enum::im2col,
+                std::invalid_argument)
+    << "[Conv1D] " << context.getName()
+    << " supports only auto, direct and im2col algorithms";
+
+  /// the column matrix of a single batch, direct needs no workspace
+  if (algorithm == props::ConvAlgorithmInfo::Enum::im2col) {
+    wt_idx[Conv1DParams::inter_result] = context.requestTensor(
+      TensorDim({in_dim.channel() * kernel_size, out_dim.width()}),
+      "inter_result", Tensor::Initializer::NONE, false,
+      TensorLifespan::ITERATION_LIFESPAN);
+  }
 }
 
 void Conv1DLayer::forwarding(RunLayerContext &context, bool training) {
-  conv2d_layer->forwarding(context, training);
+  Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
+  Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
+  Tensor &filter_kernel = context.getWeight(wt_idx[Conv1DParams::weight]);
+
+  const TensorDim filter_dim = filter_kernel.getDim();
+  Conv1DGeometry g(input_.getDim(), hidden_.getDim(), filter_dim.width(),
+                   std::get<props::Stride>(conv_props),
+                   std::get<props::Dilation>(conv_props), padding[0]);
+
+  if (algorithm == props::ConvAlgorithmInfo::Enum::direct) {
+    directConv1D(input_.getData(), filter_kernel.getData(), hidden_.getData(),
+                 g);
+  } else {
+    /// filter (filters, channel * kernel size) x column matrix = output
+    Tensor &im2col_result =
+      context.getTensor(wt_idx[Conv1DParams::inter_result]);
+    filter_kernel.reshape({filter_dim.batch(), filter_dim.getFeatureLen()});
+    for (unsigned int b = 0; b < g.batch; ++b) {
+      Tensor out = hidden_.getBatchSlice(b, 1);
+      out.reshape({g.out_c, g.out_w});
+
+      im2col1D(input_.getAddress(b, 0, 0, 0), im2col_result.getData(), g);
+      filter_kernel.dot(im2col_result, out, false, false);
+    }
+    filter_kernel.reshape(filter_dim);
+  }
+
+  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+      disable_bias.empty() || disable_bias.get() == false) {
+    Tensor &bias_kernel = context.getWeight(wt_idx[Conv1DParams::bias]);
+    if (hidden_.add_i(bias_kernel) != ML_ERROR_NONE) {
+      throw std::invalid_argument("[Conv1D] adding bias failed");
+    }
+  }
 }
 
 void Conv1DLayer::calcDerivative(RunLayerContext &context) {
-  conv2d_layer->calcDerivative(context);
+  const Tensor &derivative = context.getIncomingDerivative(SINGLE_INOUT_IDX);
+  Tensor &input_derivative = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
+  Tensor &filter_kernel = context.getWeight(wt_idx[Conv1DParams::weight]);
+
+  const TensorDim filter_dim = filter_kernel.getDim();
+  Conv1DGeometry g(input_derivative.getDim(), derivative.getDim(),
+                   filter_dim.width(), std::get<props::Stride>(conv_props),
+                   std::get<props::Dilation>(conv_props), padding[0]);
+
+  if (algorithm == props::ConvAlgorithmInfo::Enum::direct) {
+    directConv1DDerivative(derivative.getData(), filter_kernel.getData(),
+                           input_derivative.getData(), g);
+    return;
+  }
+
+  /// filter ^ T x derivative -(col2im)-> derivative of the input
+  Tensor &col2im_result = context.getTensor(wt_idx[Conv1DParams::inter_result]);
+  filter_kernel.reshape({filter_dim.batch(), filter_dim.getFeatureLen()});
+  for (unsigned int b = 0; b < g.batch; ++b) {
+    Tensor deriv_sub = derivative.getBatchSlice(b, 1);
+    deriv_sub.reshape({g.out_c, g.out_w});
+
+    filter_kernel.dot(deriv_sub, col2im_result, true, false);
+    col2im1D(col2im_result.getData(), input_derivative.getAddress(b, 0, 0, 0),
+             g);
+  }
+  filter_kernel.reshape(filter_dim);
 }
 
 void Conv1DLayer::calcGradient(RunLayerContext &context) {
-  conv2d_layer->calcGradient(context);
+  const Tensor &derivative = context.getIncomingDerivative(SINGLE_INOUT_IDX);
+  Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
+  Tensor &delK = context.getWeightGrad(wt_idx[Conv1DParams::weight]);
+
+  const TensorDim filter_dim = delK.getDim();
+  Conv1DGeometry g(input_.getDim(), derivative.getDim(), filter_dim.width(),
+                   std::get<props::Stride>(conv_props),
+                   std::get<props::Dilation>(conv_props), padding[0]);
+
+  if (algorithm == props::ConvAlgorithmInfo::Enum::direct) {
+    directConv1DGradient(derivative.getData(), input_.getData(),
+                         delK.getData(), g);
+  } else {
+    /// delK = derivative x column matrix ^ T, summed over the batch
+    Tensor &im2col_result =
+      context.getTensor(wt_idx[Conv1DParams::inter_result]);
+    delK.reshape({filter_dim.batch(), filter_dim.getFeatureLen()});
+    for (unsigned int b = 0; b < g.batch; ++b) {
+      Tensor deriv_sub = derivative.getBatchSlice(b, 1);
+      deriv_sub.reshape({g.out_c, g.out_w});
+
+      im2col1D(input_.getAddress(b, 0, 0, 0), im2col_result.getData(), g);
+      deriv_sub.dot(im2col_result, delK, false, true, b == 0 ? 0 : 1);
+    }
+    delK.reshape(filter_dim);
+  }
+
+  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+      disable_bias.empty() || disable_bias.get() == false) {
+    Tensor &delBias = context.getWeightGrad(wt_idx[Conv1DParams::bias]);
+    derivative.sum({0, 2, 3}, delBias);
+  }
 }
 
 void Conv1DLayer::exportTo(Exporter &exporter,
@@ -17,15 +17,14 @@
 
 #include <common_properties.h>
 #include <layer_impl.h>
-#include <memory.h>
 
 namespace nntrainer {
 
-class Conv2DLayer;
-
 /**
  * @class   Convolution 1D Layer
- * @brief   Convolution 1D Layer
+ * @brief   Convolution 1D Layer, which convolves the width of the input with
+ * height 1. Small kernels are applied directly, larger ones multiply the
+ * filter with the input unrolled over the width.
  */
 class Conv1DLayer : public LayerImpl {
 public:
@@ -97,13 +96,13 @@ public:
   inline static const std::string type = "conv1d";
 
 private:
-  std::array<unsigned int, 2> padding;
+  std::array<unsigned int, 2> padding; /**< padding left, right */
   std::tuple<props::FilterSize, props::KernelSize, props::Stride,
-             props::Padding2D>
+             props::Padding2D, props::Dilation, props::ConvAlgorithm>
     conv_props;
 
-  std::array<unsigned int, 5> wt_idx; /**< indices of the weights and tensors */
-  std::unique_ptr<Conv2DLayer> conv2d_layer; /**< conv2d layer instance */
+  std::array<unsigned int, 3> wt_idx; /**< indices of the weights and tensors */
+  props::ConvAlgorithmInfo::Enum algorithm; /**< algorithm in use */
 };
 
 } // namespace nntrainer
@@ -239,16 +239,511 @@ static void im2col(const Tensor &in, const TensorDim &kdim,
   }
 }
 
+/**
+ * @brief number of output elements of a batch from which the kernels run in
+ * parallel
+ */
+static constexpr unsigned int conv_parallel_threshold = 1u << 15;
+
+/**
+ * @brief maximum number of input channels for which the direct convolution
+ * is selected
+ */
+static constexpr unsigned int direct_max_channel = 4;
+
+/**
+ * @brief minimum number of input and output channels for which the winograd
+ * convolution is selected, the transforms do not pay off below
+ */
+static constexpr unsigned int winograd_min_channel = 8;
+
+/**
+ * @brief number of winograd tiles transformed at once, which bounds the
+ * workspace independently of the image size
+ */
+static constexpr unsigned int winograd_tile_block = 128;
+
+/**
+ * @brief geometry of a convolution of a single batch
+ */
+struct ConvGeometry {
+  unsigned int in_c, in_h, in_w;    /**< input channel, height, width */
+  unsigned int out_c, out_h, out_w; /**< output channel, height, width */
+  unsigned int k_h, k_w;            /**< kernel height, width */
+  unsigned int s_h, s_w;            /**< stride height, width */
+  int pt, pl;                       /**< padding top, left */
+  unsigned int group_in;  /**< input channels of a group */
+  unsigned int group_out; /**< output channels of a group */
+
+  /**
+   * @brief Construct a new Conv Geometry object
+   *
+   * @param in_dim input dimension
+   * @param out_dim output dimension
+   * @param kdim kernel dimension
+   * @param padding padding
+   * @param stride stride
+   * @param groups number of groups
+   */
+  ConvGeometry(const TensorDim &in_dim, const TensorDim &out_dim,
+               const TensorDim &kdim,
+               const std::array<unsigned int, 4> &padding,
+               const std::array<props::Stride, CONV2D_DIM> &stride,
+               unsigned int groups = 1) :
+    in_c(in_dim.channel()),
+    in_h(in_dim.height()),
+    in_w(in_dim.width()),
+    out_c(out_dim.channel()),
+    out_h(out_dim.height()),
+    out_w(out_dim.width()),
+    k_h(kdim.height()),
+    k_w(kdim.width()),
+    s_h(stride[0]),
+    s_w(stride[1]),
+    pt(padding[0]),
+    pl(padding[2]),
+    group_in(in_c / groups),
+    group_out(out_c / groups) {}
+
+  /**
+   * @brief get the output columns whose input column lies inside of the input
+   * for the kernel column @a kw, [ow_begin, ow_end)
+   *
+   * @return int input column of the output column 0, may be negative
+   */
+  int columns(unsigned int kw, unsigned int &ow_begin,
+              unsigned int &ow_end) const {
+    int first = static_cast<int>(kw) - pl;
+    int last = static_cast<int>(in_w) - 1 - first;
+    ow_begin = first >= 0 ? 0 : (-first + s_w - 1) / s_w;
+    ow_end = last < 0 ? 0 : std::min(out_w, last / s_w + 1);
+    return first;
+  }
+
+  /**
+   * @brief get the input row of the output row @a oh for the kernel row @a kh
+   *
+   * @return int input row, -1 if it lies in the padding
+   */
+  int row(unsigned int oh, unsigned int kh) const {
+    int ih = static_cast<int>(oh * s_h + kh) - pt;
+    return ih < static_cast<int>(in_h) ? ih : -1;
+  }
+};
+
+/**
+ * @brief     convolution by direct loops, no workspace is needed. Every
+ * kernel element is applied to a whole output row, so the inner loop runs
+ * over the width without any bound check. The output channels run in
+ * parallel, which makes this the depthwise kernel as well
+ *
+ * @param[in] in input of a batch
+ * @param[in] filter filter
+ * @param[out] out output of a batch
+ * @param[in] g geometry of the convolution
+ */
+static void directConv(const float *in, const float *filter, float *out,
+                       const ConvGeometry &g) {
+  const unsigned int in_plane = g.in_h * g.in_w;
+  const unsigned int out_plane = g.out_h * g.out_w;
+
+#pragma omp parallel for if (g.out_c * out_plane >= conv_parallel_threshold)
+  for (unsigned int k = 0; k < g.out_c; ++k) {
+    float *o = out + k * out_plane;
+    std::fill_n(o, out_plane, 0.0f);
+
+    const float *group = in + k / g.group_out * g.group_in * in_plane;
+    for (unsigned int c = 0; c < g.group_in; ++c) {
+      const float *plane = group + c * in_plane;
+      const float *f = filter + (k * g.group_in + c) * g.k_h * g.k_w;
+
+      for (unsigned int kw = 0; kw < g.k_w; ++kw) {
+        unsigned int ow_begin, ow_end;
+        int first = g.columns(kw, ow_begin, ow_end);
+
+        for (unsigned int kh = 0; kh < g.k_h; ++kh) {
+          float wt = f[kh * g.k_w + kw];
+          for (unsigned int oh = 0; oh < g.out_h; ++oh) {
+            int ih = g.row(oh, kh);
+            if (ih < 0)
+              continue;
+
+            const float *in_row = plane + ih * g.in_w;
+            float *out_row = o + oh * g.out_w;
+            for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+              out_row[ow] +=
+                wt * in_row[static_cast<int>(ow * g.s_w) + first];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief     derivative of the input of the direct convolution, the input
+ * channels run in parallel
+ *
+ * @param[in] deriv incoming derivative of a batch
+ * @param[in] filter filter
+ * @param[out] in_deriv derivative of the input of a batch
+ * @param[in] g geometry of the convolution
+ */
+static void directConvDerivative(const float *deriv, const float *filter,
+                                 float *in_deriv, const ConvGeometry &g) {
+  const unsigned int in_plane = g.in_h * g.in_w;
+  const unsigned int out_plane = g.out_h * g.out_w;
+
+#pragma omp parallel for if (g.in_c * in_plane >= conv_parallel_threshold)
+  for (unsigned int ci = 0; ci < g.in_c; ++ci) {
+    float *plane = in_deriv + ci * in_plane;
+    std::fill_n(plane, in_plane, 0.0f);
+
+    const unsigned int c = ci % g.group_in;
+    const unsigned int k_begin = ci / g.group_in * g.group_out;
+    for (unsigned int k = k_begin; k < k_begin + g.group_out; ++k) {
+      const float *d = deriv + k * out_plane;
+      const float *f = filter + (k * g.group_in + c) * g.k_h * g.k_w;
+
+      for (unsigned int kw = 0; kw < g.k_w; ++kw) {
+        unsigned int ow_begin, ow_end;
+        int first = g.columns(kw, ow_begin, ow_end);
+
+        for (unsigned int kh = 0; kh < g.k_h; ++kh) {
+          float wt = f[kh * g.k_w + kw];
+          for (unsigned int oh = 0; oh < g.out_h; ++oh) {
+            int ih = g.row(oh, kh);
+            if (ih < 0)
+              continue;
+
+            float *in_row = plane + ih * g.in_w;
+            const float *d_row = d + oh * g.out_w;
+            for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+              in_row[static_cast<int>(ow * g.s_w) + first] +=
+                wt * d_row[ow];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief     accumulate the gradient of the filter of the direct convolution,
+ * the output channels run in parallel
+ *
+ * @param[in] deriv incoming derivative of a batch
+ * @param[in] in input of a batch
+ * @param[out] filter_grad gradient of the filter to accumulate to
+ * @param[in] g geometry of the convolution
+ */
+static void directConvGradient(const float *deriv, const float *in,
+                               float *filter_grad, const ConvGeometry &g) {
+  const unsigned int in_plane = g.in_h * g.in_w;
+  const unsigned int out_plane = g.out_h * g.out_w;
+
+#pragma omp parallel for if (g.out_c * out_plane >= conv_parallel_threshold)
+  for (unsigned int k = 0; k < g.out_c; ++k) {
+    const float *d = deriv + k * out_plane;
+    const float *group = in + k / g.group_out * g.group_in * in_plane;
+    for (unsigned int c = 0; c < g.group_in; ++c) {
+      const float *plane = group + c * in_plane;
+      float *f = filter_grad + (k * g.group_in + c) * g.k_h * g.k_w;
+
+      for (unsigned int kw = 0; kw < g.k_w; ++kw) {
+        unsigned int ow_begin, ow_end;
+        int first = g.columns(kw, ow_begin, ow_end);
+
+        for (unsigned int kh = 0; kh < g.k_h; ++kh) {
+          float sum = 0.0f;
+          for (unsigned int oh = 0; oh < g.out_h; ++oh) {
+            int ih = g.row(oh, kh);
+            if (ih < 0)
+              continue;
+
+            const float *in_row = plane + ih * g.in_w;
+            const float *d_row = d + oh * g.out_w;
+            for (unsigned int ow = ow_begin; ow < ow_end; ++ow)
+              sum += d_row[ow] * in_row[static_cast<int>(ow * g.s_w) + first];
+          }
+          f[kh * g.k_w + kw] += sum;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief     get the channels of a group of a batch, sharing the memory
+ *
+ * @param[in] t tensor to get from, (batch, channel, height, width)
+ * @param[in] b batch index
+ * @param[in] grp group index
+ * @param[in] groups number of groups
+ * @param[in] squeeze if true, get as a (channel, height * width) matrix
+ * @return Tensor channels of the group
+ */
+static Tensor getGroup(const Tensor &t, unsigned int b, unsigned int grp,
+                       unsigned int groups, bool squeeze = false) {
+  const TensorDim &dim = t.getDim();
+  unsigned int channel = dim.channel() / groups;
+  unsigned int plane = dim.height() * dim.width();
+
+  TensorDim group_dim = squeeze
+                          ? TensorDim({channel, plane})
+                          : TensorDim(1, channel, dim.height(), dim.width());
+  return t.getSharedDataTensor(group_dim, b * dim.getFeatureLen() +
+                                            grp * channel * plane);
+}
+
+/**
+ * @brief     get the filters of a group as a (filters, feature) matrix,
+ * sharing the memory
+ *
+ * @param[in] filter filter
+ * @param[in] filter_dim dimension of the filter, (filters, channel of a
+ * group, kernel height, kernel width)
+ * @param[in] grp group index
+ * @param[in] groups number of groups
+ * @return Tensor filters of the group
+ */
+static Tensor getFilterGroup(const Tensor &filter, const TensorDim &filter_dim,
+                             unsigned int grp, unsigned int groups) {
+  unsigned int filters = filter_dim.batch() / groups;
+  unsigned int feature_len = filter_dim.getFeatureLen();
+  return filter.getSharedDataTensor({filters, feature_len},
+                                    grp * filters * feature_len);
+}
+
+/**
+ * @brief     get the column matrix of a group of a batch from the im2col
+ * cache, sharing the memory
+ *
+ * @param[in] cache im2col cache, (batch, groups, output plane, feature)
+ * @param[in] b batch index
+ * @param[in] grp group index
+ * @param[in] groups number of groups
+ * @return Tensor column matrix of the group
+ */
+static Tensor getIm2ColCache(const Tensor &cache, unsigned int b,
+                             unsigned int grp, unsigned int groups) {
+  const TensorDim &dim = cache.getDim();
+  unsigned int size = dim.height() * dim.width();
+  return cache.getSharedDataTensor({dim.height(), dim.width()},
+                                   (b * groups + grp) * size);
+}
+
+/**
+ * @brief     get the size of the workspace of the winograd convolution
+ *
+ * @param[in] g geometry of the convolution
+ * @return unsigned int number of floats in the workspace
+ */
+static unsigned int winogradWorkspaceSize(const ConvGeometry &g) {
+  unsigned int tiles = ((g.out_h + 1) / 2) * ((g.out_w + 1) / 2);
+  unsigned int block = std::min(tiles, winograd_tile_block);
+  return 16 * (g.out_c * g.in_c + (g.in_c + g.out_c) * block);
+}
+
+/**
+ * @brief     transform the 3x3 filter to U = G g G^T of winograd F(2x2, 3x3)
+ *
+ * @param[in] filter filter
+ * @param[out] u transformed filter, 16 matrices of out_c x in_c
+ * @param[in] g geometry of the convolution
+ */
+static void winogradFilterTransform(const float *filter, float *u,
+                                    const ConvGeometry &g) {
+  const unsigned int stride = g.out_c * g.in_c;
+  for (unsigned int k = 0; k < g.out_c; ++k) {
+    for (unsigned int c = 0; c < g.in_c; ++c) {
+      const float *f = filter + (k * g.in_c + c) * 9;
+      float gg[4][3];
+      for (unsigned int j = 0; j < 3; ++j) {
+        gg[0][j] = f[j];
+        gg[1][j] = 0.5f * (f[j] + f[3 + j] + f[6 + j]);
+        gg[2][j] = 0.5f * (f[j] - f[3 + j] + f[6 + j]);
+        gg[3][j] = f[6 + j];
+      }
+
+      float *dst = u + k * g.in_c + c;
+      for (unsigned int i = 0; i < 4; ++i) {
+        dst[(i * 4 + 0) * stride] = gg[i][0];
+        dst[(i * 4 + 1) * stride] = 0.5f * (gg[i][0] + gg[i][1] + gg[i][2]);
+        dst[(i * 4 + 2) * stride] = 0.5f * (gg[i][0] - gg[i][1] + gg[i][2]);
+        dst[(i * 4 + 3) * stride] = gg[i][2];
+      }
+    }
+  }
+}
+
+/**
+ * @brief     convolution of a 3x3 kernel of stride 1 by winograd F(2x2, 3x3).
+ * The output is computed by 2x2 tiles, each from a 4x4 input tile, and the 16
+ * elementwise products of the transformed tiles are batched to 16 gemms
+ *
+ * @param[in] in input of a batch
+ * @param[in] u transformed filter
+ * @param[out] out output of a batch
+ * @param[in] workspace workspace after the transformed filter
+ * @param[in] g geometry of the convolution
+ */
+static void winogradConv(const float *in, const float *u, float *out,
+                         float *workspace, const ConvGeometry &g) {
+  const unsigned int tiles_w = (g.out_w + 1) / 2;
+  const unsigned int tiles = ((g.out_h + 1) / 2) * tiles_w;
+  const unsigned int in_plane = g.in_h * g.in_w;
+  const unsigned int out_plane = g.out_h * g.out_w;
+  const bool parallel = g.out_c * out_plane >= conv_parallel_threshold;
+
+  float *v = workspace;
+  float *m = v + 16 * g.in_c * std::min(tiles, winograd_tile_block);
+
+  for (unsigned int t0 = 0; t0 < tiles; t0 += winograd_tile_block) {
+    const unsigned int block = std::min(winograd_tile_block, tiles - t0);
+
+    /// V = B^T d B for every input tile
+#pragma omp parallel for if (parallel)
+    for (unsigned int c = 0; c < g.in_c; ++c) {
+      const float *plane = in + c * in_plane;
+      for (unsigned int b = 0; b < block; ++b) {
+        int h0 = static_cast<int>((t0 + b) / tiles_w * 2) - g.pt;
+        int w0 = static_cast<int>((t0 + b) % tiles_w * 2) - g.pl;
+
+        float d[4][4];
+        for (int i = 0; i < 4; ++i) {
+          for (int j = 0; j < 4; ++j) {
+            int h = h0 + i, w = w0 + j;
+            bool inside = 0 <= h && h < static_cast<int>(g.in_h) && 0 <= w &&
+                          w < static_cast<int>(g.in_w);
+            d[i][j] = inside ? plane[h * g.in_w + w] : 0.0f;
+          }
+        }
+
+        float bd[4][4];
+        for (int j = 0; j < 4; ++j) {
+          bd[0][j] = d[0][j] - d[2][j];
+          bd[1][j] = d[1][j] + d[2][j];
+          bd[2][j] = d[2][j] - d[1][j];
+          bd[3][j] = d[1][j] - d[3][j];
+        }
+
+        float *dst = v + c * block + b;
+        const unsigned int stride = g.in_c * block;
+        for (int i = 0; i < 4; ++i) {
+          dst[(i * 4 + 0) * stride] = bd[i][0] - bd[i][2];
+          dst[(i * 4 + 1) * stride] = bd[i][1] + bd[i][2];
+          dst[(i * 4 + 2) * stride] = bd[i][2] - bd[i][1];
+          dst[(i * 4 + 3) * stride] = bd[i][1] - bd[i][3];
+        }
+      }
+    }
+
+    /// M = U V for each of the 16 elements of the tiles
+    for (unsigned int e = 0; e < 16; ++e) {
+      sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, g.out_c, block, g.in_c,
+            1.0f, u + e * g.out_c * g.in_c, g.in_c, v + e * g.in_c * block,
+            block, 0.0f, m + e * g.out_c * block, block);
+    }
+
+    /// Y = A^T M A for every output tile
+#pragma omp parallel for if (parallel)
+    for (unsigned int k = 0; k < g.out_c; ++k) {
+      float *o = out + k * out_plane;
+      const unsigned int stride = g.out_c * block;
+      for (unsigned int b = 0; b < block; ++b) {
+        const float *src = m + k * block + b;
+        float am[2][4];
+        for (int j = 0; j < 4; ++j) {
+          am[0][j] = src[j * stride] + src[(4 + j) * stride] +
+                     src[(8 + j) * stride];
+          am[1][j] = src[(4 + j) * stride] - src[(8 + j) * stride] -
+                     src[(12 + j) * stride];
+        }
+
+        unsigned int oh = (t0 + b) / tiles_w * 2;
+        unsigned int ow = (t0 + b) % tiles_w * 2;
+        for (unsigned int i = 0; i < 2 && oh + i < g.out_h; ++i) {
+          float *out_row = o + (oh + i) * g.out_w + ow;
+          out_row[0] = am[i][0] + am[i][1] + am[i][2];
+          if (ow + 1 < g.out_w)
+            out_row[1] = am[i][1] - am[i][2] - am[i][3];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief     select the algorithm of the convolution
+ *
+ * @param[in] requested algorithm requested by the property
+ * @param[in] in_dim input dimension
+ * @param[in] kdim kernel dimension
+ * @param[in] padding padding
+ * @param[in] stride stride
+ * @param[in] groups number of groups
+ * @return props::ConvAlgorithmInfo::Enum algorithm to run
+ * @throw std::invalid_argument if the requested algorithm does not support
+ * the shape
+ */
+static props::ConvAlgorithmInfo::Enum
+selectConvAlgorithm(props::ConvAlgorithmInfo::Enum requested,
+                    const TensorDim &in_dim, const TensorDim &kdim,
+                    const std::array<unsigned int, 4> &padding,
+                    const std::array<props::Stride, CONV2D_DIM> &stride,
+                    unsigned int groups) {
+  using Algorithm = props::ConvAlgorithmInfo::Enum;
+
+  bool unit_stride = stride[0].get() == 1u && stride[1].get() == 1u;
+  bool no_padding =
+    std::all_of(padding.begin(), padding.end(), [](auto p) { return p == 0; });
+  bool supports_gemm = kdim.height() == 1 && kdim.width() == 1 &&
+                       unit_stride && no_padding && groups == 1;
+  bool supports_winograd =
+    kdim.height() == 3 && kdim.width() == 3 && unit_stride && groups == 1;
+
+  switch (requested) {
+  case Algorithm::gemm:
+    NNTR_THROW_IF(!supports_gemm, std::invalid_argument)
+      << "gemm convolution requires 1x1 kernel, stride 1, no padding and a "
+         "single group";
+    return requested;
+  case Algorithm::winograd:
+    NNTR_THROW_IF(!supports_winograd, std::invalid_argument)
+      << "winograd convolution requires 3x3 kernel, stride 1 and a single "
+         "group";
+    return requested;
+  case Algorithm::im2col:
+  case Algorithm::direct:
+    return requested;
+  default:
+    break;
+  }
+
+  /// kernel channel is the input channels of a group, 1 if depthwise
+  if (supports_gemm)
+    return Algorithm::gemm;
+  if (kdim.channel() <= direct_max_channel)
+    return Algorithm::direct;
+  if (supports_winograd && in_dim.channel() >= winograd_min_channel &&
+      kdim.batch() >= winograd_min_channel)
+    return Algorithm::winograd;
+  return Algorithm::im2col;
+}
+
 } // namespace
 
-enum ConvParams { weight, bias, inter_result };
+enum ConvParams { weight, bias, inter_result, workspace, im2col_cache };
 
 Conv2DLayer::Conv2DLayer(
   const std::array<unsigned int, CONV2D_DIM * 2> &padding_) :
   LayerImpl(),
   padding(padding_),
   conv_props(props::FilterSize(), std::array<props::KernelSize, CONV2D_DIM>(),
-             std::array<props::Stride, CONV2D_DIM>(), props::Padding2D()) {
+             std::array<props::Stride, CONV2D_DIM>(), props::Padding2D(),
+             props::ConvAlgorithm(), props::Groups(), props::Im2ColCache()),
+  algorithm(props::ConvAlgorithmInfo::Enum::im2col) {
   wt_idx.fill(std::numeric_limits<unsigned>::max());
 }
 
@@ -274,9 +769,17 @@ void Conv2DLayer::finalize(InitLayerContext &context) {
   auto &kernel_size =
     std::get<std::array<props::KernelSize, CONV2D_DIM>>(conv_props);
   auto &stride = std::get<std::array<props::Stride, CONV2D_DIM>>(conv_props);
+  unsigned int groups = std::get<props::Groups>(conv_props);
+
+  NNTR_THROW_IF(in_dim.channel() % groups != 0 || filter_size % groups != 0,
+                std::invalid_argument)
+    << "[Conv2D] input channel: " << in_dim.channel()
+    << " and filters: " << filter_size
+    << " must be divisible by groups: " << groups;
 
-  TensorDim dim =
-    TensorDim(filter_size, in_dim.channel(), kernel_size[0], kernel_size[1]);
+  /// each filter only sees the input channels of its group
+  TensorDim dim = TensorDim(filter_size, in_dim.channel() / groups,
+                            kernel_size[0], kernel_size[1]);
   TensorDim bias_dim = TensorDim(1, filter_size, 1, 1);
 
   padding = std::get<props::Padding2D>(conv_props)
@@ -317,19 +820,52 @@ void Conv2DLayer::finalize(InitLayerContext &context) {
       "Failed to initialize: Calculated patch end is over int max");
   }
 
+  algorithm = selectConvAlgorithm(
+    std::get<props::ConvAlgorithm>(conv_props).get(), in_dim, dim, padding,
+    stride, groups);
+
   /**
    * @note: although col2im and im2col dims are different, the size of their
    * memories is same. If requested separately, both im2col and col2im result
    * memories will be valid in backwarding but used mutually exclusively.
-   * So, requested both commonly.
+   * So, requested both commonly. With groups, it holds a single group.
    *
-   * @todo: the request has been split to forward and backward to allow reusing
-   * this memory in between. This requires another setZero() in backwarding
-   * which will be expensive.
+   * @note: winograd only unrolls the patches in backwarding, so the memory is
+   * requested for backwarding only and the forwarding requests the workspace
+   * it actually needs. gemm and direct need none.
    */
-  wt_idx[ConvParams::inter_result] = context.requestTensor(
-    calcCol2ImOutputDim(out_dim, dim), "inter_result",
-    Tensor::Initializer::NONE, false, TensorLifespan::ITERATION_LIFESPAN);
+  if (isIm2ColCached()) {
+    /**
+     * the unrolled input of every batch and group lives from forwarding to
+     * calcGradient, and only col2im of calcDerivative needs inter_result.
+     * With the lifespans, the planner may reuse either memory elsewhere.
+     */
+    wt_idx[ConvParams::im2col_cache] = context.requestTensor(
+      TensorDim(in_dim.batch(), groups, out_dim.height() * out_dim.width(),
+                dim.getFeatureLen()),
+      "im2col_cache", Tensor::Initializer::NONE, false,
+      TensorLifespan::FORWARD_GRAD_LIFESPAN);
+    wt_idx[ConvParams::inter_result] = context.requestTensor(
+      calcCol2ImOutputDim(out_dim, dim), "inter_result",
+      Tensor::Initializer::NONE, false, TensorLifespan::CALC_DERIV_LIFESPAN);
+  } else if (algorithm == props::ConvAlgorithmInfo::Enum::im2col) {
+    wt_idx[ConvParams::inter_result] = context.requestTensor(
+      calcCol2ImOutputDim(out_dim, dim), "inter_result",
+      Tensor::Initializer::NONE, false, TensorLifespan::ITERATION_LIFESPAN);
+  } else if (algorithm == props::ConvAlgorithmInfo::Enum::winograd) {
+    wt_idx[ConvParams::inter_result] = context.requestTensor(
+      calcCol2ImOutputDim(out_dim, dim), "inter_result",
+      Tensor::Initializer::NONE, false, TensorLifespan::BACKWARD_FUNC_LIFESPAN);
+  }
+
+  if (algorithm == props::ConvAlgorithmInfo::Enum::winograd) {
+    ConvGeometry g(in_dim, out_dim, dim, padding, stride);
+    wt_idx[ConvParams::workspace] = context.requestTensor(
+      TensorDim({winogradWorkspaceSize(g)}), "winograd_workspace",
+      Tensor::Initializer::NONE, false, TensorLifespan::FORWARD_FUNC_LIFESPAN);
+  }
+
+  epilogue.finalize(context, out_dim, 1);
 }
 
 void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
@@ -343,6 +879,14 @@ void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
 
   Tensor &filter_kernel = context.getWeight(wt_idx[ConvParams::weight]);
 
+  Tensor *bias_kernel = nullptr;
+  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+      disable_bias.empty() || disable_bias.get() == false) {
+    bias_kernel = &context.getWeight(wt_idx[ConvParams::bias]);
+  }
+
+  epilogue.fold(context, filter_kernel, 0, bias_kernel);
+
   /** Calculate Convolution 2D
    *
    * This is the 2D Matrix Shape [ height ] x [ width ]
@@ -387,41 +931,86 @@ void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
 
   filter_kernel.reshape(filter_dim_squeezed);
 
-  Tensor &im2col_result = context.getTensor(wt_idx[ConvParams::inter_result]);
-  /**
-   * @todo im2col_result lifespan can be epoch and then setZero can be done
-   * just once at the start of training then every iteration
-   *
-   * @todo even better, allocate in_sub with pad, and set stride for in_sub
-   * appropriately
-   */
-  /**
-   * Below sets the pad area values to zero
-   * it is faster to do this way than seting selective area to zero
-   */
-  im2col_result.setZero();
-  for (unsigned int b = 0; b < in_dim.batch(); ++b) {
-    Tensor out = hidden_.getBatchSlice(b, 1);
-    out.reshape({filter_size, out_dim.width() * out_dim.height()});
+  const unsigned int groups = std::get<props::Groups>(conv_props);
+  ConvGeometry g(in_dim, out_dim, filter_dim, padding, stride, groups);
 
-    Tensor in_sub = input_.getBatchSlice(b, 1);
+  switch (algorithm) {
+  case props::ConvAlgorithmInfo::Enum::gemm:
+    /// the input of a batch already is the column matrix
+    for (unsigned int b = 0; b < in_dim.batch(); ++b) {
+      Tensor out = hidden_.getBatchSlice(b, 1);
+      out.reshape({filter_size, out_dim.width() * out_dim.height()});
 
-    im2col(in_sub, filter_dim, padding, stride, {1, 1}, im2col_result);
-    filter_kernel.dot(im2col_result, out, false, true);
+      Tensor in_sub = input_.getBatchSlice(b, 1);
+      in_sub.reshape({in_dim.channel(), in_dim.width() * in_dim.height()});
+      filter_kernel.dot(in_sub, out, false, false);
+    }
+    break;
+  case props::ConvAlgorithmInfo::Enum::direct:
+    for (unsigned int b = 0; b < in_dim.batch(); ++b) {
+      directConv(input_.getAddress(b, 0, 0, 0), filter_kernel.getData(),
+                 hidden_.getAddress(b, 0, 0, 0), g);
+    }
+    break;
+  case props::ConvAlgorithmInfo::Enum::winograd: {
+    float *workspace =
+      context.getTensor(wt_idx[ConvParams::workspace]).getData();
+    /// the filter may change every iteration, transformed once per forwarding
+    winogradFilterTransform(filter_kernel.getData(), workspace, g);
+    for (unsigned int b = 0; b < in_dim.batch(); ++b) {
+      winogradConv(input_.getAddress(b, 0, 0, 0), workspace,
+                   hidden_.getAddress(b, 0, 0, 0),
+                   workspace + 16 * g.out_c * g.in_c, g);
+    }
+  } break;
+  default: {
+    const bool cached = isIm2ColCached();
+    Tensor &im2col_result = context.getTensor(
+      wt_idx[cached ? ConvParams::im2col_cache : ConvParams::inter_result]);
+    /**
+     * @todo im2col_result lifespan can be epoch and then setZero can be done
+     * just once at the start of training then every iteration
+     *
+     * @todo even better, allocate in_sub with pad, and set stride for in_sub
+     * appropriately
+     */
+    /**
+     * Below sets the pad area values to zero
+     * it is faster to do this way than seting selective area to zero
+     */
+    im2col_result.setZero();
+    /// each group is a convolution of its own, a single group otherwise
+    for (unsigned int b = 0; b < in_dim.batch(); ++b) {
+      for (unsigned int grp = 0; grp < groups; ++grp) {
+        Tensor out = getGroup(hidden_, b, grp, groups, true);
+        Tensor in_sub = getGroup(input_, b, grp, groups);
+        Tensor filter_group =
+          getFilterGroup(filter_kernel, filter_dim, grp, groups);
+        Tensor col = cached ? getIm2ColCache(im2col_result, b, grp, groups)
+                            : im2col_result;
+
+        im2col(in_sub, filter_dim, padding, stride, {1, 1}, col);
+        filter_group.dot(col, out, false, true);
+      }
+    }
+  } break;
   }
 
   filter_kernel.reshape(filter_dim);
-  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
-      disable_bias.empty() || disable_bias.get() == false) {
-    Tensor &bias_kernel = context.getWeight(wt_idx[ConvParams::bias]);
-    status = hidden_.add_i(bias_kernel);
+  if (bias_kernel) {
+    status = hidden_.add_i(*bias_kernel);
     if (status != ML_ERROR_NONE) {
       throw std::invalid_argument("[Conv2D] adding bias failed");
     }
   }
+
+  epilogue.run(context, bias_kernel != nullptr, hidden_);
 }
 
 void Conv2DLayer::calcDerivative(RunLayerContext &context) {
+  NNTR_THROW_IF(!epilogue.empty(), std::runtime_error)
+    << context.getName() << " has fused layers, it supports inference only";
+
   unsigned int filter_size = std::get<props::FilterSize>(conv_props);
   auto &stride = std::get<std::array<props::Stride, CONV2D_DIM>>(conv_props);
 
@@ -435,31 +1024,71 @@ void Conv2DLayer::calcDerivative(RunLayerContext &context) {
 
   filter_kernel.reshape(filter_dim_squeezed);
 
-  /// for each batch
+  if (algorithm == props::ConvAlgorithmInfo::Enum::gemm) {
+    /// filter_kernel^T X derivative is the derivative of the input
+    for (unsigned int b = 0; b < derivative.batch(); ++b) {
+      Tensor deriv_sub = derivative.getBatchSlice(b, 1);
+      Tensor in_deriv_sub = input_derivative.getBatchSlice(b, 1);
+      deriv_sub.reshape(
+        {filter_size, derivative.width() * derivative.height()});
+      in_deriv_sub.reshape({input_derivative.channel(),
+                            input_derivative.width() *
+                              input_derivative.height()});
+      filter_kernel.dot(deriv_sub, in_deriv_sub, true, false);
+    }
+
+    filter_kernel.reshape(filter_dim);
+    return;
+  }
+
+  const unsigned int groups = std::get<props::Groups>(conv_props);
+  if (algorithm == props::ConvAlgorithmInfo::Enum::direct) {
+    ConvGeometry g(input_derivative.getDim(), derivative.getDim(), filter_dim,
+                   padding, stride, groups);
+    for (unsigned int b = 0; b < derivative.batch(); ++b) {
+      directConvDerivative(derivative.getAddress(b, 0, 0, 0),
+                           filter_kernel.getData(),
+                           input_derivative.getAddress(b, 0, 0, 0), g);
+    }
+
+    filter_kernel.reshape(filter_dim);
+    return;
+  }
+
+  /// for each batch (and group)
   /// filter_kernel^T X derivaitive  -> column matrix
   /// col2im(column matrix) to reconstruct the original image
   Tensor &col2im_result = context.getTensor(wt_idx[ConvParams::inter_result]);
   col2im_result.reshape(calcCol2ImOutputDim(derivative.getDim(), filter_dim));
 
   for (unsigned int b = 0; b < derivative.batch(); ++b) {
-    Tensor deriv_sub = derivative.getBatchSlice(b, 1);
-    Tensor in_deriv_sub = input_derivative.getBatchSlice(b, 1);
-    deriv_sub.reshape({filter_size, derivative.width() * derivative.height()});
-
-    filter_kernel.dot(deriv_sub, col2im_result, true, false);
-    col2im(col2im_result, filter_dim, padding, stride, {1, 1}, in_deriv_sub);
+    for (unsigned int grp = 0; grp < groups; ++grp) {
+      Tensor deriv_sub = getGroup(derivative, b, grp, groups, true);
+      Tensor in_deriv_sub = getGroup(input_derivative, b, grp, groups);
+      Tensor filter_group =
+        getFilterGroup(filter_kernel, filter_dim, grp, groups);
+
+      filter_group.dot(deriv_sub, col2im_result, true, false);
+      col2im(col2im_result, filter_dim, padding, stride, {1, 1},
+             in_deriv_sub);
+    }
   }
 
   filter_kernel.reshape(filter_dim);
 }
 
 void Conv2DLayer::calcGradient(RunLayerContext &context) {
+  NNTR_THROW_IF(!epilogue.empty(), std::runtime_error)
+    << context.getName() << " has fused layers, it supports inference only";
+
   unsigned int filter_size = std::get<props::FilterSize>(conv_props);
   auto &stride = std::get<std::array<props::Stride, CONV2D_DIM>>(conv_props);
 
   const Tensor &derivative = context.getIncomingDerivative(SINGLE_INOUT_IDX);
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
 
+  const unsigned int groups = std::get<props::Groups>(conv_props);
+
   Tensor &delK = context.getWeightGrad(wt_idx[ConvParams::weight]);
   delK.setZero();
 
@@ -468,29 +1097,56 @@ void Conv2DLayer::calcGradient(RunLayerContext &context) {
 
   delK.reshape(filter_dim_squeezed);
 
-  /**
-   * no need to set zero for im2col_result, as its lifespan is ITERATION,
-   * so its zero padded values will still be zero
-   */
-  Tensor &im2col_result = context.getTensor(wt_idx[ConvParams::inter_result]);
   TensorDim out_dim_squeezed{filter_size,
                              derivative.width() * derivative.height()};
 
-  /// input -(im2col)-> column_matrix -> filter x (column_matrix) = output
-  /// so delK = dy x column_matrix ^ T;
-  for (unsigned int b = 0; b < input_.batch(); ++b) {
-    Tensor deriv_sub = derivative.getBatchSlice(b, 1);
-    deriv_sub.reshape(out_dim_squeezed);
-
-    Tensor in_sub = input_.getBatchSlice(b, 1);
+  if (algorithm == props::ConvAlgorithmInfo::Enum::gemm) {
+    /// delK = dy x input ^ T, as the input is the column matrix
+    for (unsigned int b = 0; b < input_.batch(); ++b) {
+      Tensor deriv_sub = derivative.getBatchSlice(b, 1);
+      deriv_sub.reshape(out_dim_squeezed);
 
+      Tensor in_sub = input_.getBatchSlice(b, 1);
+      in_sub.reshape({input_.channel(), input_.width() * input_.height()});
+      deriv_sub.dot(in_sub, delK, false, true, b == 0 ? 0 : 1);
+    }
+  } else if (algorithm == props::ConvAlgorithmInfo::Enum::direct) {
+    ConvGeometry g(input_.getDim(), derivative.getDim(), filter_dim, padding,
+                   stride, groups);
+    for (unsigned int b = 0; b < input_.batch(); ++b) {
+      directConvGradient(derivative.getAddress(b, 0, 0, 0),
+                         input_.getAddress(b, 0, 0, 0), delK.getData(), g);
+    }
+  } else {
     /**
-     * @todo this result can be cached from the forward iteration at the
-     * expense of memory. In this case, memory of im2col_result must be saved
-     * for the whole batch. try this while benchmarking.
+     * no need to set zero for im2col_result of im2col, as its lifespan is
+     * ITERATION, so its zero padded values will still be zero. For winograd,
+     * it is only requested for backwarding.
      */
-    im2col(in_sub, filter_dim, padding, stride, {1, 1}, im2col_result);
-    deriv_sub.dot(im2col_result, delK, false, false, b == 0 ? 0 : 1);
+    const bool cached = isIm2ColCached();
+    Tensor &im2col_result = context.getTensor(
+      wt_idx[cached ? ConvParams::im2col_cache : ConvParams::inter_result]);
+    if (algorithm != props::ConvAlgorithmInfo::Enum::im2col)
+      im2col_result.setZero();
+
+    /// input -(im2col)-> column_matrix -> filter x (column_matrix) = output
+    /// so delK = dy x column_matrix ^ T, for each group
+    for (unsigned int b = 0; b < input_.batch(); ++b) {
+      for (unsigned int grp = 0; grp < groups; ++grp) {
+        Tensor deriv_sub = getGroup(derivative, b, grp, groups, true);
+        Tensor delK_group = getFilterGroup(delK, filter_dim, grp, groups);
+
+        /// the column matrix of the forwarding is reused if cached
+        Tensor col = im2col_result;
+        if (cached) {
+          col = getIm2ColCache(im2col_result, b, grp, groups);
+        } else {
+          im2col(getGroup(input_, b, grp, groups), filter_dim, padding,
+                 stride, {1, 1}, col);
+        }
+        deriv_sub.dot(col, delK_group, false, false, b == 0 ? 0 : 1);
+      }
+    }
   }
 
   delK.reshape(filter_dim);
@@ -501,14 +1157,21 @@ void Conv2DLayer::calcGradient(RunLayerContext &context) {
   }
 }
 
+void Conv2DLayer::setBatch(RunLayerContext &context, unsigned int batch) {
+  if (isIm2ColCached())
+    context.updateTensor(wt_idx[ConvParams::im2col_cache], batch);
+}
+
 void Conv2DLayer::exportTo(Exporter &exporter,
                            const ExportMethods &method) const {
   LayerImpl::exportTo(exporter, method);
   exporter.saveResult(conv_props, method, this);
+  epilogue.exportTo(exporter, method);
 }
 
 void Conv2DLayer::setProperty(const std::vector<std::string> &values) {
   auto remain_props = loadProperties(values, conv_props);
+  remain_props = epilogue.setProperty(remain_props);
   LayerImpl::setProperty(remain_props);
 }
 
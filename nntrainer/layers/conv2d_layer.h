@@ -18,6 +18,7 @@
 #include <memory.h>
 
 #include <common_properties.h>
+#include <fused_epilogue.h>
 #include <layer_impl.h>
 
 namespace nntrainer {
@@ -73,6 +74,11 @@ public:
    */
   void calcGradient(RunLayerContext &context) override;
 
+  /**
+   * @copydoc Layer::setBatch(RunLayerContext &context, unsigned int batch)
+   */
+  void setBatch(RunLayerContext &context, unsigned int batch) override;
+
   /**
    * @copydoc Layer::exportTo(Exporter &exporter, ExportMethods method)
    */
@@ -107,12 +113,26 @@ public:
   inline static const std::string type = "conv2d";
 
 private:
+  /**
+   * @brief check if the unrolled input is kept from forwarding to
+   * calcGradient
+   */
+  bool isIm2ColCached() const {
+    return algorithm == props::ConvAlgorithmInfo::Enum::im2col &&
+           std::get<props::Im2ColCache>(conv_props).get();
+  }
+
   std::array<unsigned int, CONV2D_DIM * 2> padding;
   std::tuple<props::FilterSize, std::array<props::KernelSize, CONV2D_DIM>,
-             std::array<props::Stride, CONV2D_DIM>, props::Padding2D>
+             std::array<props::Stride, CONV2D_DIM>, props::Padding2D,
+             props::ConvAlgorithm, props::Groups, props::Im2ColCache>
     conv_props;
 
   std::array<unsigned int, 5> wt_idx; /**< indices of the weights and tensors */
+  props::ConvAlgorithmInfo::Enum
+    algorithm; /**< algorithm selected at finalize */
+  FusedEpilogue epilogue; /**< batch normalization and activation fused into
+                             this layer for inference */
 };
 
 } // namespace nntrainer
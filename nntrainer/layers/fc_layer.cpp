@@ -86,16 +86,20 @@ void FullyConnectedLayer::finalize(InitLayerContext &context) {
       context.requestWeight(bias_dim, bias_initializer, WeightRegularizer::NONE,
                             1.0f, bias_decay, "bias", true);
   }
+
+  epilogue.finalize(context, output_dims[0], 3);
 }
 
 void FullyConnectedLayer::exportTo(Exporter &exporter,
                                    const ExportMethods &method) const {
   LayerImpl::exportTo(exporter, method);
   exporter.saveResult(fc_props, method, this);
+  epilogue.exportTo(exporter, method);
 }
 
 void FullyConnectedLayer::setProperty(const std::vector<std::string> &values) {
   auto remain_props = loadProperties(values, fc_props);
+  remain_props = epilogue.setProperty(remain_props);
   LayerImpl::setProperty(remain_props);
 }
 
@@ -105,16 +109,26 @@ void FullyConnectedLayer::forwarding(RunLayerContext &context, bool training) {
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
 
-  input_.dot(weight, hidden_, false, false);
-
+  Tensor *bias = nullptr;
   if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
       disable_bias.empty() || disable_bias.get() == false) {
-    Tensor &bias = context.getWeight(weight_idx[FCParams::bias]);
-    hidden_.add_i(bias);
+    bias = &context.getWeight(weight_idx[FCParams::bias]);
   }
+
+  epilogue.fold(context, weight, 3, bias);
+
+  input_.dot(weight, hidden_, false, false);
+
+  if (bias)
+    hidden_.add_i(*bias);
+
+  epilogue.run(context, bias != nullptr, hidden_);
 }
 
 void FullyConnectedLayer::calcDerivative(RunLayerContext &context) {
+  NNTR_THROW_IF(!epilogue.empty(), std::runtime_error)
+    << context.getName() << " has fused layers, it supports inference only";
+
   Tensor &weight = context.getWeight(weight_idx[FCParams::weight]);
 
   const Tensor &derivative_ = context.getIncomingDerivative(SINGLE_INOUT_IDX);
@@ -124,6 +138,9 @@ void FullyConnectedLayer::calcDerivative(RunLayerContext &context) {
 }
 
 void FullyConnectedLayer::calcGradient(RunLayerContext &context) {
+  NNTR_THROW_IF(!epilogue.empty(), std::runtime_error)
+    << context.getName() << " has fused layers, it supports inference only";
+
   Tensor &djdw = context.getWeightGrad(weight_idx[FCParams::weight]);
 
   const Tensor &derivative_ = context.getIncomingDerivative(SINGLE_INOUT_IDX);
@@ -16,6 +16,7 @@
 #ifdef __cplusplus
 
 #include <common_properties.h>
+#include <fused_epilogue.h>
 #include <layer_impl.h>
 
 namespace nntrainer {
@@ -96,6 +97,8 @@ public:
 private:
   std::tuple<props::Unit>
     fc_props; /**< fc layer properties : unit - number of output neurons */
+  FusedEpilogue epilogue; /**< batch normalization and activation fused into
+                             this layer for inference */
   std::array<unsigned int, 2> weight_idx; /**< indices of the weights */
 };
 } // namespace nntrainer
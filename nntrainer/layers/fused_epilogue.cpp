@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   fused_epilogue.cpp
+ * @date   19 October 2026
+ * @brief  Batch normalization and activation absorbed into the layer before
+ * them for inference
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <cmath>
+#include <limits>
+
+#include <base_properties.h>
+#include <fused_epilogue.h>
+#include <layer_context.h>
+#include <nntrainer_error.h>
+#include <node_exporter.h>
+
+namespace nntrainer {
+
+enum FusedBNParams { mu, var, gamma, beta };
+
+/**
+ * @brief multiply every slice of @a t along @a axis by scale[slice index]
+ */
+static void scaleAlongAxis(Tensor &t, unsigned int axis, const float *scale) {
+  const TensorDim &dim = t.getDim();
+  unsigned int outer = 1, inner = 1;
+  for (unsigned int i = 0; i < axis; ++i)
+    outer *= dim.getTensorDim(i);
+  for (unsigned int i = axis + 1; i < TensorDim::MAXDIM; ++i)
+    inner *= dim.getTensorDim(i);
+
+  const unsigned int channel = dim.getTensorDim(axis);
+  float *data = t.getData();
+  for (unsigned int o = 0; o < outer; ++o)
+    for (unsigned int c = 0; c < channel; ++c) {
+      float *run = data + (o * channel + c) * inner;
+      for (unsigned int i = 0; i < inner; ++i)
+        run[i] *= scale[c];
+    }
+}
+
+FusedEpilogue::FusedEpilogue() :
+  channel_axis(1),
+  acti_func(ActivationType::ACT_NONE, true),
+  fusion_props(props::FusedBatchNormalization(), props::Epsilon(),
+               props::BNPARAMS_MU_INIT(), props::BNPARAMS_VAR_INIT(),
+               props::BNPARAMS_BETA_INIT(), props::BNPARAMS_GAMMA_INIT(),
+               props::FusedActivation()) {
+  wt_idx.fill(std::numeric_limits<unsigned>::max());
+}
+
+std::vector<std::string>
+FusedEpilogue::setProperty(const std::vector<std::string> &values) {
+  auto &[fused_bn, epsilon, mu_init, var_init, beta_init, gamma_init,
+         fused_act] = fusion_props;
+  auto remain_props = loadProperties(values, std::tie(fused_bn, fused_act));
+
+  /// the batch normalization properties are not of the producer unless it
+  /// absorbed a batch normalization
+  if (!hasBatchNormalization())
+    return remain_props;
+
+  return loadProperties(remain_props, std::tie(epsilon, mu_init, var_init,
+                                               beta_init, gamma_init));
+}
+
+void FusedEpilogue::exportTo(Exporter &exporter,
+                             const ExportMethods &method) const {
+  /// the batch normalization properties have defaults, export only if fused
+  if (method == ExportMethods::METHOD_STRINGVECTOR && !empty())
+    exporter.saveResult(fusion_props, method);
+}
+
+bool FusedEpilogue::hasBatchNormalization() const {
+  auto &fused_bn = std::get<props::FusedBatchNormalization>(fusion_props);
+  return !fused_bn.empty() && fused_bn.get();
+}
+
+bool FusedEpilogue::empty() const {
+  auto &fused_act = std::get<props::FusedActivation>(fusion_props);
+  return !hasBatchNormalization() &&
+         (fused_act.empty() || fused_act.get() == ActivationType::ACT_NONE);
+}
+
+void FusedEpilogue::finalize(InitLayerContext &context,
+                             const TensorDim &out_dim,
+                             unsigned int channel_axis_) {
+  channel_axis = channel_axis_;
+
+  auto &fused_act = std::get<props::FusedActivation>(fusion_props);
+  acti_func.setActiFunc(fused_act.empty() ? ActivationType::ACT_NONE
+                                          : fused_act.get());
+
+  if (!hasBatchNormalization())
+    return;
+
+  /// same as the default axis of the batch normalization layer
+  unsigned int bn_axis = out_dim.channel() > 1 ? 1 : 3;
+  NNTR_THROW_IF(bn_axis != channel_axis, std::invalid_argument)
+    << context.getName()
+    << " cannot fuse batch normalization along axis: " << bn_axis
+    << ", the output channel axis is " << channel_axis;
+
+  TensorDim dim;
+  dim.setTensorDim(channel_axis, out_dim.getTensorDim(channel_axis));
+
+  /// requested in the order of the batch normalization layer to read the
+  /// model file saved without fusion
+  wt_idx[FusedBNParams::mu] = context.requestWeight(
+    dim, std::get<props::BNPARAMS_MU_INIT>(fusion_props),
+    WeightRegularizer::NONE, 1.0f, 0.0f, "moving_mean", false);
+  wt_idx[FusedBNParams::var] = context.requestWeight(
+    dim, std::get<props::BNPARAMS_VAR_INIT>(fusion_props),
+    WeightRegularizer::NONE, 1.0f, 0.0f, "moving_variance", false);
+  wt_idx[FusedBNParams::gamma] = context.requestWeight(
+    dim, std::get<props::BNPARAMS_GAMMA_INIT>(fusion_props),
+    WeightRegularizer::NONE, 1.0f, 0.0f, "gamma", true);
+  wt_idx[FusedBNParams::beta] = context.requestWeight(
+    dim, std::get<props::BNPARAMS_BETA_INIT>(fusion_props),
+    WeightRegularizer::NONE, 1.0f, 0.0f, "beta", true);
+}
+
+void FusedEpilogue::fold(RunLayerContext &context, Tensor &weight,
+                         unsigned int weight_axis, Tensor *bias) {
+  if (!hasBatchNormalization())
+    return;
+
+  const float epsilon = std::get<props::Epsilon>(fusion_props);
+  float *mu = context.getWeight(wt_idx[FusedBNParams::mu]).getData();
+  float *var = context.getWeight(wt_idx[FusedBNParams::var]).getData();
+  float *gamma = context.getWeight(wt_idx[FusedBNParams::gamma]).getData();
+  float *beta = context.getWeight(wt_idx[FusedBNParams::beta]).getData();
+  const unsigned int channel = weight.getDim().getTensorDim(weight_axis);
+
+  /**
+   * bn(y) = y * scale + shift, where scale = gamma / sqrt(var + epsilon) and
+   * shift = beta - mu * scale. Once folded, gamma is set to sqrt(var +
+   * epsilon), mu to 0 and beta to the shift left to add, which makes scale
+   * exactly 1 and the next fold a no-op until the weights are loaded again.
+   */
+  std::vector<float> scale(channel);
+  bool folded = true;
+  for (unsigned int c = 0; c < channel; ++c) {
+    scale[c] = gamma[c] / std::sqrt(var[c] + epsilon);
+    folded = folded && scale[c] == 1.0f && mu[c] == 0.0f &&
+             (bias == nullptr || beta[c] == 0.0f);
+  }
+
+  if (folded)
+    return;
+
+  scaleAlongAxis(weight, weight_axis, scale.data());
+  float *bias_ = bias ? bias->getData() : nullptr;
+  for (unsigned int c = 0; c < channel; ++c) {
+    float shift = beta[c] - mu[c] * scale[c];
+    if (bias_) {
+      bias_[c] = bias_[c] * scale[c] + shift;
+      shift = 0.0f;
+    }
+    gamma[c] = std::sqrt(var[c] + epsilon);
+    mu[c] = 0.0f;
+    beta[c] = shift;
+  }
+}
+
+void FusedEpilogue::run(RunLayerContext &context, bool has_bias,
+                        Tensor &output) {
+  /// without a bias, the shift left in beta is added here
+  if (hasBatchNormalization() && !has_bias)
+    output.add_i(context.getWeight(wt_idx[FusedBNParams::beta]));
+
+  if (auto &fused_act = std::get<props::FusedActivation>(fusion_props);
+      !fused_act.empty() && fused_act.get() != ActivationType::ACT_NONE)
+    acti_func.run_fn(output, output);
+}
+
+} // namespace nntrainer
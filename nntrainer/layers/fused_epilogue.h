@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   fused_epilogue.h
+ * @date   19 October 2026
+ * @brief  Batch normalization and activation absorbed into the layer before
+ * them for inference
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#ifndef __FUSED_EPILOGUE_H__
+#define __FUSED_EPILOGUE_H__
+#ifdef __cplusplus
+
+#include <array>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <acti_func.h>
+#include <common_properties.h>
+
+namespace nntrainer {
+
+class Exporter;
+enum class ExportMethods;
+class InitLayerContext;
+class RunLayerContext;
+
+/**
+ * @class   FusedEpilogue
+ * @brief   Batch normalization and activation fused into a producer layer
+ * (conv2d, fully connected) by the inference fusion of the model.
+ *
+ * The producer owns the moving mean, moving variance, gamma and beta of the
+ * absorbed batch normalization, requested in the same order as the batch
+ * normalization layer does so that a saved model is read as is. The
+ * statistics are folded into the weight and the bias of the producer on the
+ * first forwarding after they change, and reset so that folding again is a
+ * no-op. The activation is applied in place on the output.
+ */
+class FusedEpilogue {
+public:
+  /**
+   * @brief Construct a new Fused Epilogue object
+   *
+   */
+  FusedEpilogue();
+
+  /**
+   * @brief Load the fusion properties
+   *
+   * @param values properties to load
+   * @return std::vector<std::string> properties which are not of the fusion
+   */
+  std::vector<std::string> setProperty(const std::vector<std::string> &values);
+
+  /**
+   * @brief Export the fusion properties if anything is fused
+   *
+   * @param exporter exporter
+   * @param method export method
+   */
+  void exportTo(Exporter &exporter, const ExportMethods &method) const;
+
+  /**
+   * @brief check if nothing is fused
+   *
+   * @retval true if neither batch normalization nor activation is fused
+   */
+  bool empty() const;
+
+  /**
+   * @brief request the weights of the fused batch normalization
+   *
+   * @param context context of the producer
+   * @param out_dim output dimension of the producer
+   * @param channel_axis channel axis of the output of the producer
+   * @throw std::invalid_argument if the batch normalization would have
+   * normalized another axis than @a channel_axis
+   */
+  void finalize(InitLayerContext &context, const TensorDim &out_dim,
+                unsigned int channel_axis);
+
+  /**
+   * @brief fold the batch normalization into the weight and the bias of the
+   * producer, if not folded yet. Called before the producer computes
+   *
+   * @param context context of the producer
+   * @param weight weight of the producer
+   * @param weight_axis axis of the weight which indexes the output channel
+   * @param bias bias of the producer, nullptr if disabled
+   */
+  void fold(RunLayerContext &context, Tensor &weight, unsigned int weight_axis,
+            Tensor *bias);
+
+  /**
+   * @brief apply the shift which could not be folded and the activation on the
+   * output. Called after the producer computes
+   *
+   * @param context context of the producer
+   * @param has_bias true if the producer has a bias
+   * @param output output of the producer
+   */
+  void run(RunLayerContext &context, bool has_bias, Tensor &output);
+
+private:
+  /**
+   * @brief check if the batch normalization is fused
+   */
+  bool hasBatchNormalization() const;
+
+  unsigned int channel_axis; /**< channel axis of the output */
+  std::array<unsigned int, 4> wt_idx; /**< indices of the fused weights */
+  ActiFunc acti_func;                 /**< fused activation */
+  std::tuple<props::FusedBatchNormalization, props::Epsilon,
+             props::BNPARAMS_MU_INIT, props::BNPARAMS_VAR_INIT,
+             props::BNPARAMS_BETA_INIT, props::BNPARAMS_GAMMA_INIT,
+             props::FusedActivation>
+    fusion_props;
+};
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __FUSED_EPILOGUE_H__ */
@@ -54,15 +54,13 @@ void grucell_forwarding(const unsigned int unit, const unsigned int batch_size,
   Tensor memory_cell =
     zrg.getSharedDataTensor({batch_size, 1, 1, unit}, 2 * unit, false);
 
-  Tensor weight_hh_update_reset_gate;
-  Tensor weight_hh_memory_cell;
-  weight_hh_update_reset_gate.copy_with_stride(
-    weight_hh.getSharedDataTensor({unit, 2 * unit}, 0, false));
-  weight_hh_memory_cell.copy_with_stride(
-    weight_hh.getSharedDataTensor({unit, unit}, 2 * unit, false));
-
-  update_reset_gate.add_i_strided(
-    prev_hidden_state.dot(weight_hh_update_reset_gate));
+  const Tensor weight_hh_update_reset_gate =
+    weight_hh.getSharedDataTensor({unit, 2 * unit}, 0, false);
+  const Tensor weight_hh_memory_cell =
+    weight_hh.getSharedDataTensor({unit, unit}, 2 * unit, false);
+
+  prev_hidden_state.dot(weight_hh_update_reset_gate, update_reset_gate, false,
+                        false, 1.0f);
   if (!disable_bias) {
     if (integrate_bias) {
       const Tensor bias_h_update_reset_gate =
@@ -97,7 +95,7 @@ void grucell_forwarding(const unsigned int unit, const unsigned int batch_size,
     memory_cell.add_i_strided(temp);
   } else {
     reset_gate.multiply_strided(prev_hidden_state, temp);
-    memory_cell.add_i_strided(temp.dot(weight_hh_memory_cell));
+    temp.dot(weight_hh_memory_cell, memory_cell, false, false, 1.0f);
     if (!disable_bias && !integrate_bias) {
       const Tensor bias_hh_memory_cell =
         bias_hh.getSharedDataTensor({unit}, 2 * unit);
@@ -169,16 +167,12 @@ void grucell_calcGradient(
   Tensor d_update_reset_gate = d_zrg.getSharedDataTensor(
     {batch_size, 1, 1, 2 * unit}, 0, false); // d_update_gate+d_reset_gate
 
-  Tensor weight_hh_memory_cell;
-  weight_hh_memory_cell.copy_with_stride(
-    weight_hh.getSharedDataTensor({unit, unit}, 2 * unit, false));
-  Tensor weight_hh_update_reset_gate;
-  weight_hh_update_reset_gate.copy_with_stride(
-    weight_hh.getSharedDataTensor({unit, 2 * unit}, 0, false));
+  const Tensor weight_hh_memory_cell =
+    weight_hh.getSharedDataTensor({unit, unit}, 2 * unit, false);
+  const Tensor weight_hh_update_reset_gate =
+    weight_hh.getSharedDataTensor({unit, 2 * unit}, 0, false);
 
   Tensor temp = Tensor(batch_size, 1, 1, unit);
-  Tensor d_memory_cell_contiguous;
-  d_memory_cell_contiguous.copy_with_stride(d_memory_cell);
 
   if (reset_after) {
     prev_hidden_state.dot(weight_hh_memory_cell, temp);
@@ -187,12 +181,12 @@ void grucell_calcGradient(
         bias_hh.getSharedDataTensor({unit}, 2 * unit);
       temp.add_i(bias_hh_memory_cell);
     }
-    d_memory_cell_contiguous.multiply_strided(
+    d_memory_cell.multiply_strided(
       temp, d_reset_gate); // d_reset_gate = d15
 
-    // reset temp: d_memory_cell_contiguous * reset_gate for
+    // reset temp: d_memory_cell * reset_gate for
     // d_bias_hh_memory_cell, d_prev_hidden_state and d_weight_hh_memory_cell
-    d_memory_cell_contiguous.multiply_strided(reset_gate, temp);
+    d_memory_cell.multiply_strided(reset_gate, temp);
     if (!disable_bias && !integrate_bias) {
       Tensor d_bias_hh_memory_cell =
         d_bias_hh.getSharedDataTensor({unit}, 2 * unit);
@@ -200,8 +194,7 @@ void grucell_calcGradient(
     }
     temp.dot(weight_hh_memory_cell, d_prev_hidden_state, false, true,
              1.0); // d_prev_hidden_state = d1 + d14
-    d_weight_hh_memory_cell.add_i_strided(
-      prev_hidden_state.dot(temp, true, false));
+    prev_hidden_state.dot(temp, d_weight_hh_memory_cell, true, false, 1.0f);
   } else {
     if (!disable_bias && !integrate_bias) {
       Tensor d_bias_hh_memory_cell =
@@ -209,15 +202,14 @@ void grucell_calcGradient(
       d_memory_cell.sum(0, d_bias_hh_memory_cell, 1.0, 1.0);
     }
 
-    d_memory_cell_contiguous.dot(weight_hh_memory_cell, temp, false, true);
+    d_memory_cell.dot(weight_hh_memory_cell, temp, false, true);
     temp.multiply_strided(prev_hidden_state, d_reset_gate);
     temp.multiply_strided(reset_gate, d_prev_hidden_state, 1.0f);
 
     // reset temp: reset_gate * prev_hidden_state for and
     // d_weight_hh_memory_cell
     reset_gate.multiply_strided(prev_hidden_state, temp);
-    d_weight_hh_memory_cell.add_i_strided(
-      temp.dot(d_memory_cell_contiguous, true, false));
+    temp.dot(d_memory_cell, d_weight_hh_memory_cell, true, false, 1.0f);
   }
 
   recurrent_acti_func.run_prime_fn(reset_gate, d_reset_gate,
@@ -235,14 +227,12 @@ void grucell_calcGradient(
     }
   }
 
-  Tensor d_update_reset_gate_contiguous;
-  d_update_reset_gate_contiguous.copy_with_stride(d_update_reset_gate);
-  d_weight_hh_update_reset_gate.add_i_strided(
-    prev_hidden_state.dot(d_update_reset_gate_contiguous, true, false));
+  prev_hidden_state.dot(d_update_reset_gate, d_weight_hh_update_reset_gate,
+                        true, false, 1.0f);
   input.dot(d_zrg, d_weight_ih, true, false, 1.0f);
-  d_update_reset_gate_contiguous.dot(
-    weight_hh_update_reset_gate, d_prev_hidden_state, false, true,
-    1.0); // d_prev_hidden_state = d1 + d14 + d12 + d17
+  d_update_reset_gate.dot(weight_hh_update_reset_gate, d_prev_hidden_state,
+                          false, true,
+                          1.0); // d_prev_hidden_state = d1 + d14 + d12 + d17
 }
 
 enum GRUCellParams {
@@ -459,8 +449,14 @@ void GRUCellLayer::calcGradient(RunLayerContext &context) {
   const Tensor &input = context.getInput(INOUT_INDEX::INPUT);
   const Tensor &prev_hidden_state =
     context.getInput(INOUT_INDEX::INPUT_HIDDEN_STATE);
+  /// the derivatives of the states which are not from a backwarded layer
+  /// are computed to a scratch
+  Tensor d_prev_hidden_state_scratch;
   Tensor &d_prev_hidden_state =
-    context.getOutgoingDerivative(INOUT_INDEX::INPUT_HIDDEN_STATE);
+    context.inputHasGradient(INOUT_INDEX::INPUT_HIDDEN_STATE)
+      ? context.getOutgoingDerivative(INOUT_INDEX::INPUT_HIDDEN_STATE)
+      : (d_prev_hidden_state_scratch = Tensor(
+           prev_hidden_state.getDim(), true, Tensor::Initializer::ZEROS));
   const Tensor &incoming_derivative =
     context.getIncomingDerivative(INOUT_INDEX::OUTPUT);
 
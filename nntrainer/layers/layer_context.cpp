@@ -41,10 +41,12 @@ InitLayerContext::InitLayerContext(const std::vector<TensorDim> &dim,
                                    const std::vector<bool> &req_out_connected,
                                    bool in_place_, const std::string &n,
                                    const std::string &prefix_,
-                                   const float max_norm) :
+                                   const float max_norm,
+                                   const float lr_multiplier) :
   input_dim(dim),
   in_place(in_place_),
   clip_by_global_norm(max_norm),
+  lr_multiplier(lr_multiplier),
   output_specs(),
   req_out_is_connected(req_out_connected),
   name(n),
@@ -47,11 +47,13 @@ public:
    * @param name name
    * @param prefix_ prefix
    * @param max_norm max norm
+   * @param lr_multiplier multiplier of the learning rate of the weights
    */
   InitLayerContext(const std::vector<TensorDim> &dim,
                    const std::vector<bool> &req_out_connected, bool in_place_,
                    const std::string &n = "", const std::string &prefix_ = "",
-                   const float max_norm = 0.0);
+                   const float max_norm = 0.0,
+                   const float lr_multiplier = 1.0);
 
   /**
    * @brief   get name by the layer
@@ -131,7 +133,7 @@ public:
                              const float decay, const std::string &name,
                              bool trainable = true) {
     weights_spec.emplace_back(dim, init, reg, reg_const, decay,
-                              clip_by_global_norm, trainable,
+                              clip_by_global_norm, lr_multiplier, trainable,
                               prefix + ":" + name);
     return weights_spec.size() - 1;
   }
@@ -287,6 +289,7 @@ private:
   std::vector<TensorDim> input_dim; /**< Input dimensions for the layer */
   bool in_place;             /**< if the layer is expected to run in-place */
   float clip_by_global_norm; /**< max norm value for clip by norm */
+  float lr_multiplier;       /**< multiplier of the learning rate */
 
   std::vector<VarGradSpecV2> output_specs; /**< Specification for the output */
   std::vector<WeightSpec> weights_spec;    /**< Specification for the weights */
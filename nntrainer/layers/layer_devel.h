@@ -239,6 +239,14 @@ public:
    * @return true if supports backwarding, else false
    */
   virtual bool supportBackwarding() const = 0;
+
+  /**
+   * @brief  notify the layer that its weights are replaced as a whole, eg. read
+   * from a file
+   * @param     context Context of the layer
+   * @details layers keeping values derived from their weights renew them here
+   */
+  virtual void weightsLoaded(RunLayerContext &context) {}
 };
 
 /// @todo Decide where to put and how to implement(#986)
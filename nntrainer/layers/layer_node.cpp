@@ -163,7 +163,8 @@ LayerNode::LayerNode(std::unique_ptr<nntrainer::Layer> &&l) :
   run_context(nullptr),
   layer_node_props(
     new PropsType(props::Name(), props::Distribute(), props::Trainable(), {},
-                  {}, props::SharedFrom(), props::ClipGradByGlobalNorm())),
+                  {}, props::SharedFrom(), props::ClipGradByGlobalNorm(),
+                  props::LearningRateMultiplier())),
   layer_node_props_realization(
     new RealizationPropsType(props::Flatten(), props::Activation())),
   loss(new props::Loss()),
@@ -434,6 +435,7 @@ void LayerNode::read(std::ifstream &file, bool opt_var) {
         run_context->getWeight(i).read(file);
       }
     }
+    getLayer()->weightsLoaded(*run_context);
   }
 }
 
@@ -540,6 +542,12 @@ InitLayerContext LayerNode::finalize(const std::vector<TensorDim> &input_dims) {
   if (!std::get<props::ClipGradByGlobalNorm>(*layer_node_props).empty())
     max_norm = std::get<props::ClipGradByGlobalNorm>(*layer_node_props).get();
 
+  /** the multiplier is resolved once here and kept with the weights */
+  float lr_multiplier = 1.0;
+  if (!std::get<props::LearningRateMultiplier>(*layer_node_props).empty())
+    lr_multiplier =
+      std::get<props::LearningRateMultiplier>(*layer_node_props).get();
+
   std::vector<bool> out_info;
   out_info.reserve(output_connections.size());
   std::transform(output_connections.begin(), output_connections.end(),
@@ -552,7 +560,8 @@ InitLayerContext LayerNode::finalize(const std::vector<TensorDim> &input_dims) {
   }
   auto init_context = InitLayerContext(actual_input_dims, out_info,
                                        executeInPlace() != InPlace::NONE,
-                                       getName(), scope, max_norm);
+                                       getName(), scope, max_norm,
+                                       lr_multiplier);
 
   layer->finalize(init_context);
 
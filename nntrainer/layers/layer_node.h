@@ -51,6 +51,7 @@ class Activation;
 class SharedFrom;
 class InputConnection;
 class ClipGradByGlobalNorm;
+class LearningRateMultiplier;
 } // namespace props
 
 /**
@@ -767,7 +768,8 @@ properties in the context/graph unless intended. */
   using PropsType = std::tuple<props::Name, props::Distribute, props::Trainable,
                                std::vector<props::InputConnection>,
                                std::vector<props::InputShape>,
-                               props::SharedFrom, props::ClipGradByGlobalNorm>;
+                               props::SharedFrom, props::ClipGradByGlobalNorm,
+                               props::LearningRateMultiplier>;
 
   using RealizationPropsType = std::tuple<props::Flatten, props::Activation>;
   /** these realization properties results in addition of new layers, hence
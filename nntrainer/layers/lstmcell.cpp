@@ -254,12 +254,22 @@ void LSTMCellLayer::calcGradient(RunLayerContext &context) {
   const Tensor &input = context.getInput(INOUT_INDEX::INPUT);
   const Tensor &prev_hidden_state =
     context.getInput(INOUT_INDEX::INPUT_HIDDEN_STATE);
+  /// the derivatives of the states which are not from a backwarded layer
+  /// are computed to a scratch
+  Tensor d_prev_hidden_state_scratch;
   Tensor &d_prev_hidden_state =
-    context.getOutgoingDerivative(INOUT_INDEX::INPUT_HIDDEN_STATE);
+    context.inputHasGradient(INOUT_INDEX::INPUT_HIDDEN_STATE)
+      ? context.getOutgoingDerivative(INOUT_INDEX::INPUT_HIDDEN_STATE)
+      : (d_prev_hidden_state_scratch = Tensor(
+           prev_hidden_state.getDim(), true, Tensor::Initializer::ZEROS));
   const Tensor &prev_cell_state =
     context.getInput(INOUT_INDEX::INPUT_CELL_STATE);
+  Tensor d_prev_cell_state_scratch;
   Tensor &d_prev_cell_state =
-    context.getOutgoingDerivative(INOUT_INDEX::INPUT_CELL_STATE);
+    context.inputHasGradient(INOUT_INDEX::INPUT_CELL_STATE)
+      ? context.getOutgoingDerivative(INOUT_INDEX::INPUT_CELL_STATE)
+      : (d_prev_cell_state_scratch = Tensor(
+           prev_cell_state.getDim(), true, Tensor::Initializer::ZEROS));
   const Tensor &d_hidden_state =
     context.getIncomingDerivative(INOUT_INDEX::OUTPUT_HIDDEN_STATE);
   const Tensor &cell_state = context.getOutput(INOUT_INDEX::OUTPUT_CELL_STATE);
@@ -43,7 +43,10 @@ void MultiOutLayer::calcDerivative(RunLayerContext &context) {
   Tensor &ret = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
   for (unsigned int idx = 0; idx < context.getNumOutputs(); ++idx) {
     if (idx == 0) {
-      ret.copy(context.getIncomingDerivative(idx));
+      /// the first derivative is shared with the outgoing one when in-place
+      const Tensor first = context.getIncomingDerivative(idx);
+      if (first.getData() != ret.getData())
+        ret.copy(first);
     } else {
       ret.add_i(context.getIncomingDerivative(idx));
     }
@@ -178,6 +178,18 @@ void NNStreamerLayer::finalize(InitLayerContext &context) {
   if (in_data_size != input_dim.getDataLen() * sizeof(float))
     finalizeError(ML_ERROR_INVALID_PARAMETER);
 
+  /* generate output data container, which is invoked into at every forward */
+  status = ml_tensors_data_create(out_res, &out_data_cont);
+  finalizeError(status);
+
+  size_t out_data_size;
+  status = ml_tensors_data_get_tensor_data(out_data_cont, 0, &out_data,
+                                           &out_data_size);
+  finalizeError(status);
+
+  if (out_data_size != output_dim.getDataLen() * sizeof(float))
+    finalizeError(ML_ERROR_INVALID_PARAMETER);
+
   context.setOutputDimensions({output_dim});
 }
 
@@ -188,29 +200,25 @@ void NNStreamerLayer::setProperty(const std::vector<std::string> &values) {
 }
 
 void NNStreamerLayer::forwarding(RunLayerContext &context, bool training) {
-  size_t data_size;
   Tensor &input = context.getInput(SINGLE_INOUT_IDX);
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
 
   std::copy(input.getData(), input.getData() + input.size(), (float *)in_data);
 
-  int status = ml_single_invoke(single, in_data_cont, &out_data_cont);
+  /// the output is written to the container allocated while finalizing
+  /// instead of a new one allocated by every invoke
+  int status = ml_single_invoke_fast(single, in_data_cont, out_data_cont);
   if (status != ML_ERROR_NONE)
     throw std::runtime_error("Failed to forward nnstreamer backbone");
 
+  size_t data_size;
   status =
     ml_tensors_data_get_tensor_data(out_data_cont, 0, &out_data, &data_size);
-  if (status != ML_ERROR_NONE) {
-    ml_tensors_data_destroy(out_data_cont);
-    out_data_cont = nullptr;
+  if (status != ML_ERROR_NONE)
     throw std::runtime_error("Failed to forward nnstreamer backbone");
-  }
 
-  if (data_size != hidden_.bytes()) {
-    ml_tensors_data_destroy(out_data_cont);
-    out_data_cont = nullptr;
+  if (data_size != hidden_.bytes())
     throw std::runtime_error("Output size mismatch from nnstreamer backbone.");
-  }
 
   std::copy((float *)out_data, (float *)((char *)out_data + data_size),
             hidden_.getData());
@@ -11,6 +11,7 @@
  *
  */
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 
@@ -25,6 +26,253 @@ namespace nntrainer {
 
 static constexpr size_t SINGLE_INOUT_IDX = 0;
 
+/**
+ * @brief number of elements of the input from which the planes are pooled in
+ * parallel
+ */
+static constexpr unsigned int pooling_parallel_threshold = 1u << 14;
+
+/**
+ * @brief geometry of a pooling on a single plane (one channel of one batch)
+ */
+struct PoolGeometry {
+  int in_h, in_w;   /**< input height, width */
+  int out_h, out_w; /**< output height, width */
+  int p_h, p_w;     /**< pool height, width */
+  int s_h, s_w;     /**< stride height, width */
+  int pt, pl;       /**< padding top, left */
+
+  /**
+   * @brief Construct a new Pool Geometry object
+   *
+   * @param in_dim input dimension
+   * @param out_dim output dimension
+   * @param pooling2d_props properties of the pooling layer
+   * @param padding calculated padding
+   */
+  template <typename Props>
+  PoolGeometry(const TensorDim &in_dim, const TensorDim &out_dim,
+               const Props &pooling2d_props,
+               const std::array<unsigned int, POOLING2D_DIM * 2> &padding) :
+    in_h(in_dim.height()),
+    in_w(in_dim.width()),
+    out_h(out_dim.height()),
+    out_w(out_dim.width()),
+    pt(padding[0]),
+    pl(padding[2]) {
+    auto &pool_size = std::get<std::vector<props::PoolSize>>(pooling2d_props);
+    auto &stride =
+      std::get<std::array<props::Stride, POOLING2D_DIM>>(pooling2d_props);
+    p_h = pool_size[0];
+    p_w = pool_size[1];
+    s_h = stride[0];
+    s_w = stride[1];
+  }
+
+  /**
+   * @brief get the input patch of an output element clipped to the input,
+   * rows [h0, h1) and columns [w0, w1)
+   */
+  void patch(int oh, int ow, int &h0, int &h1, int &w0, int &w1) const {
+    h0 = oh * s_h - pt;
+    w0 = ow * s_w - pl;
+    h1 = std::min(h0 + p_h, in_h);
+    w1 = std::min(w0 + p_w, in_w);
+    h0 = std::max(h0, 0);
+    w0 = std::max(w0, 0);
+  }
+
+  /**
+   * @brief check if every patch lies inside of the input
+   */
+  bool interior() const {
+    return pt == 0 && pl == 0 && (out_h - 1) * s_h + p_h <= in_h &&
+           (out_w - 1) * s_w + p_w <= in_w;
+  }
+};
+
+/**
+ * @brief pool a single plane
+ *
+ * @param in input plane
+ * @param out output plane
+ * @param helper index of the max (max) or number of the pooled elements
+ * (average) for each output, nullptr if not training
+ * @param g geometry of the pooling
+ */
+using PlaneKernel = void (*)(const float *in, float *out, int *helper,
+                             const PoolGeometry &g);
+
+/**
+ * @brief max pooling of any geometry. The index is of the first max in the
+ * patch, -1 if the patch is entirely in the padding
+ */
+static void maxPoolPlane(const float *in, float *out, int *helper,
+                         const PoolGeometry &g) {
+  for (int oh = 0; oh < g.out_h; ++oh) {
+    for (int ow = 0; ow < g.out_w; ++ow) {
+      int h0, h1, w0, w1;
+      g.patch(oh, ow, h0, h1, w0, w1);
+
+      float max_val = std::numeric_limits<float>::lowest();
+      int max_idx = -1;
+      for (int h = h0; h < h1; ++h) {
+        const float *row = in + h * g.in_w;
+        for (int w = w0; w < w1; ++w) {
+          if (max_val < row[w]) {
+            max_val = row[w];
+            max_idx = h * g.in_w + w;
+          }
+        }
+      }
+
+      *out++ = max_val;
+      if (helper)
+        *helper++ = max_idx;
+    }
+  }
+}
+
+/**
+ * @brief average pooling of any geometry, the padding is not counted
+ */
+static void averagePoolPlane(const float *in, float *out, int *helper,
+                             const PoolGeometry &g) {
+  for (int oh = 0; oh < g.out_h; ++oh) {
+    for (int ow = 0; ow < g.out_w; ++ow) {
+      int h0, h1, w0, w1;
+      g.patch(oh, ow, h0, h1, w0, w1);
+
+      float total = 0.0f;
+      for (int h = h0; h < h1; ++h) {
+        const float *row = in + h * g.in_w;
+        for (int w = w0; w < w1; ++w)
+          total += row[w];
+      }
+
+      int cnt = std::max(h1 - h0, 0) * std::max(w1 - w0, 0);
+      *out++ = total / cnt;
+      if (helper)
+        *helper++ = cnt;
+    }
+  }
+}
+
+/**
+ * @brief max pooling of P x P patches with stride S which all lie inside of
+ * the input. The patch is unrolled and, for the inference, reduced without
+ * branches so that the row is vectorized across the width
+ */
+template <int P, int S>
+static void maxPoolPlaneFixed(const float *in, float *out, int *helper,
+                              const PoolGeometry &g) {
+  for (int oh = 0; oh < g.out_h; ++oh) {
+    const float *base = in + oh * S * g.in_w;
+    float *out_row = out + oh * g.out_w;
+
+    if (helper == nullptr) {
+      for (int ow = 0; ow < g.out_w; ++ow) {
+        const float *patch = base + ow * S;
+        float max_val = patch[0];
+        for (int h = 0; h < P; ++h)
+          for (int w = 0; w < P; ++w)
+            max_val = std::max(max_val, patch[h * g.in_w + w]);
+        out_row[ow] = max_val;
+      }
+      continue;
+    }
+
+    int *helper_row = helper + oh * g.out_w;
+    for (int ow = 0; ow < g.out_w; ++ow) {
+      const float *patch = base + ow * S;
+      float max_val = patch[0];
+      int max_idx = 0;
+      for (int h = 0; h < P; ++h) {
+        for (int w = 0; w < P; ++w) {
+          if (max_val < patch[h * g.in_w + w]) {
+            max_val = patch[h * g.in_w + w];
+            max_idx = h * g.in_w + w;
+          }
+        }
+      }
+      out_row[ow] = max_val;
+      helper_row[ow] = (oh * S) * g.in_w + ow * S + max_idx;
+    }
+  }
+}
+
+/**
+ * @brief average pooling of P x P patches with stride S which all lie inside
+ * of the input
+ */
+template <int P, int S>
+static void averagePoolPlaneFixed(const float *in, float *out, int *helper,
+                                  const PoolGeometry &g) {
+  for (int oh = 0; oh < g.out_h; ++oh) {
+    const float *base = in + oh * S * g.in_w;
+    float *out_row = out + oh * g.out_w;
+    for (int ow = 0; ow < g.out_w; ++ow) {
+      const float *patch = base + ow * S;
+      float total = 0.0f;
+      for (int h = 0; h < P; ++h)
+        for (int w = 0; w < P; ++w)
+          total += patch[h * g.in_w + w];
+      out_row[ow] = total / (P * P);
+    }
+    if (helper)
+      std::fill_n(helper + oh * g.out_w, g.out_w, P * P);
+  }
+}
+
+/**
+ * @brief get the kernel to pool a plane, specialized for the 2x2 and 3x3
+ * patches with stride 2
+ *
+ * @param pooling_type type of the pooling, max or average
+ * @param g geometry of the pooling
+ * @return PlaneKernel kernel
+ */
+static PlaneKernel getPlaneKernel(props::PoolingTypeInfo::Enum pooling_type,
+                                  const PoolGeometry &g) {
+  bool is_max = pooling_type == props::PoolingTypeInfo::Enum::max;
+  bool square = g.p_h == g.p_w && g.s_h == g.s_w && g.interior();
+
+  if (square && g.s_h == 2 && g.p_h == 2)
+    return is_max ? maxPoolPlaneFixed<2, 2> : averagePoolPlaneFixed<2, 2>;
+  if (square && g.s_h == 2 && g.p_h == 3)
+    return is_max ? maxPoolPlaneFixed<3, 2> : averagePoolPlaneFixed<3, 2>;
+
+  return is_max ? maxPoolPlane : averagePoolPlane;
+}
+
+/**
+ * @brief global max pooling of a plane
+ *
+ * @param in input plane
+ * @param out output
+ * @param helper indices of every max in the plane, nullptr if not training
+ * @param len size of the plane
+ * @return unsigned int number of the max
+ */
+static unsigned int globalMaxPoolPlane(const float *in, float *out, int *helper,
+                                       unsigned int len) {
+  float max_val = std::numeric_limits<float>::lowest();
+  unsigned int max_count = 0;
+  for (unsigned int i = 0; i < len; ++i) {
+    if (in[i] > max_val) {
+      max_val = in[i];
+      max_count = 0;
+    }
+    if (in[i] == max_val) {
+      if (helper)
+        helper[max_count] = i;
+      max_count++;
+    }
+  }
+  *out = max_val;
+  return max_count;
+}
+
 Pooling2DLayer::Pooling2DLayer(
   const std::array<unsigned int, POOLING2D_DIM * 2> &padding_) :
   Layer(),
@@ -133,111 +381,106 @@ void Pooling2DLayer::forwarding(RunLayerContext &context, bool training) {
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
   Tensor &pool_helper = context.getTensor(pool_helper_idx);
+  auto &pooling_type = std::get<props::PoolingType>(pooling2d_props).get();
+
+  NNTR_THROW_IF(pooling_type == props::PoolingTypeInfo::Enum::unknown,
+                std::invalid_argument)
+    << "unknown pooling type given";
+
+  const PoolGeometry g(input_.getDim(), hidden_.getDim(), pooling2d_props,
+                       padding);
+  const unsigned int planes = input_.batch() * input_.channel();
+  const unsigned int in_plane = g.in_h * g.in_w;
+  const unsigned int out_plane = g.out_h * g.out_w;
+  const bool parallel = input_.size() >= pooling_parallel_threshold;
 
-  const TensorDim &in_dim = input_.getDim();
+  const float *in_data = input_.getData();
+  float *out_data = hidden_.getData();
+  /// the indices (or counts) are only needed for the backwarding
+  int *helper_data = training ? pool_helper.getData<int>() : nullptr;
 
-  for (unsigned int b = 0; b < in_dim.batch(); ++b) {
-    Tensor in_sub = input_.getBatchSlice(b, 1);
-    Tensor result = hidden_.getBatchSlice(b, 1);
-    Tensor helper = pool_helper.getBatchSlice(b, 1);
-    pooling2d(in_sub, training, result, helper, b);
+  if (pooling_type == props::PoolingTypeInfo::Enum::global_max) {
+#pragma omp parallel for if (parallel)
+    for (unsigned int p = 0; p < planes; ++p) {
+      pool_helper_size[p] = globalMaxPoolPlane(
+        in_data + p * in_plane, out_data + p,
+        helper_data ? helper_data + p * in_plane : nullptr, in_plane);
+    }
+    return;
+  }
+
+  PlaneKernel kernel = getPlaneKernel(pooling_type, g);
+#pragma omp parallel for if (parallel)
+  for (unsigned int p = 0; p < planes; ++p) {
+    kernel(in_data + p * in_plane, out_data + p * out_plane,
+           helper_data ? helper_data + p * out_plane : nullptr, g);
   }
 }
 
 void Pooling2DLayer::calcDerivative(RunLayerContext &context) {
-  auto &pool_size = std::get<std::vector<props::PoolSize>>(pooling2d_props);
-  auto &stride =
-    std::get<std::array<props::Stride, POOLING2D_DIM>>(pooling2d_props);
   auto &pooling_type = std::get<props::PoolingType>(pooling2d_props).get();
 
   const Tensor &deriv = context.getIncomingDerivative(SINGLE_INOUT_IDX);
   Tensor &result = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
   Tensor &pool_helper = context.getTensor(pool_helper_idx);
 
-  const TensorDim &in_dim = result.getDim();
-  unsigned int batch = in_dim.batch();
-  unsigned int channel = in_dim.channel();
-  int height = in_dim.height();
-  int width = in_dim.width();
-
-  auto pt = padding[0];
-  auto pl = padding[2];
-  unsigned int p_height = pool_size[0];
-  unsigned int p_width = pool_size[1];
-
-  unsigned int J, K;
+  const PoolGeometry g(result.getDim(), deriv.getDim(), pooling2d_props,
+                       padding);
+  const unsigned int planes = result.batch() * result.channel();
+  const unsigned int in_plane = g.in_h * g.in_w;
+  const unsigned int out_plane = g.out_h * g.out_w;
+  const bool parallel = result.size() >= pooling_parallel_threshold;
 
   result.setZero();
   float *result_data = result.getData();
-
-  unsigned int out_map_size = deriv.height() * deriv.width();
-  unsigned int in_map_size = height * width;
+  const float *deriv_data = deriv.getData();
+  const int *helper_data = pool_helper.getData<int>();
 
   switch (pooling_type) {
   case props::PoolingTypeInfo::Enum::max: {
-    const int *iter = pool_helper.getData<int>();
-    const float *deriv_data = deriv.getData();
-    for (unsigned int b = 0; b < batch; ++b) {
-      for (unsigned int c = 0; c < channel; ++c) {
-        for (unsigned int i = 0; i < out_map_size; ++i) {
-          /// pool_helper = -1 means the max idx was at the padding, so no need
-          /// to update
-          if (*iter != -1) {
-            result_data[*iter] += *deriv_data;
-          }
-          iter++;
-          deriv_data++;
-        }
-        result_data += in_map_size;
+#pragma omp parallel for if (parallel)
+    for (unsigned int p = 0; p < planes; ++p) {
+      const int *idx = helper_data + p * out_plane;
+      const float *d = deriv_data + p * out_plane;
+      float *r = result_data + p * in_plane;
+      for (unsigned int i = 0; i < out_plane; ++i) {
+        /// idx = -1 means the max idx was at the padding, so no need to update
+        if (idx[i] != -1)
+          r[idx[i]] += d[i];
       }
     }
   } break;
   case props::PoolingTypeInfo::Enum::global_average:
   case props::PoolingTypeInfo::Enum::average: {
-    int heigth_stride_end = height - p_height + pt;
-    int width_stride_end = width - p_width + pl;
-    const int *iter = pool_helper.getData<int>();
-    for (unsigned int b = 0; b < batch; ++b) {
-      for (unsigned int i = 0; i < channel; ++i) {
-        J = 0;
-        for (int j = -pt; j <= heigth_stride_end; j += stride[0]) {
-          K = 0;
-          for (int k = -pl; k <= width_stride_end; k += stride[1]) {
-            float del = deriv.getValue(b, i, J, K) / *iter;
-            int patch_height_end =
-              std::min(static_cast<int>(j + p_height), height);
-            int patch_width_end =
-              std::min(static_cast<int>(k + p_width), width);
-            int start_h = std::max(0, j);
-            int start_w = std::max(0, k);
-            for (int h = start_h; h < patch_height_end; ++h) {
-              for (int w = start_w; w < patch_width_end; ++w) {
-                result.setValue(b, i, h, w, result.getValue(b, i, h, w) + del);
-              }
-            }
-            iter++;
-            K++;
+#pragma omp parallel for if (parallel)
+    for (unsigned int p = 0; p < planes; ++p) {
+      const int *count = helper_data + p * out_plane;
+      const float *d = deriv_data + p * out_plane;
+      float *r = result_data + p * in_plane;
+      for (int oh = 0; oh < g.out_h; ++oh) {
+        for (int ow = 0; ow < g.out_w; ++ow, ++d, ++count) {
+          int h0, h1, w0, w1;
+          g.patch(oh, ow, h0, h1, w0, w1);
+          float del = *d / *count;
+          for (int h = h0; h < h1; ++h) {
+            float *row = r + h * g.in_w;
+            for (int w = w0; w < w1; ++w)
+              row[w] += del;
           }
-          J++;
         }
       }
     }
   } break;
   case props::PoolingTypeInfo::Enum::global_max: {
-    const float *deriv_data = deriv.getData();
-    for (unsigned int b = 0; b < batch; b++) {
-      for (unsigned int c = 0; c < channel; c++) {
-        const int *iter =
-          pool_helper.getData<int>() + pool_helper.getIndex(b, c, 0, 0);
-        unsigned int helper_size = pool_helper_size[b * channel + c];
-        float der = *deriv_data / helper_size;
-
-        for (unsigned int idx = 0; idx < helper_size; idx++)
-          result_data[iter[idx]] += der;
-
-        deriv_data++;
-        result_data += in_map_size;
-      }
+#pragma omp parallel for if (parallel)
+    for (unsigned int p = 0; p < planes; ++p) {
+      const int *idx = helper_data + p * in_plane;
+      unsigned int helper_size = pool_helper_size[p];
+      float der = deriv_data[p] / helper_size;
+      float *r = result_data + p * in_plane;
+
+      for (unsigned int i = 0; i < helper_size; i++)
+        r[idx[i]] += der;
     }
   } break;
   default:
@@ -257,154 +500,6 @@ void Pooling2DLayer::setProperty(const std::vector<std::string> &values) {
          std::to_string(values.size());
 }
 
-void Pooling2DLayer::pooling2d(Tensor &in, bool training, Tensor &output,
-                               Tensor &pool_helper, int batch_idx) {
-
-  auto &pool_size = std::get<std::vector<props::PoolSize>>(pooling2d_props);
-  auto &stride =
-    std::get<std::array<props::Stride, POOLING2D_DIM>>(pooling2d_props);
-  auto &pooling_type = std::get<props::PoolingType>(pooling2d_props).get();
-
-  unsigned int channel = in.channel();
-  auto [pt, pb, pl, pr] = padding;
-
-  int in_height = in.height();
-  int in_width = in.width();
-  unsigned int height = in_height + pt + pb;
-  unsigned int width = in_width + pl + pr;
-  unsigned int patch_height = pool_size[0];
-  unsigned int patch_width = pool_size[1];
-
-  NNTR_THROW_IF(output.empty(), std::invalid_argument)
-    << "[Pooling2D] output is uninitialized, this is not supported";
-
-  /**
-   * @brief pooling function
-   * @param in_c channel sliced data
-   * @param start_h (height index pointing the start of the patch)
-   * @param start_w (width index pointing the start of the patch)
-   * @return result value of pooling
-   */
-  std::function<float(const float *, int, int, int)> pool_fn;
-
-  unsigned int max_idx_count = 0;
-  switch (pooling_type) {
-  case props::PoolingTypeInfo::Enum::max: {
-    pool_fn = [&](const float *in_data, int channel_idx, int start_h,
-                  int start_w) {
-      int end_h = start_h + patch_height;
-      int end_w = start_w + patch_width;
-
-      float max_val = std::numeric_limits<float>::lowest();
-
-      int cur_max_idx = -1;
-      int eff_end_h = std::min(end_h, in_height);
-      int eff_end_w = std::min(end_w, in_width);
-      start_w = std::max(0, start_w);
-      for (int h = std::max(0, start_h); h < eff_end_h; ++h) {
-        for (int w = start_w; w < eff_end_w; ++w) {
-          int cur_idx = h * in_width + w;
-          float val = in_data[cur_idx];
-          if (max_val < val) {
-            max_val = val;
-            if (training) {
-              cur_max_idx = cur_idx;
-            }
-          }
-        }
-      }
-
-      if (training) {
-        pool_helper.setValueInt(max_idx_count++, cur_max_idx);
-      }
-
-      return max_val;
-    };
-    break;
-  }
-  case props::PoolingTypeInfo::Enum::global_max: {
-    pool_fn = [&, this](const float *in_data, int channel_idx, int start_h,
-                        int start_w) {
-      int end_h = start_h + patch_height;
-      int end_w = start_w + patch_width;
-
-      float max_val = std::numeric_limits<float>::lowest();
-      int *helper_data = pool_helper.getData<int>();
-      helper_data += channel_idx * in_height * in_width;
-
-      for (int h = start_h; h < end_h; ++h) {
-        for (int w = start_w; w < end_w; ++w) {
-          int cur_idx = h * in_width + w;
-          float val = in_data[cur_idx];
-          if (max_val < val) {
-            max_val = val;
-            max_idx_count = 0;
-          }
-
-          if (training && max_val == val) {
-            *(helper_data + max_idx_count++) = cur_idx;
-          }
-        }
-      }
-
-      pool_helper_size[batch_idx * in.channel() + channel_idx] = max_idx_count;
-      return max_val;
-    };
-    break;
-  }
-  case props::PoolingTypeInfo::Enum::global_average:
-  case props::PoolingTypeInfo::Enum::average: {
-    pool_fn = [&](const float *in_data, int channel_idx, int start_h,
-                  int start_w) {
-      int end_h = start_h + patch_height;
-      int end_w = start_w + patch_width;
-      float total = 0.0f;
-
-      int eff_end_h = std::min(end_h, in_height);
-      int eff_end_w = std::min(end_w, in_width);
-      int eff_start_h = std::max(0, start_h);
-      int eff_start_w = std::max(0, start_w);
-
-      int cnt = (eff_end_h - eff_start_h) * (eff_end_w - eff_start_w);
-      for (int h = eff_start_h; h < eff_end_h; ++h) {
-        for (int w = eff_start_w; w < eff_end_w; ++w) {
-          float val = in_data[h * in_width + w];
-          total += val;
-        }
-      }
-
-      if (training) {
-        pool_helper.setValueInt(max_idx_count++, cnt);
-      }
-      return total / cnt;
-    };
-    break;
-  }
-  case props::PoolingTypeInfo::Enum::unknown:
-  default:
-    throw std::invalid_argument("unknown pooling type given");
-    break;
-  }
-
-  const float *in_data = in.getData();
-  float *out_data = output.getData();
-
-  unsigned int map_size = in_height * in_width;
-
-  int height_stride_end = height - patch_height - pt;
-  int width_stride_end = width - patch_width - pl;
-  for (unsigned int i = 0; i < channel; ++i) {
-    const float *in_data_channel_sliced = in_data + i * map_size;
-    for (int j = -pt; j <= height_stride_end; j += stride[0]) {
-      for (int k = -pl; k <= width_stride_end; k += stride[1]) {
-        float pool_value = pool_fn(in_data_channel_sliced, i, j, k);
-        *out_data = pool_value;
-        out_data++;
-      }
-    }
-  }
-}
-
 void Pooling2DLayer::setBatch(RunLayerContext &context, unsigned int batch) {
   context.updateTensor(pool_helper_idx, batch);
   props::PoolingTypeInfo::Enum pooling_type =
@@ -118,17 +118,6 @@ private:
   std::vector<unsigned int>
     pool_helper_size; /**< helper size for each elements in the case of
                          global_max pooling */
-
-  /**
-   * @brief     calculation convolution
-   * @param[in] in input tensor (batch sliced)
-   * @param[in] training check if training, if training this will memorize index
-   * @param[in] output output tensor (batch sliced)
-   * @param[in] pool_helper helper tensor (batch sliced)
-   * @param[in] batch_idx idx of the batch
-   */
-  void pooling2d(Tensor &in, bool training, Tensor &output, Tensor &pool_helper,
-                 int batch_idx);
 };
 
 } // namespace nntrainer
@@ -102,7 +102,11 @@ void SplitLayer::forwarding(RunLayerContext &context, bool training) {
     const TensorDim out_dim = output_.getDim();
     output_.reshape(output_reshape_helper);
 
-    for (unsigned int batch = 0; batch < input_.batch(); batch++) {
+    /** outputs placed in the input by the network graph are not copied */
+    for (unsigned int batch = 0;
+         batch < input_.batch() &&
+         output_.getData() != input_.getAddress(0, 0, idx, 0);
+         batch++) {
       const Tensor source_tensor =
         Tensor::Map(input_.getAddress(batch, 0, idx, 0),
                     input_reshape_helper.width() * sizeof(float),
@@ -129,7 +133,10 @@ void SplitLayer::calcDerivative(RunLayerContext &context) {
   for (unsigned int idx = 0; idx < context.getNumOutputs(); idx++) {
     Tensor output_ = context.getIncomingDerivative(idx);
 
-    for (unsigned int batch = 0; batch < input_.batch(); batch++) {
+    for (unsigned int batch = 0;
+         batch < input_.batch() &&
+         output_.getData() != input_.getAddress(0, 0, idx, 0);
+         batch++) {
       Tensor dest_tensor =
         Tensor::Map(input_.getAddress(batch, 0, idx, 0),
                     input_reshape_helper.width() * sizeof(float),
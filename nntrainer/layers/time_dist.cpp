@@ -30,6 +30,7 @@ static void reshape(Tensor &m) {
 void TimeDistLayer::setPosition(RunLayerContext &context) {
   positions[0] = context.getInput(SINGLE_INOUT_IDX).getData();
   positions[2] = context.getOutput(SINGLE_INOUT_IDX).getData();
+  positions[1] = positions[3] = nullptr;
   /** TODO: use mode of execution here */
   try {
     positions[1] = context.getOutgoingDerivative(SINGLE_INOUT_IDX).getData();
@@ -45,12 +46,15 @@ void TimeDistLayer::transposeInOut(RunLayerContext &context) {
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
   input_.copy(transposeTensor(input_));
 
-  // Position[1] : net_input.gradient
-  Tensor &ret_ = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
-  if (ret_.getData() != positions[0]) {
-    ret_.copy(transposeTensor(ret_));
-  } else {
-    reshape(ret_);
+  // Position[1] : net_input.gradient, which is not given if the layer does
+  // not pass the derivative back
+  if (context.inputHasGradient(SINGLE_INOUT_IDX)) {
+    Tensor &ret_ = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
+    if (ret_.getData() != positions[0]) {
+      ret_.copy(transposeTensor(ret_));
+    } else {
+      reshape(ret_);
+    }
   }
 
   // Position[2] : net_hidden.variable
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   feature_cache.cpp
+ * @date   19 October 2026
+ * @brief  Cache of the features computed by the frozen layers of a model
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <algorithm>
+#include <fcntl.h>
+#include <functional>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <bn_layer.h>
+#include <data_producer.h>
+#include <dropout.h>
+#include <feature_cache.h>
+#include <input_layer.h>
+#include <layer_node.h>
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+#include <preprocess_flip_layer.h>
+#include <preprocess_translate_layer.h>
+
+namespace nntrainer {
+
+/**
+ * @brief check if the node gives the same output for the same input on every
+ * forwarding while training
+ *
+ * @param node node to check
+ * @retval true if the output of the node can be cached
+ */
+static bool isFrozen(LayerNode &node) {
+  if (node.needsCalcGradient() || node.needsCalcDerivative() ||
+      node.requireLabel())
+    return false;
+
+  auto const &type = node.getType();
+  return type != DropOutLayer::type &&
+         type != BatchNormalizationLayer::type;
+}
+
+FeatureCache::FeatureCache(const NetworkGraph &graph, unsigned int num_samples,
+                           const std::string &path) :
+  sample_len(0),
+  num_samples(num_samples),
+  data(nullptr),
+  fd(-1),
+  buf_size(0) {
+  if (num_samples == DataProducer::SIZE_UNDEFINED || num_samples == 0) {
+    ml_logw("[FeatureCache] number of samples is unknown, cache disabled");
+    return;
+  }
+
+  bool has_layer = false;
+  for (auto iter = graph.cbegin(); iter != graph.cend(); iter++) {
+    auto const &node = *iter;
+    auto const &type = node->getType();
+    if (type == PreprocessFlipLayer::type ||
+        type == PreprocessTranslateLayer::type) {
+      ml_logw("[FeatureCache] data is augmented by %s, cache disabled",
+              node->getName().c_str());
+      prefix.clear();
+      return;
+    }
+
+    bool in_prefix = isFrozen(*node);
+    for (unsigned int i = 0; i < node->getNumInputConnections() && in_prefix;
+         ++i) {
+      in_prefix = prefix.count(node->getInputConnectionName(i));
+    }
+
+    if (in_prefix) {
+      prefix.insert(node->getName());
+      has_layer = has_layer || type != InputLayer::type;
+    }
+  }
+
+  /** nothing is computed by the prefix other than feeding the input */
+  if (!has_layer) {
+    prefix.clear();
+    return;
+  }
+
+  for (auto iter = graph.cbegin(); iter != graph.cend(); iter++) {
+    auto const &node = *iter;
+    if (!prefix.count(node->getName()))
+      continue;
+
+    bool read_outside = node->getNumOutputConnections() == 0;
+    for (unsigned int i = 0; i < node->getNumOutputConnections(); ++i) {
+      auto conn = node->getOutputConnection(i);
+      read_outside = read_outside || !conn || !prefix.count(conn->getName());
+    }
+
+    if (!read_outside)
+      continue;
+
+    boundary.emplace(node->getName(), sample_len);
+    for (unsigned int i = 0; i < node->getNumOutputs(); ++i) {
+      sample_len += node->getOutput(i).getDim().getFeatureLen();
+    }
+  }
+
+  size_t len = sample_len * num_samples;
+  if (path.empty()) {
+    memory.resize(len);
+    data = memory.data();
+  } else {
+    buf_size = len * sizeof(float);
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    NNTR_THROW_IF(fd < 0, std::runtime_error)
+      << "[FeatureCache] opening file failed, path: " << path;
+
+    void *buf = MAP_FAILED;
+    if (ftruncate(fd, buf_size) == 0) {
+      buf = mmap(NULL, buf_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+
+    if (buf == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("[FeatureCache] mmap failed, path: " + path);
+    }
+    data = static_cast<float *>(buf);
+  }
+
+  cached.resize(num_samples, false);
+  ml_logi("[FeatureCache] caching %zu nodes, %zu elements per sample",
+          prefix.size(), sample_len);
+}
+
+FeatureCache::~FeatureCache() {
+  if (fd == -1)
+    return;
+
+  if (munmap(data, buf_size) < 0) {
+    ml_logw("[FeatureCache] munmap failed on destruction please check");
+  }
+
+  if (close(fd) < 0) {
+    ml_logw("[FeatureCache] closing fd failed on destruction please check");
+  }
+}
+
+void FeatureCache::copy(LayerNode &node, size_t offset,
+                        const std::vector<unsigned int> &indices, bool store) {
+  for (unsigned int i = 0; i < node.getNumOutputs(); ++i) {
+    Tensor &output = node.getOutput(i);
+    size_t len = output.getDim().getFeatureLen();
+
+    for (unsigned int b = 0; b < indices.size(); ++b) {
+      if (indices[b] >= num_samples)
+        continue;
+
+      float *row = output.getData() + b * len;
+      float *slot = data + indices[b] * sample_len + offset;
+      if (store)
+        std::copy(row, row + len, slot);
+      else
+        std::copy(slot, slot + len, row);
+    }
+
+    offset += len;
+  }
+}
+
+sharedConstTensors
+FeatureCache::forwarding(const NetworkGraph &graph, bool training,
+                         const std::vector<unsigned int> &indices) {
+  bool hit = !empty() && std::all_of(indices.begin(), indices.end(),
+                                     [this](unsigned int idx) {
+                                       return idx < num_samples && cached[idx];
+                                     });
+
+  std::function<void(std::shared_ptr<LayerNode>, bool)> forwarding_op =
+    [this, hit, &indices](std::shared_ptr<LayerNode> node,
+                          bool training) -> void {
+    if (!hit || !prefix.count(node->getName()))
+      node->forwarding(training);
+
+    if (auto iter = boundary.find(node->getName()); iter != boundary.end())
+      copy(*node, iter->second, indices, !hit);
+  };
+
+  auto out = graph.forwarding(training, forwarding_op);
+
+  if (!hit && !empty()) {
+    for (auto idx : indices) {
+      if (idx < num_samples)
+        cached[idx] = true;
+    }
+  }
+
+  return out;
+}
+
+} // namespace nntrainer
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   feature_cache.h
+ * @date   19 October 2026
+ * @brief  Cache of the features computed by the frozen layers of a model
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#ifndef __FEATURE_CACHE_H__
+#define __FEATURE_CACHE_H__
+#ifdef __cplusplus
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <network_graph.h>
+
+namespace nntrainer {
+
+/**
+ * @class   FeatureCache
+ * @brief   Cache of the outputs of the frozen prefix of the graph, keyed by
+ * the index of the sample in the data producer.
+ *
+ * The frozen prefix is the set of nodes which are neither backwarded nor fed
+ * by a backwarded node, do not take a label and are deterministic. The outputs
+ * of the prefix nodes read by the rest of the graph are stored the first time
+ * a sample is forwarded. Once every sample of a batch is cached, the prefix is
+ * skipped and the stored outputs are copied in its place.
+ *
+ * @note the cache assumes that the data producer gives the same sample for the
+ * same index. Layers which augment the data disable the cache, but
+ * augmentation done by the producer itself cannot be detected.
+ */
+class FeatureCache {
+public:
+  /**
+   * @brief Construct a new Feature Cache object
+   *
+   * @param graph compiled and initialized graph to cache the prefix of
+   * @param num_samples number of samples of the data producer
+   * @param path path of the file to map the cache to, kept in memory if empty
+   * @throw std::runtime_error if the file cannot be mapped
+   */
+  FeatureCache(const NetworkGraph &graph, unsigned int num_samples,
+               const std::string &path = "");
+
+  /**
+   * @brief Destroy the Feature Cache object
+   *
+   */
+  ~FeatureCache();
+
+  FeatureCache(const FeatureCache &rhs) = delete;
+  FeatureCache &operator=(const FeatureCache &rhs) = delete;
+
+  /**
+   * @brief check if there is nothing to cache for the graph
+   *
+   * @retval true if the cache is disabled
+   */
+  bool empty() const { return boundary.empty(); }
+
+  /**
+   * @brief forwarding the graph with the cache
+   *
+   * @param graph graph given at construction
+   * @param training true if forwarding is on training
+   * @param indices sample indices of the batch set to the graph
+   * @retval output tensors
+   */
+  sharedConstTensors forwarding(const NetworkGraph &graph, bool training,
+                                const std::vector<unsigned int> &indices);
+
+private:
+  /**
+   * @brief store or load the outputs of a boundary node
+   *
+   * @param node boundary node
+   * @param offset offset of the outputs of the node in a cached sample
+   * @param indices sample indices of the batch
+   * @param store true to store the outputs, false to load them
+   */
+  void copy(LayerNode &node, size_t offset,
+            const std::vector<unsigned int> &indices, bool store);
+
+  std::unordered_set<std::string> prefix; /**< nodes of the frozen prefix */
+  std::unordered_map<std::string, size_t>
+    boundary; /**< offset of the outputs of the prefix nodes read outside */
+  size_t sample_len;        /**< number of cached elements for a sample */
+  unsigned int num_samples; /**< number of samples */
+  std::vector<bool> cached; /**< true if the sample is cached */
+
+  std::vector<float> memory; /**< cache when kept in memory */
+  float *data;               /**< cached features */
+  int fd;                    /**< fd of the mapped file */
+  size_t buf_size;           /**< size of the mapped file */
+};
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __FEATURE_CACHE_H__ */
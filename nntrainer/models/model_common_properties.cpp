@@ -29,4 +29,12 @@ ContinueTrain::ContinueTrain(bool value) { set(value); }
 
 MemoryOptimization::MemoryOptimization(bool value) { set(value); }
 
+InferenceFusion::InferenceFusion(bool value) { set(value); }
+
+FeatureCache::FeatureCache(bool value) { set(value); }
+
+Metrics::Metrics(MetricsSinkInfo::Enum value) { set(value); }
+
+MetricsInterval::MetricsInterval(unsigned int value) { set(value); }
+
 } // namespace nntrainer::props
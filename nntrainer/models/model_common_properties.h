@@ -16,6 +16,21 @@
 #include <base_properties.h>
 
 #ifdef __cplusplus
+namespace nntrainer {
+
+/**
+ * @brief Enumeration of the sinks of the training metrics
+ *
+ */
+enum class MetricsSinkType {
+  NONE,    /**< metrics are not reported */
+  CONSOLE, /**< metrics are printed to the standard output */
+  LOG,     /**< metrics are logged */
+  RING     /**< metrics are kept to be taken with takeMetrics() */
+};
+
+} // namespace nntrainer
+
 namespace nntrainer::props {
 
 /**
@@ -126,6 +141,105 @@ public:
   MemoryOptimization(bool value = true);
 };
 
+/**
+ * @brief inference fusion property, fuses batch normalization and activation
+ * into the preceding conv2d / fully connected layers when compiled. The
+ * compiled model can only run inference
+ *
+ */
+class InferenceFusion : public Property<bool> {
+public:
+  static constexpr const char *key =
+    "inference_fusion";           /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to false
+   */
+  InferenceFusion(bool value = false);
+};
+
+/**
+ * @brief feature cache property, caches the outputs of the frozen layers at
+ * the front of the model on the first epoch and skips them afterwards
+ *
+ */
+class FeatureCache : public Property<bool> {
+public:
+  static constexpr const char *key =
+    "feature_cache";              /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to false
+   */
+  FeatureCache(bool value = false);
+};
+
+/**
+ * @brief feature cache path property, file to map the feature cache to. The
+ * cache is kept in memory if not set
+ *
+ */
+class FeatureCachePath : public Property<std::string> {
+public:
+  static constexpr const char *key =
+    "feature_cache_path";        /**< unique key to access */
+  using prop_tag = str_prop_tag; /**< property type */
+};
+
+/**
+ * @brief Enumeration of the metrics sinks
+ *
+ */
+struct MetricsSinkInfo {
+  using Enum = nntrainer::MetricsSinkType;
+  static constexpr std::initializer_list<Enum> EnumList = {
+    Enum::NONE, Enum::CONSOLE, Enum::LOG, Enum::RING};
+
+  static constexpr const char *EnumStr[] = {"none", "console", "log", "ring"};
+};
+
+/**
+ * @brief metrics property, sink the training metrics are reported to
+ *
+ */
+class Metrics final : public EnumProperty<MetricsSinkInfo> {
+public:
+  static constexpr const char *key = "metrics"; /**< unique key to access */
+  using prop_tag = enum_class_prop_tag;         /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to none
+   */
+  Metrics(MetricsSinkInfo::Enum value = MetricsSinkInfo::Enum::NONE);
+};
+
+/**
+ * @brief metrics interval property, milliseconds between the reports of the
+ * training metrics while an epoch runs
+ *
+ */
+class MetricsInterval : public PositiveIntegerProperty {
+public:
+  static constexpr const char *key =
+    "metrics_interval";           /**< unique key to access */
+  using prop_tag = uint_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to 1000
+   */
+  MetricsInterval(unsigned int value = 1000);
+};
+
 } // namespace nntrainer::props
 
 #endif
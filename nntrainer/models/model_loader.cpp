@@ -66,8 +66,10 @@ int ModelLoader::loadOptimizerConfigIni(dictionary *ini, NeuralNetwork &model) {
 
   try {
     std::shared_ptr<ml::train::Optimizer> optimizer =
-      app_context.createObject<ml::train::Optimizer>(opt_type, properties);
+      app_context.createObject<ml::train::Optimizer>(opt_type);
+    /** properties are set once the optimizer has the context of the model */
     model.setOptimizer(optimizer);
+    optimizer->setProperty(properties);
   } catch (std::exception &e) {
     ml_loge("%s %s", typeid(e).name(), e.what());
     return ML_ERROR_INVALID_PARAMETER;
@@ -22,6 +22,7 @@
  */
 
 #include "layer_context.h"
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <fstream>
@@ -32,7 +33,9 @@
 #include <activation_realizer.h>
 #include <common_properties.h>
 #include <databuffer.h>
+#include <feature_cache.h>
 #include <flatten_realizer.h>
+#include <fusion_realizer.h>
 #include <ini_interpreter.h>
 #include <ini_wrapper.h>
 #include <input_realizer.h>
@@ -60,10 +63,13 @@
 namespace nntrainer {
 
 NeuralNetwork::NeuralNetwork(AppContext app_context_) :
-  model_props(props::LossType(), {}, {}, props::ClipGradByGlobalNorm()),
+  model_props(props::LossType(), {}, {}, props::ClipGradByGlobalNorm(),
+              props::InferenceFusion()),
   model_flex_props(props::Epochs(), props::TrainingBatchSize(),
                    props::SavePath(), props::ContinueTrain(),
-                   props::SaveBestPath(), props::MemoryOptimization()),
+                   props::SaveBestPath(), props::MemoryOptimization(),
+                   props::FeatureCache(), props::FeatureCachePath(),
+                   props::Metrics(), props::MetricsInterval()),
   load_path(std::string()),
   epoch_idx(0),
   iter(0),
@@ -72,6 +78,8 @@ NeuralNetwork::NeuralNetwork(AppContext app_context_) :
   initialized(false),
   compiled(false),
   loadedFromConfig(false),
+  metrics_ring(std::make_shared<MetricsRing>()),
+  lr_scale(1.0f),
   app_context(app_context_) {}
 
 int NeuralNetwork::loadFromConfig(const std::string &config) {
@@ -124,6 +132,8 @@ int NeuralNetwork::compile() {
   realizers.emplace_back(new MultioutRealizer());
   realizers.emplace_back(new FlattenRealizer());
   realizers.emplace_back(new ActivationRealizer());
+  if (std::get<props::InferenceFusion>(model_props))
+    realizers.emplace_back(new FusionRealizer());
 
   for (auto &realizer : realizers) {
     graph_representation = realizer->realize(graph_representation);
@@ -294,20 +304,21 @@ void NeuralNetwork::backwarding(int iteration) {
     if (apply_gradient) {
       /// Apply gradient only at the end of the last shared weight access
       model_graph.applyGradients(
-        node.get(), [iteration, opt_ = opt.get()](Weight &w) {
+        node.get(),
+        [iteration, opt_ = opt.get(), lr_scale_ = lr_scale](Weight &w) {
           w.calcRegularizationGradient();
           w.calcWeightDecayGradient();
-          RunOptimizerContext opt_context(&w, iteration);
+          RunOptimizerContext opt_context(&w, iteration, lr_scale_);
           opt_->applyGradient(opt_context);
         });
     }
   };
 
   std::function<void(Weight &, int)> apply_grad_clip_op =
-    [opt_ = opt.get()](Weight &w, int iteration) -> void {
+    [opt_ = opt.get(), lr_scale_ = lr_scale](Weight &w, int iteration) -> void {
     w.calcRegularizationGradient();
     w.calcWeightDecayGradient();
-    RunOptimizerContext opt_context(&w, iteration);
+    RunOptimizerContext opt_context(&w, iteration, lr_scale_);
     opt_->applyGradient(opt_context);
   };
 
@@ -593,6 +604,50 @@ NeuralNetwork::inference(unsigned int batch_size,
   return output;
 }
 
+void NeuralNetwork::streamInference(unsigned int batch_size,
+                                    const std::vector<float *> &input,
+                                    const std::vector<float *> &output) {
+  if (model_graph.getBatchSize() != batch_size) {
+    model_graph.setBatchSize(batch_size);
+    stream_inputs.clear();
+  }
+
+  if (stream_inputs.empty()) {
+    for (auto const &dim : getInputDimension()) {
+      stream_inputs.emplace_back(dim, false);
+    }
+  }
+
+  if (!model_graph.isAllocated()) {
+    allocate(ExecutionMode::INFERENCE);
+  }
+
+  NNTR_THROW_IF(input.size() != stream_inputs.size(), std::invalid_argument)
+    << "number of inputs does not match, given: " << input.size()
+    << " expected: " << stream_inputs.size();
+
+  for (unsigned int idx = 0; idx < stream_inputs.size(); idx++) {
+    stream_inputs[idx].setData(input[idx]);
+  }
+  model_graph.setInputsLabels(stream_inputs, {});
+
+  START_PROFILE(profile::NN_FORWARD);
+  auto output_tensors = forwarding(false);
+  END_PROFILE(profile::NN_FORWARD);
+
+  NNTR_THROW_IF(output.size() != output_tensors.size(), std::invalid_argument)
+    << "number of outputs does not match, given: " << output.size()
+    << " expected: " << output_tensors.size();
+
+  for (unsigned int idx = 0; idx < output_tensors.size(); idx++) {
+    const float *out = output_tensors[idx]->getData();
+    std::copy(out, out + output_tensors[idx]->size(), output[idx]);
+  }
+
+  /** Clear the set inputs, which are owned by the caller */
+  model_graph.setInputsLabels({}, {});
+}
+
 int NeuralNetwork::setDataset(const DatasetModeType &mode,
                               std::shared_ptr<ml::train::Dataset> dataset) {
   return setDataBuffer(mode, std::static_pointer_cast<DataBuffer>(dataset));
@@ -624,6 +679,11 @@ int NeuralNetwork::train(const std::vector<std::string> &values) {
     return ML_ERROR_INVALID_PARAMETER;
   }
 
+  if (std::get<props::InferenceFusion>(model_props)) {
+    ml_loge("Cannot train network compiled with inference fusion.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
   setTrainConfig(values);
 
   /** set batch size just before training */
@@ -645,6 +705,33 @@ int NeuralNetwork::train(const std::vector<std::string> &values) {
   return status;
 }
 
+/**
+ * @brief count the samples whose output and label peak at the same index,
+ * without allocating the indices as Tensor::argmax() does
+ *
+ * @param output contiguous output of the model of at least @a batch samples
+ * @param label contiguous label of the model of at least @a batch samples
+ * @param batch number of valid samples
+ * @return unsigned int number of correct predictions
+ */
+static unsigned int countCorrectPredictions(const Tensor &output,
+                                           const Tensor &label,
+                                           unsigned int batch) {
+  unsigned int out_len = output.getDim().getFeatureLen();
+  unsigned int label_len = label.getDim().getFeatureLen();
+  const float *out_data = output.getData();
+  const float *label_data = label.getData();
+
+  unsigned int count = 0;
+  for (unsigned int b = 0; b < batch; b++) {
+    const float *out = out_data + b * out_len;
+    const float *lbl = label_data + b * label_len;
+    count += std::distance(out, std::max_element(out, out + out_len)) ==
+             std::distance(lbl, std::max_element(lbl, lbl + label_len));
+  }
+  return count;
+}
+
 /**
  * @brief     Run NeuralNetwork train with callback function by user
  */
@@ -673,6 +760,29 @@ int NeuralNetwork::train_run() {
     return ML_ERROR_INVALID_PARAMETER;
   }
 
+  /**
+   * @brief cache of the frozen layers at the front of the model, which is fed
+   * by the training data
+   */
+  std::unique_ptr<FeatureCache> feature_cache;
+  if (std::get<props::FeatureCache>(model_flex_props)) {
+    auto &cache_path = std::get<props::FeatureCachePath>(model_flex_props);
+    feature_cache = std::make_unique<FeatureCache>(
+      model_graph, train_buffer->size(in_dims, label_dims),
+      cache_path.empty() ? "" : cache_path.get());
+    if (feature_cache->empty()) {
+      feature_cache.reset();
+    }
+  }
+
+  /** sample indices of the batch set to the graph */
+  std::vector<unsigned int> sample_indices;
+
+  MetricsReporter reporter(
+    std::get<props::Metrics>(model_flex_props),
+    std::get<props::MetricsInterval>(model_flex_props), getEpochs(),
+    metrics_callback, *metrics_ring);
+
   /**
    * @brief run a single epoch with given callback, @a auto is used instead of
    * std::function for performance measure
@@ -683,7 +793,8 @@ int NeuralNetwork::train_run() {
    * @param on_epoch_end function that will recieve reference to stat,
    * buffer which will be called on the epoch end
    */
-  auto run_epoch = [this, &in_dims, &label_dims, &outputs, batch_size](
+  auto run_epoch = [this, &in_dims, &label_dims, &outputs, batch_size,
+                    &sample_indices](
                      DataBuffer *buffer, bool shuffle,
                      auto &&on_iteration_fetch, auto &&on_iteration_update_stat,
                      auto &&on_epoch_end) {
@@ -697,56 +808,60 @@ int NeuralNetwork::train_run() {
       if (iter_view.isEmpty()) {
         break;
       }
-      auto &iteration = iter_view.get();
-      if (iteration.batch() != batch_size) {
-        /// @todo support partial batch
+      /** a stopped epoch drains the queue, so that the fetch worker ends */
+      if (requests.stop.load(std::memory_order_relaxed)) {
         continue;
       }
 
+      auto &iteration = iter_view.get();
+      /** a partial batch runs on the leading samples of the planned tensors */
+      model_graph.setRunBatchSize(iteration.batch());
+
       auto const &labels = iteration.getLabelsRef();
       auto const &inputs = iteration.getInputsRef();
       model_graph.setInputsLabels(inputs, labels);
+      sample_indices = iteration.getIndices();
 
       on_iteration_fetch(stat, *buffer);
-      on_iteration_update_stat(stat, outputs, labels);
+      on_iteration_update_stat(stat, outputs, labels, iteration.batch());
     }
+    model_graph.setRunBatchSize(batch_size);
     future_iq.get();
-    on_epoch_end(stat, *buffer);
 
     if (stat.num_iterations == 0) {
+      if (requests.stop) {
+        return stat;
+      }
       throw std::runtime_error("No data came while buffer ran");
     }
 
+    on_epoch_end(stat, *buffer);
     return stat;
   };
 
-  auto train_for_iteration = [this](RunStats &stat, DataBuffer &buffer) {
-    forwarding(true);
+  auto train_for_iteration = [this, &feature_cache, &sample_indices](
+                               RunStats &stat, DataBuffer &buffer) {
+    if (feature_cache)
+      feature_cache->forwarding(model_graph, true, sample_indices);
+    else
+      forwarding(true);
     backwarding(iter++);
-
-    std::cout << "#" << epoch_idx << "/" << getEpochs();
-    ml_logi("# %d / %d", epoch_idx, getEpochs());
-    auto loss = getLoss();
-    buffer.displayProgress(stat.num_iterations, loss);
   };
 
-  auto update_train_stat = [this](RunStats &stat,
-                                  const std::vector<Tensor> &outputs,
-                                  const std::vector<Tensor> &labels) {
-    stat.loss += getLoss();
+  auto update_stat = [this](RunStats &stat, const std::vector<Tensor> &outputs,
+                            const std::vector<Tensor> &labels,
+                            unsigned int batch) {
     stat.num_iterations++;
+    stat.num_samples += batch;
+    /** running mean of the samples, each batch weighted by its size */
+    stat.loss += (getLoss() - stat.loss) * batch / stat.num_samples;
   };
 
   auto train_epoch_end = [this](RunStats &stat, DataBuffer &buffer) {
-    stat.loss /= static_cast<float>(stat.num_iterations);
     auto &save_path = std::get<props::SavePath>(model_flex_props);
     if (!save_path.empty()) {
       save(save_path, ml::train::ModelFormat::MODEL_FORMAT_BIN);
     }
-
-    std::cout << "#" << epoch_idx << "/" << getEpochs()
-              << " - Training Loss: " << stat.loss;
-    ml_logi("# %d / %d - Training Loss: %f", epoch_idx, getEpochs(), stat.loss);
   };
 
   auto eval_for_iteration = [this, batch_size](RunStats &stat,
@@ -754,27 +869,26 @@ int NeuralNetwork::train_run() {
     forwarding(false);
   };
 
-  auto update_eval_stat = [batch_size, &update_train_stat](
-                            RunStats &stat, const std::vector<Tensor> &outputs,
-                            const std::vector<Tensor> &labels) {
-    auto model_out = outputs[0].argmax();
-    auto label_out = labels[0].argmax();
-
-    for (unsigned int b = 0; b < batch_size; b++) {
-      if (model_out[b] == label_out[b])
-        stat.num_correct_predictions++;
-    }
-
-    update_train_stat(stat, outputs, labels);
+  auto update_eval_stat = [&update_stat](RunStats &stat,
+                                         const std::vector<Tensor> &outputs,
+                                         const std::vector<Tensor> &labels,
+                                         unsigned int batch) {
+    stat.num_correct_predictions +=
+      countCorrectPredictions(outputs[0], labels[0], batch);
+    update_stat(stat, outputs, labels, batch);
   };
 
-  auto eval_epoch_end = [this, batch_size, max_acc = 0.0f,
+  auto eval_epoch_end = [this, max_acc = 0.0f,
                          min_loss = std::numeric_limits<float>::max()](
                           RunStats &stat, DataBuffer &buffer) mutable {
-    stat.loss /= static_cast<float>(stat.num_iterations);
-    stat.accuracy = stat.num_correct_predictions /
-                    static_cast<float>(stat.num_iterations * batch_size) *
-                    100.0f;
+    /** an interrupted validation only saw a subset of the samples */
+    if (requests.stop) {
+      return;
+    }
+
+    stat.accuracy =
+      stat.num_correct_predictions / static_cast<float>(stat.num_samples) *
+      100.0f;
 
     if (stat.accuracy > max_acc ||
         (stat.accuracy == max_acc && stat.loss < min_loss)) {
@@ -787,25 +901,92 @@ int NeuralNetwork::train_run() {
         save(save_best_path);
       }
     }
-    std::cout << " >> [ Accuracy: " << stat.accuracy
-              << "% - Validation Loss : " << stat.loss << " ]";
-    ml_logi("[ Accuracy: %.2f %% - Validataion Loss: %.5f", stat.accuracy,
-            stat.loss);
   };
 
+  bool validated = false;
+  auto validate = [&]() {
+    auto stat = run_epoch(valid_buffer.get(), false, eval_for_iteration,
+                          update_eval_stat, eval_epoch_end);
+    /** stopped before the end of the validation set */
+    if (stat.num_iterations == 0 || requests.stop) {
+      return;
+    }
+
+    validation = stat;
+    validated = true;
+    for (auto &callback : callbacks) {
+      callback->onValidation(*this, epoch_idx, validation);
+    }
+  };
+
+  /**
+   * @brief make the stat update of a training iteration, @a with_callbacks is
+   * std::true_type or std::false_type so that training without callbacks
+   * does not run the hooks at all
+   */
+  auto update_train_stat = [&](auto with_callbacks) {
+    return [&, with_callbacks](RunStats &stat,
+                               const std::vector<Tensor> &outputs,
+                               const std::vector<Tensor> &labels,
+                               unsigned int batch) {
+      update_stat(stat, outputs, labels, batch);
+      reporter.updateIteration(stat.loss, stat.num_iterations,
+                               stat.num_samples);
+
+      if constexpr (decltype(with_callbacks)::value) {
+        for (auto &callback : callbacks) {
+          callback->onIteration(*this, epoch_idx, stat);
+        }
+      }
+
+      if (requests.validate.load(std::memory_order_relaxed)) {
+        requests.validate = false;
+        if (valid_buffer && !requests.stop) {
+          validate();
+        }
+      }
+    };
+  };
+
+  requests.stop = false;
+  requests.validate = false;
+  for (auto &callback : callbacks) {
+    callback->onTrainBegin(*this);
+  }
+
   auto epochs = getEpochs();
   for (epoch_idx = epoch_idx + 1; epoch_idx <= epochs; ++epoch_idx) {
-    training = run_epoch(train_buffer.get(), true, train_for_iteration,
-                         update_train_stat, train_epoch_end);
-    if (valid_buffer) {
-      validation = run_epoch(valid_buffer.get(), false, eval_for_iteration,
-                             update_eval_stat, eval_epoch_end);
+    reporter.startEpoch(epoch_idx);
+    validated = false;
+    if (callbacks.empty()) {
+      training = run_epoch(train_buffer.get(), true, train_for_iteration,
+                           update_train_stat(std::false_type()),
+                           train_epoch_end);
+    } else {
+      training = run_epoch(train_buffer.get(), true, train_for_iteration,
+                           update_train_stat(std::true_type()),
+                           train_epoch_end);
+    }
+
+    /** a stopped epoch is not validated */
+    if (valid_buffer && !requests.stop) {
+      validate();
+    }
+    reporter.endEpoch(training.loss, validated, validation.loss,
+                      validation.accuracy);
+
+    for (auto &callback : callbacks) {
+      callback->onEpochEnd(*this, epoch_idx, training,
+                           validated ? &validation : nullptr);
+    }
+
+    if (requests.stop) {
+      break;
     }
-    std::cout << '\n';
   }
+  requests.stop = false;
 
   if (test_buffer) {
-    std::cout << "Evaluation with test data...\n";
     testing = run_epoch(test_buffer.get(), false, eval_for_iteration,
                         update_eval_stat, eval_epoch_end);
   }
@@ -816,6 +997,20 @@ int NeuralNetwork::train_run() {
   return status;
 }
 
+void NeuralNetwork::addTrainingCallback(
+  std::shared_ptr<ml::train::TrainingCallback> callback) {
+  NNTR_THROW_IF(!callback, std::invalid_argument)
+    << "[NeuralNetwork] given training callback is null";
+  callbacks.push_back(std::move(callback));
+}
+
+void NeuralNetwork::setLearningRateScale(float scale) {
+  NNTR_THROW_IF(!std::isfinite(scale) || scale <= 0.0f, std::invalid_argument)
+    << "[NeuralNetwork] learning rate scale must be positive, given: "
+    << scale;
+  lr_scale = scale;
+}
+
 void swap(NeuralNetwork &lhs, NeuralNetwork &rhs) {
   {
     using std::swap;
@@ -863,6 +1058,8 @@ int NeuralNetwork::setOptimizer(
   }
 
   opt = std::static_pointer_cast<Optimizer>(optimizer);
+  /** objects of the optimizer are created from the context of the model */
+  opt->setAppContext(app_context);
 
   return ML_ERROR_NONE;
 }
@@ -25,6 +25,7 @@
 #ifdef __cplusplus
 
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <tuple>
@@ -43,6 +44,7 @@
 #include <network_graph.h>
 #include <optimizer_devel.h>
 #include <tensor.h>
+#include <training_metrics.h>
 
 #include <model.h>
 #include <nntrainer-api-common.h>
@@ -67,21 +69,32 @@ using NetType = ml::train::ModelType;
 class DataBuffer;
 using DatasetType = ml::train::DatasetType;
 using DatasetModeType = ml::train::DatasetModeType;
+using RunStats = ml::train::RunStats;
+
 /**
- * @brief     Statistics from running or training a model
+ * @brief     Requests to the running training, which may come from any thread
  */
-struct RunStats {
-  float accuracy;     /** accuracy of the model */
-  float loss;         /** loss of the model */
-  int num_iterations; /** number of iterations done on this stat */
-  unsigned int
-    num_correct_predictions; /** number of right sample on this run */
-
-  RunStats() :
-    accuracy(0),
-    loss(0),
-    num_iterations(0),
-    num_correct_predictions(0) {}
+struct TrainRequests {
+  std::atomic<bool> stop;     /**< stop the training */
+  std::atomic<bool> validate; /**< validate after the current iteration */
+
+  /**
+   * @brief Construct a new Train Requests object
+   *
+   */
+  TrainRequests() : stop(false), validate(false) {}
+
+  /**
+   * @brief Copy constructor, requests are not copied along with a model
+   *
+   */
+  TrainRequests(const TrainRequests &) : TrainRequests() {}
+
+  /**
+   * @brief Copy assignment, requests are not copied along with a model
+   *
+   */
+  TrainRequests &operator=(const TrainRequests &) { return *this; }
 };
 
 /**
@@ -126,6 +139,49 @@ public:
    */
   float getValidationLoss() override { return validation.loss; }
 
+  /**
+   * @copydoc Model::setMetricsCallback(
+   * std::function<void(const ml::train::TrainingMetrics &)> callback)
+   */
+  void setMetricsCallback(
+    std::function<void(const ml::train::TrainingMetrics &)> callback) override {
+    metrics_callback = std::move(callback);
+  }
+
+  /**
+   * @copydoc Model::takeMetrics()
+   */
+  std::vector<ml::train::TrainingMetrics> takeMetrics() override {
+    return metrics_ring->take();
+  }
+
+  /**
+   * @copydoc Model::addTrainingCallback(
+   * std::shared_ptr<ml::train::TrainingCallback> callback)
+   */
+  void addTrainingCallback(
+    std::shared_ptr<ml::train::TrainingCallback> callback) override;
+
+  /**
+   * @copydoc Model::stopTraining()
+   */
+  void stopTraining() override { requests.stop = true; }
+
+  /**
+   * @copydoc Model::requestValidation()
+   */
+  void requestValidation() override { requests.validate = true; }
+
+  /**
+   * @copydoc Model::getLearningRateScale()
+   */
+  float getLearningRateScale() override { return lr_scale; }
+
+  /**
+   * @copydoc Model::setLearningRateScale(float scale)
+   */
+  void setLearningRateScale(float scale) override;
+
   /**
    * @brief     Get Learning rate
    * @retval    Learning rate
@@ -282,6 +338,13 @@ public:
                                  const std::vector<float *> &input,
                                  const std::vector<float *> &label) override;
 
+  /**
+   * @copydoc Model::streamInference(unsigned int batch,
+   * const std::vector<float *> &input, const std::vector<float *> &output)
+   */
+  void streamInference(unsigned int batch, const std::vector<float *> &input,
+                       const std::vector<float *> &output) override;
+
   /**
    * @brief     Run NeuralNetwork train with callback function by user
    * @param[in] dt datatype (mode) where it should be
@@ -490,10 +553,13 @@ private:
   using FlexiblePropTypes =
     std::tuple<props::Epochs, props::TrainingBatchSize, props::SavePath,
                props::ContinueTrain, props::SaveBestPath,
-               props::MemoryOptimization>;
+               props::MemoryOptimization, props::FeatureCache,
+               props::FeatureCachePath, props::Metrics,
+               props::MetricsInterval>;
   using RigidPropTypes =
     std::tuple<props::LossType, std::vector<props::InputConnection>,
-               std::vector<props::LabelLayer>, props::ClipGradByGlobalNorm>;
+               std::vector<props::LabelLayer>, props::ClipGradByGlobalNorm,
+               props::InferenceFusion>;
 
   RigidPropTypes model_props;         /**< model props */
   FlexiblePropTypes model_flex_props; /**< model train props */
@@ -534,9 +600,19 @@ private:
   RunStats training;   /** training statistics of the model */
   RunStats testing;    /** testing statistics of the model */
 
+  MetricsReporter::Callback metrics_callback; /**< callback of the metrics */
+  std::shared_ptr<MetricsRing>
+    metrics_ring; /**< metrics kept for the ring sink */
+
+  std::vector<std::shared_ptr<ml::train::TrainingCallback>>
+    callbacks;            /**< callbacks called while training */
+  TrainRequests requests; /**< requests to the running training */
+  float lr_scale;         /**< scale of the learning rate of the optimizer */
+
   AppContext app_context; /** Configurations bound to current app */
 
   NetworkGraph model_graph;                 /** Network Model Graph */
+  std::vector<Tensor> stream_inputs; /**< inputs bound for streamInference */
   GraphRepresentation graph_representation; /** Unsorted graph representation */
 
   DynamicTrainingOptimization dynamic_training_opt; /**< Dynamic fine-tuning
@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   training_callbacks.cpp
+ * @date   19 October 2026
+ * @brief  This file contains the training callbacks given by nntrainer
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <training_callbacks.h>
+
+#include <algorithm>
+
+#include <base_properties.h>
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+#include <node_exporter.h>
+#include <util_func.h>
+
+namespace nntrainer {
+
+namespace props {
+
+/**
+ * @brief Enumeration information of the monitored statistics
+ *
+ */
+struct MonitorInfo {
+  using Enum = nntrainer::MonitorType;
+  static constexpr std::initializer_list<Enum> EnumList = {
+    Enum::LOSS, Enum::VALIDATION_LOSS, Enum::VALIDATION_ACCURACY};
+
+  static constexpr const char *EnumStr[] = {"loss", "val_loss",
+                                            "val_accuracy"};
+};
+
+/**
+ * @brief monitor property, statistic watched for improvement
+ *
+ */
+class Monitor final : public EnumProperty<MonitorInfo> {
+public:
+  static constexpr const char *key = "monitor"; /**< unique key to access */
+  using prop_tag = enum_class_prop_tag;         /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to val_loss
+   */
+  Monitor(MonitorInfo::Enum value = MonitorInfo::Enum::VALIDATION_LOSS) {
+    set(value);
+  }
+};
+
+/**
+ * @brief patience property, epochs without improvement after which the
+ * plateau is reached
+ *
+ */
+class Patience final : public Property<unsigned int> {
+public:
+  static constexpr const char *key = "patience"; /**< unique key to access */
+  using prop_tag = uint_prop_tag;                /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set
+   */
+  Patience(unsigned int value) { set(value); }
+};
+
+/**
+ * @brief min delta property, least change of the monitored statistic counted
+ * as an improvement
+ *
+ */
+class MinDelta final : public Property<float> {
+public:
+  static constexpr const char *key = "min_delta"; /**< unique key to access */
+  using prop_tag = float_prop_tag;                /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to 0
+   */
+  MinDelta(float value = 0.0f) { set(value); }
+
+  /**
+   * @brief check if the value is not negative
+   *
+   * @param value value to check
+   * @retval true if value >= 0
+   */
+  bool isValid(const float &value) const override { return value >= 0.0f; }
+};
+
+/**
+ * @brief factor property, factor the learning rate is scaled by on a plateau
+ *
+ */
+class Factor final : public Property<float> {
+public:
+  static constexpr const char *key = "factor"; /**< unique key to access */
+  using prop_tag = float_prop_tag;             /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to 0.1
+   */
+  Factor(float value = 0.1f) { set(value); }
+
+  /**
+   * @brief check if the value is in (0, 1)
+   *
+   * @param value value to check
+   * @retval true if 0 < value < 1
+   */
+  bool isValid(const float &value) const override {
+    return value > 0.0f && value < 1.0f;
+  }
+};
+
+/**
+ * @brief min scale property, lower bound of the learning rate scale
+ *
+ */
+class MinScale final : public Property<float> {
+public:
+  static constexpr const char *key = "min_scale"; /**< unique key to access */
+  using prop_tag = float_prop_tag;                /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to 0
+   */
+  MinScale(float value = 0.0f) { set(value); }
+
+  /**
+   * @brief check if the value is not negative
+   *
+   * @param value value to check
+   * @retval true if value >= 0
+   */
+  bool isValid(const float &value) const override { return value >= 0.0f; }
+};
+
+/**
+ * @brief validation interval property, iterations between the validations
+ *
+ */
+class ValidationInterval final : public PositiveIntegerProperty {
+public:
+  static constexpr const char *key = "interval"; /**< unique key to access */
+  using prop_tag = uint_prop_tag;                /**< property type */
+};
+
+} // namespace props
+
+PlateauCallback::PlateauCallback(unsigned int patience) :
+  plateau_props(new Props(props::Monitor(), props::Patience(patience),
+                          props::MinDelta())),
+  has_best(false),
+  best(0.0f),
+  wait(0) {}
+
+PlateauCallback::~PlateauCallback() = default;
+
+std::vector<std::string>
+PlateauCallback::setProperty(const std::vector<std::string> &values) {
+  return loadProperties(values, *plateau_props);
+}
+
+void PlateauCallback::onTrainBegin(ml::train::Model &model) {
+  has_best = false;
+  best = 0.0f;
+  wait = 0;
+}
+
+void PlateauCallback::onEpochEnd(ml::train::Model &model, unsigned int epoch,
+                                 const ml::train::RunStats &training,
+                                 const ml::train::RunStats *validation) {
+  auto const &[monitor, patience, min_delta] = *plateau_props;
+
+  float value;
+  bool higher_is_better = false;
+  switch (monitor.get()) {
+  case MonitorType::LOSS:
+    value = training.loss;
+    break;
+  case MonitorType::VALIDATION_LOSS:
+  case MonitorType::VALIDATION_ACCURACY:
+    /** a stopped epoch or a model without a validation set is skipped */
+    if (validation == nullptr) {
+      ml_logw("[PlateauCallback] epoch %u is not validated, skipped", epoch);
+      return;
+    }
+    higher_is_better = monitor.get() == MonitorType::VALIDATION_ACCURACY;
+    value = higher_is_better ? validation->accuracy : validation->loss;
+    break;
+  default:
+    throw std::invalid_argument("[PlateauCallback] unknown monitor");
+  }
+
+  bool improved = !has_best || (higher_is_better ? value > best + min_delta
+                                                 : value < best - min_delta);
+  if (improved) {
+    has_best = true;
+    best = value;
+    wait = 0;
+    return;
+  }
+
+  if (++wait >= patience) {
+    ml_logi("[PlateauCallback] no improvement for %u epochs at epoch %u", wait,
+            epoch);
+    wait = 0;
+    onPlateau(model);
+  }
+}
+
+EarlyStopping::EarlyStopping(const std::vector<std::string> &values) :
+  PlateauCallback(3) {
+  auto left = setProperty(values);
+  NNTR_THROW_IF(!left.empty(), std::invalid_argument)
+    << "[EarlyStopping] there are unparsed properties, first: " << left.front();
+}
+
+void EarlyStopping::onPlateau(ml::train::Model &model) { model.stopTraining(); }
+
+ReduceLROnPlateau::ReduceLROnPlateau(const std::vector<std::string> &values) :
+  PlateauCallback(2),
+  reduce_props(new Props(props::Factor(), props::MinScale())) {
+  auto left = loadProperties(setProperty(values), *reduce_props);
+  NNTR_THROW_IF(!left.empty(), std::invalid_argument)
+    << "[ReduceLROnPlateau] there are unparsed properties, first: "
+    << left.front();
+}
+
+ReduceLROnPlateau::~ReduceLROnPlateau() = default;
+
+void ReduceLROnPlateau::onPlateau(ml::train::Model &model) {
+  auto const &[factor, min_scale] = *reduce_props;
+
+  float scale =
+    std::max(model.getLearningRateScale() * factor.get(), min_scale.get());
+  /** the scale of the model can not be zero */
+  if (scale > 0.0f) {
+    model.setLearningRateScale(scale);
+  }
+}
+
+PeriodicValidation::PeriodicValidation(const std::vector<std::string> &values) :
+  validation_props(new std::tuple<props::ValidationInterval>()) {
+  auto left = loadProperties(values, *validation_props);
+  NNTR_THROW_IF(!left.empty(), std::invalid_argument)
+    << "[PeriodicValidation] there are unparsed properties, first: "
+    << left.front();
+  NNTR_THROW_IF(std::get<props::ValidationInterval>(*validation_props).empty(),
+                std::invalid_argument)
+    << "[PeriodicValidation] interval is not set";
+}
+
+PeriodicValidation::~PeriodicValidation() = default;
+
+void PeriodicValidation::onIteration(ml::train::Model &model,
+                                     unsigned int epoch,
+                                     const ml::train::RunStats &stats) {
+  unsigned int interval = std::get<props::ValidationInterval>(*validation_props);
+  if (stats.num_iterations % interval == 0) {
+    model.requestValidation();
+  }
+}
+
+std::unique_ptr<ml::train::TrainingCallback>
+createTrainingCallback(const std::string &type,
+                       const std::vector<std::string> &properties) {
+  if (istrequal(type, EarlyStopping::type)) {
+    return std::make_unique<EarlyStopping>(properties);
+  }
+  if (istrequal(type, ReduceLROnPlateau::type)) {
+    return std::make_unique<ReduceLROnPlateau>(properties);
+  }
+  if (istrequal(type, PeriodicValidation::type)) {
+    return std::make_unique<PeriodicValidation>(properties);
+  }
+
+  throw std::invalid_argument("unknown training callback type: " + type);
+}
+
+} // namespace nntrainer
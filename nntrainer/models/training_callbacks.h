@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   training_callbacks.h
+ * @date   19 October 2026
+ * @brief  This file contains the training callbacks given by nntrainer
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#ifndef __TRAINING_CALLBACKS_H__
+#define __TRAINING_CALLBACKS_H__
+#ifdef __cplusplus
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <model.h>
+
+namespace nntrainer {
+
+namespace props {
+class Monitor;
+class Patience;
+class MinDelta;
+class Factor;
+class MinScale;
+class ValidationInterval;
+} // namespace props
+
+/**
+ * @brief Enumeration of the statistics monitored by the callbacks
+ *
+ */
+enum class MonitorType {
+  LOSS,               /**< training loss */
+  VALIDATION_LOSS,    /**< validation loss */
+  VALIDATION_ACCURACY /**< validation accuracy */
+};
+
+/**
+ * @brief Base of the callbacks monitoring a statistic at the end of each
+ * epoch, which tells when the statistic stops improving
+ *
+ */
+class PlateauCallback : public ml::train::TrainingCallback {
+public:
+  /**
+   * @brief Construct a new Plateau Callback object
+   *
+   * @param patience default number of epochs without improvement after which
+   * the plateau is reached
+   */
+  PlateauCallback(unsigned int patience);
+
+  /**
+   * @brief Destroy the Plateau Callback object
+   *
+   */
+  virtual ~PlateauCallback();
+
+  /**
+   * @copydoc ml::train::TrainingCallback::onTrainBegin(ml::train::Model &)
+   */
+  void onTrainBegin(ml::train::Model &model) override;
+
+  /**
+   * @copydoc ml::train::TrainingCallback::onEpochEnd(ml::train::Model &,
+   * unsigned int, const ml::train::RunStats &, const ml::train::RunStats *)
+   */
+  void onEpochEnd(ml::train::Model &model, unsigned int epoch,
+                  const ml::train::RunStats &training,
+                  const ml::train::RunStats *validation) override;
+
+  /**
+   * @brief set the properties of the callback
+   *
+   * @param values properties to set
+   * @return std::vector<std::string> properties not of the plateau
+   */
+  std::vector<std::string> setProperty(const std::vector<std::string> &values);
+
+protected:
+  /**
+   * @brief called when the monitored statistic has not improved for
+   * "patience" epochs
+   *
+   * @param model model being trained
+   */
+  virtual void onPlateau(ml::train::Model &model) = 0;
+
+private:
+  using Props = std::tuple<props::Monitor, props::Patience, props::MinDelta>;
+  std::unique_ptr<Props> plateau_props;
+
+  bool has_best;     /**< true if a statistic has been seen */
+  float best;        /**< best statistic seen */
+  unsigned int wait; /**< epochs without improvement */
+};
+
+/**
+ * @brief Callback which stops the training once the monitored statistic
+ * stops improving
+ *
+ */
+class EarlyStopping final : public PlateauCallback {
+public:
+  /**
+   * @brief Construct a new Early Stopping object
+   *
+   * @param values properties to set
+   */
+  EarlyStopping(const std::vector<std::string> &values = {});
+
+  inline static const std::string type = "early_stopping";
+
+private:
+  /**
+   * @copydoc PlateauCallback::onPlateau(ml::train::Model &model)
+   */
+  void onPlateau(ml::train::Model &model) override;
+};
+
+/**
+ * @brief Callback which scales the learning rate down once the monitored
+ * statistic stops improving
+ *
+ */
+class ReduceLROnPlateau final : public PlateauCallback {
+public:
+  /**
+   * @brief Construct a new Reduce LR On Plateau object
+   *
+   * @param values properties to set
+   */
+  ReduceLROnPlateau(const std::vector<std::string> &values = {});
+
+  /**
+   * @brief Destroy the Reduce LR On Plateau object
+   *
+   */
+  ~ReduceLROnPlateau();
+
+  inline static const std::string type = "reduce_lr_on_plateau";
+
+private:
+  /**
+   * @copydoc PlateauCallback::onPlateau(ml::train::Model &model)
+   */
+  void onPlateau(ml::train::Model &model) override;
+
+  using Props = std::tuple<props::Factor, props::MinScale>;
+  std::unique_ptr<Props> reduce_props;
+};
+
+/**
+ * @brief Callback which validates the model every interval iterations of an
+ * epoch
+ *
+ */
+class PeriodicValidation final : public ml::train::TrainingCallback {
+public:
+  /**
+   * @brief Construct a new Periodic Validation object
+   *
+   * @param values properties to set, "interval" is required
+   */
+  PeriodicValidation(const std::vector<std::string> &values = {});
+
+  /**
+   * @brief Destroy the Periodic Validation object
+   *
+   */
+  ~PeriodicValidation();
+
+  inline static const std::string type = "periodic_validation";
+
+  /**
+   * @copydoc ml::train::TrainingCallback::onIteration(ml::train::Model &,
+   * unsigned int, const ml::train::RunStats &)
+   */
+  void onIteration(ml::train::Model &model, unsigned int epoch,
+                   const ml::train::RunStats &stats) override;
+
+private:
+  std::unique_ptr<std::tuple<props::ValidationInterval>> validation_props;
+};
+
+/**
+ * @brief Factory creator of the training callbacks
+ *
+ * @param type type of the callback
+ * @param properties properties of the callback
+ * @return std::unique_ptr<ml::train::TrainingCallback> created callback
+ */
+std::unique_ptr<ml::train::TrainingCallback>
+createTrainingCallback(const std::string &type,
+                       const std::vector<std::string> &properties = {});
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __TRAINING_CALLBACKS_H__ */
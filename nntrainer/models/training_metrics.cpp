@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   training_metrics.cpp
+ * @date   19 October 2026
+ * @brief  This file contains the reporter of the training metrics
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <training_metrics.h>
+
+#include <exception>
+#include <iostream>
+
+#include <nntrainer_log.h>
+
+namespace nntrainer {
+
+MetricsRing::MetricsRing(unsigned int capacity) : capacity(capacity) {}
+
+void MetricsRing::push(const ml::train::TrainingMetrics &metrics) {
+  std::scoped_lock lk(m);
+  if (capacity == 0) {
+    return;
+  }
+
+  if (metrics_q.size() == capacity) {
+    metrics_q.pop_front();
+  }
+  metrics_q.push_back(metrics);
+}
+
+std::vector<ml::train::TrainingMetrics> MetricsRing::take() {
+  std::scoped_lock lk(m);
+  std::vector<ml::train::TrainingMetrics> taken(metrics_q.begin(),
+                                                metrics_q.end());
+  metrics_q.clear();
+  return taken;
+}
+
+MetricsReporter::MetricsReporter(MetricsSinkType sink, unsigned int interval,
+                                 unsigned int epochs, const Callback &callback,
+                                 MetricsRing &ring) :
+  sink(sink),
+  interval(interval),
+  epochs(epochs),
+  callback(callback),
+  ring(ring),
+  active(sink != MetricsSinkType::NONE || callback),
+  seq(0),
+  epoch(0),
+  start(0),
+  loss(0.0f),
+  iteration(0),
+  num_samples(0),
+  stop(false) {
+  if (active) {
+    reporter = std::thread(&MetricsReporter::run, this);
+  }
+}
+
+MetricsReporter::~MetricsReporter() {
+  if (!active) {
+    return;
+  }
+
+  {
+    std::scoped_lock lk(m);
+    stop = true;
+  }
+  cv.notify_one();
+  reporter.join();
+}
+
+void MetricsReporter::startEpoch(unsigned int epoch_) {
+  if (!active) {
+    return;
+  }
+
+  publish(epoch_, Clock::now().time_since_epoch().count(), 0.0f, 0, 0);
+}
+
+void MetricsReporter::updateIteration(float loss_, unsigned int iterations,
+                                      unsigned int samples) {
+  if (!active) {
+    return;
+  }
+
+  publish(epoch.load(std::memory_order_relaxed),
+          start.load(std::memory_order_relaxed), loss_, iterations,
+          samples);
+}
+
+void MetricsReporter::endEpoch(float loss, bool has_validation,
+                               float validation_loss,
+                               float validation_accuracy) {
+  if (!active) {
+    return;
+  }
+
+  ml::train::TrainingMetrics metrics = snapshot();
+  metrics.loss = loss;
+  metrics.epoch_end = true;
+  metrics.has_validation = has_validation;
+  metrics.validation_loss = validation_loss;
+  metrics.validation_accuracy = validation_accuracy;
+
+  /** the ended epoch is not reported again by the periodic reports */
+  publish(metrics.epoch, 0, 0.0f, 0, 0);
+
+  {
+    std::scoped_lock lk(m);
+    pending.push_back(metrics);
+  }
+  cv.notify_one();
+}
+
+void MetricsReporter::publish(unsigned int epoch_, Clock::rep start_,
+                              float loss_, unsigned int iteration_,
+                              unsigned int num_samples_) {
+  unsigned int s = seq.load(std::memory_order_relaxed);
+  seq.store(s + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  epoch.store(epoch_, std::memory_order_relaxed);
+  start.store(start_, std::memory_order_relaxed);
+  loss.store(loss_, std::memory_order_relaxed);
+  iteration.store(iteration_, std::memory_order_relaxed);
+  num_samples.store(num_samples_, std::memory_order_relaxed);
+
+  seq.store(s + 2, std::memory_order_release);
+}
+
+ml::train::TrainingMetrics MetricsReporter::snapshot() const {
+  ml::train::TrainingMetrics metrics{};
+  Clock::rep start_;
+  float loss_;
+
+  unsigned int s1, s2;
+  do {
+    s1 = seq.load(std::memory_order_acquire);
+    metrics.epoch = epoch.load(std::memory_order_relaxed);
+    start_ = start.load(std::memory_order_relaxed);
+    loss_ = loss.load(std::memory_order_relaxed);
+    metrics.iteration = iteration.load(std::memory_order_relaxed);
+    metrics.num_samples = num_samples.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    s2 = seq.load(std::memory_order_relaxed);
+  } while ((s1 & 1) || s1 != s2);
+
+  if (metrics.num_samples != 0) {
+    metrics.loss = loss_;
+
+    std::chrono::duration<float> elapsed =
+      Clock::now() - Clock::time_point(Clock::duration(start_));
+    if (elapsed.count() > 0.0f) {
+      metrics.samples_per_second = metrics.num_samples / elapsed.count();
+    }
+  }
+
+  return metrics;
+}
+
+void MetricsReporter::report(const ml::train::TrainingMetrics &metrics) {
+  switch (sink) {
+  case MetricsSinkType::CONSOLE:
+    std::cout << "#" << metrics.epoch << "/" << epochs;
+    if (!metrics.epoch_end) {
+      std::cout << " [ " << metrics.iteration
+                << " ] ( Training Loss: " << metrics.loss << " )\r";
+    } else {
+      std::cout << " - Training Loss: " << metrics.loss;
+      if (metrics.has_validation) {
+        std::cout << " >> [ Accuracy: " << metrics.validation_accuracy
+                  << "% - Validation Loss : " << metrics.validation_loss
+                  << " ]";
+      }
+      std::cout << '\n';
+    }
+    std::cout.flush();
+    break;
+  case MetricsSinkType::LOG:
+    if (!metrics.epoch_end) {
+      ml_logi("# %u / %u [ %u ] Training Loss: %f (%.1f samples/s)",
+              metrics.epoch, epochs, metrics.iteration, metrics.loss,
+              metrics.samples_per_second);
+    } else if (metrics.has_validation) {
+      ml_logi("# %u / %u - Training Loss: %f [ Accuracy: %.2f %% - "
+              "Validation Loss: %.5f ]",
+              metrics.epoch, epochs, metrics.loss,
+              metrics.validation_accuracy, metrics.validation_loss);
+    } else {
+      ml_logi("# %u / %u - Training Loss: %f", metrics.epoch, epochs,
+              metrics.loss);
+    }
+    break;
+  case MetricsSinkType::RING:
+    ring.push(metrics);
+    break;
+  case MetricsSinkType::NONE:
+  default:
+    break;
+  }
+
+  if (callback) {
+    try {
+      callback(metrics);
+    } catch (std::exception &e) {
+      ml_loge("metrics callback failed, reason: %s", e.what());
+    }
+  }
+}
+
+void MetricsReporter::run() {
+  unsigned int last_epoch = 0;
+  unsigned int last_iteration = 0;
+  auto next = Clock::now() + interval;
+
+  std::unique_lock lk(m);
+  while (true) {
+    cv.wait_until(lk, next, [this] { return stop || !pending.empty(); });
+
+    while (!pending.empty()) {
+      auto metrics = pending.front();
+      pending.pop_front();
+      lk.unlock();
+      report(metrics);
+      lk.lock();
+    }
+
+    if (stop) {
+      return;
+    }
+
+    if (Clock::now() < next) {
+      continue;
+    }
+    next = Clock::now() + interval;
+
+    lk.unlock();
+    auto metrics = snapshot();
+    /** reports only if the epoch has moved on since the last report */
+    if (metrics.iteration != 0 && (metrics.epoch != last_epoch ||
+                                   metrics.iteration != last_iteration)) {
+      last_epoch = metrics.epoch;
+      last_iteration = metrics.iteration;
+      report(metrics);
+    }
+    lk.lock();
+  }
+}
+
+} // namespace nntrainer
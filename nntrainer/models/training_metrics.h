@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   training_metrics.h
+ * @date   19 October 2026
+ * @brief  This file contains the reporter of the training metrics
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#ifndef __TRAINING_METRICS_H__
+#define __TRAINING_METRICS_H__
+#ifdef __cplusplus
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <model.h>
+#include <model_common_properties.h>
+
+namespace nntrainer {
+
+/**
+ * @brief Ring of the latest training metrics, kept for the "ring" sink until
+ * they are taken
+ *
+ */
+class MetricsRing {
+public:
+  /**
+   * @brief Construct a new Metrics Ring object
+   *
+   * @param capacity number of metrics to keep, the oldest are dropped
+   */
+  MetricsRing(unsigned int capacity = 256);
+
+  /**
+   * @brief push metrics, drops the oldest if the ring is full
+   *
+   * @param metrics metrics to push
+   */
+  void push(const ml::train::TrainingMetrics &metrics);
+
+  /**
+   * @brief take the kept metrics
+   *
+   * @return std::vector<ml::train::TrainingMetrics> metrics, oldest first
+   */
+  std::vector<ml::train::TrainingMetrics> take();
+
+private:
+  unsigned int capacity;
+  std::deque<ml::train::TrainingMetrics> metrics_q;
+  std::mutex m;
+};
+
+/**
+ * @brief Reporter of the training metrics for a run of training.
+ *
+ * The training thread publishes its running statistics to lock-free counters.
+ * A reporting thread reads them every interval, aggregates them and hands them
+ * over to the sink and the callback, so the training loop does no I/O. The
+ * metrics of an epoch end are always reported, in order.
+ */
+class MetricsReporter {
+public:
+  using Callback = std::function<void(const ml::train::TrainingMetrics &)>;
+
+  /**
+   * @brief Construct a new Metrics Reporter object, the reporting thread is
+   * started only if there is a sink or a callback
+   *
+   * @param sink sink to report to
+   * @param interval milliseconds between the reports while an epoch runs
+   * @param epochs number of epochs of the run
+   * @param callback callback to report to, can be empty
+   * @param ring ring to keep the metrics in for MetricsSinkType::RING
+   */
+  MetricsReporter(MetricsSinkType sink, unsigned int interval,
+                  unsigned int epochs, const Callback &callback,
+                  MetricsRing &ring);
+
+  /**
+   * @brief Destroy the Metrics Reporter object, the metrics of the finished
+   * epochs are reported before it returns
+   *
+   */
+  ~MetricsReporter();
+
+  /**
+   * @brief start an epoch
+   *
+   * @param epoch epoch to start
+   */
+  void startEpoch(unsigned int epoch);
+
+  /**
+   * @brief publish the running statistics of the epoch
+   *
+   * @param loss mean loss of the samples trained on
+   * @param iterations iterations done in the epoch
+   * @param samples samples trained in the epoch
+   */
+  void updateIteration(float loss, unsigned int iterations,
+                       unsigned int samples);
+
+  /**
+   * @brief end the epoch started last
+   *
+   * @param loss mean training loss of the epoch
+   * @param has_validation true if the epoch is validated
+   * @param validation_loss validation loss of the epoch
+   * @param validation_accuracy validation accuracy of the epoch in percent
+   */
+  void endEpoch(float loss, bool has_validation, float validation_loss,
+                float validation_accuracy);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief publish the counters, only called from the training thread
+   *
+   */
+  void publish(unsigned int epoch_, Clock::rep start_, float loss_,
+               unsigned int iteration_, unsigned int num_samples_);
+
+  /**
+   * @brief read a consistent snapshot of the counters
+   *
+   * @return ml::train::TrainingMetrics metrics of the running epoch
+   */
+  ml::train::TrainingMetrics snapshot() const;
+
+  /**
+   * @brief hand over metrics to the sink and the callback
+   *
+   * @param metrics metrics to report
+   */
+  void report(const ml::train::TrainingMetrics &metrics);
+
+  /**
+   * @brief body of the reporting thread
+   *
+   */
+  void run();
+
+  MetricsSinkType sink;
+  std::chrono::milliseconds interval;
+  unsigned int epochs;
+  Callback callback;
+  MetricsRing &ring;
+  bool active; /**< true if there is a sink or a callback */
+
+  /** counters written by the training thread, guarded by the sequence */
+  std::atomic<unsigned int> seq; /**< odd while the counters are written */
+  std::atomic<unsigned int> epoch;
+  std::atomic<Clock::rep> start; /**< start of the epoch */
+  std::atomic<float> loss;
+  std::atomic<unsigned int> iteration;
+  std::atomic<unsigned int> num_samples;
+
+  std::mutex m;
+  std::condition_variable cv;
+  std::deque<ml::train::TrainingMetrics> pending; /**< ended epochs */
+  bool stop;
+  std::thread reporter;
+};
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __TRAINING_METRICS_H__ */
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   weight_registry.cpp
+ * @date   19 October 2026
+ * @brief  Registry handing the weights of a model over to the other models of
+ * the same configuration in the process
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#include <climits>
+#include <cstdlib>
+#include <functional>
+
+#include <layer_context.h>
+#include <layer_node.h>
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+#include <weight_registry.h>
+
+namespace nntrainer {
+
+/**
+ * @brief call fn on each weight of the model to be saved, in the order of the
+ * saved weights
+ *
+ * @param model model to visit
+ * @param fn function to call with the weight
+ */
+static void forEachWeight(ml::train::Model &model,
+                          const std::function<void(Tensor &)> &fn) {
+  model.forEachLayer(
+    [&fn](ml::train::Layer &, RunLayerContext &rc, void *) {
+      for (unsigned int i = 0; i < rc.getNumWeights(); ++i) {
+        /// shared weights are only kept at the first access, as they are saved
+        if (rc.isGradientLastAccess(i))
+          fn(rc.getWeight(i));
+      }
+    },
+    nullptr);
+}
+
+WeightRegistry &WeightRegistry::Global() {
+  static WeightRegistry instance;
+  return instance;
+}
+
+std::string WeightRegistry::resolveKey(const std::string &path) {
+  char resolved[PATH_MAX];
+  if (::realpath(path.c_str(), resolved) == nullptr)
+    return path;
+
+  return resolved;
+}
+
+unsigned int WeightRegistry::publish(const std::string &key,
+                                     ml::train::Model &model) {
+  auto snapshot = std::make_shared<Snapshot>();
+  forEachWeight(model, [&snapshot](Tensor &w) {
+    snapshot->weights.push_back(w.clone());
+  });
+
+  std::lock_guard<std::mutex> lock(m);
+  snapshot->version = ++last_version;
+  snapshots[key] = std::move(snapshot);
+
+  return last_version;
+}
+
+unsigned int WeightRegistry::pull(const std::string &key,
+                                  ml::train::Model &model,
+                                  unsigned int version) {
+  std::shared_ptr<const Snapshot> snapshot;
+  {
+    std::lock_guard<std::mutex> lock(m);
+    auto it = snapshots.find(key);
+    if (it == snapshots.end() || it->second->version <= version)
+      return version;
+    snapshot = it->second;
+  }
+
+  /// the snapshot is not changed once published, so it is copied unlocked.
+  /// every weight is checked before any is copied, so a mismatch leaves the
+  /// model as it is
+  std::vector<Tensor *> weights;
+  forEachWeight(model, [&weights](Tensor &w) { weights.push_back(&w); });
+  NNTR_THROW_IF(weights.size() != snapshot->weights.size(),
+                std::invalid_argument)
+    << "number of weights does not match the published, model: "
+    << weights.size() << " published: " << snapshot->weights.size()
+    << " key: " << key;
+  for (unsigned int i = 0; i < weights.size(); ++i) {
+    NNTR_THROW_IF(weights[i]->getDim() != snapshot->weights[i].getDim(),
+                  std::invalid_argument)
+      << "dimension of the weight " << i
+      << " does not match the published, key: " << key;
+  }
+
+  for (unsigned int i = 0; i < weights.size(); ++i)
+    weights[i]->copyData(snapshot->weights[i]);
+  model.forEachLayer(
+    [](ml::train::Layer &node, RunLayerContext &rc, void *) {
+      static_cast<LayerNode &>(node).getLayer()->weightsLoaded(rc);
+    },
+    nullptr);
+
+  ml_logd("weights of version %u are pulled, key: %s", snapshot->version,
+          key.c_str());
+  return snapshot->version;
+}
+
+void WeightRegistry::drop(const std::string &key) {
+  std::lock_guard<std::mutex> lock(m);
+  snapshots.erase(key);
+}
+
+} // namespace nntrainer
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   weight_registry.h
+ * @date   19 October 2026
+ * @brief  Registry handing the weights of a model over to the other models of
+ * the same configuration in the process
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#ifndef __WEIGHT_REGISTRY_H__
+#define __WEIGHT_REGISTRY_H__
+#ifdef __cplusplus
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <model.h>
+#include <tensor.h>
+
+namespace nntrainer {
+
+/**
+ * @class   WeightRegistry
+ * @brief   Process wide registry of the latest weights published for a model
+ * configuration.
+ *
+ * A model which is trained publishes its weights under a key, usually the path
+ * of its configuration resolved once by resolveKey(). Other models of the same configuration pull them in
+ * memory, so a model running inference picks up the trained weights without a
+ * file in between. The published weights are a copy, so the publisher keeps
+ * on training while the weights are pulled.
+ *
+ * @note the weights are matched in the order of the layers and of the weights
+ * of each layer, so the models of a key must be of the same graph.
+ */
+class WeightRegistry {
+public:
+  /**
+   * @brief Get the registry of the process
+   *
+   * @return WeightRegistry& registry
+   */
+  static WeightRegistry &Global();
+
+  /**
+   * @brief resolve a path of a configuration to its key, so that the paths of
+   * the same file are the same key. It touches the file system, so the key is
+   * meant to be resolved once and kept by the caller
+   *
+   * @param path path of the configuration
+   * @return std::string key, the path as given if it can not be resolved
+   */
+  static std::string resolveKey(const std::string &path);
+
+  /**
+   * @brief publish a copy of the weights of the model under the key. The
+   * model must not be updated while its weights are copied
+   *
+   * @param key key to publish under
+   * @param model initialized model to publish the weights of
+   * @return unsigned int version of the published weights, starts from 1
+   */
+  unsigned int publish(const std::string &key, ml::train::Model &model);
+
+  /**
+   * @brief pull the weights published under the key into the model, if they
+   * are newer than the version given. The model must not be running. If
+   * nothing newer is published, it is a lookup of the key only
+   *
+   * @param key key to pull from
+   * @param model initialized model to pull the weights into
+   * @param version version of the weights the model has, 0 if none
+   * @return unsigned int version of the weights the model has after the call
+   * @throw std::invalid_argument if the published weights do not match the
+   * weights of the model
+   */
+  unsigned int pull(const std::string &key, ml::train::Model &model,
+                    unsigned int version = 0);
+
+  /**
+   * @brief drop the weights published under the key
+   *
+   * @param key key to drop
+   */
+  void drop(const std::string &key);
+
+private:
+  /**
+   * @brief weights published at once
+   *
+   */
+  struct Snapshot {
+    unsigned int version;
+    std::vector<Tensor> weights; /**< weights in the order of the graph */
+  };
+
+  std::mutex m; /**< guards the snapshots, not the weights they hold */
+  std::map<std::string, std::shared_ptr<const Snapshot>> snapshots;
+  unsigned int last_version = 0;
+};
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __WEIGHT_REGISTRY_H__ */
@@ -27,7 +27,9 @@ enum class ExportMethods;
  */
 enum LearningRateType {
   CONSTANT = 0, /** constant */
-  EXPONENTIAL   /** exponentially decay */
+  EXPONENTIAL,  /** exponentially decay */
+  STEP,         /** step decay */
+  COSINE        /** cosine annealing */
 };
 
 /**
@@ -78,12 +80,23 @@ public:
    * @brief     Default allowed properties
    * Constant Learning rate scheduler
    * - learning_rate : float
+   * - warmup_steps : unsigned int, given to all the schedulers
    *
    * Exponential Learning rate scheduler
    * - learning_rate : float
    * - decay_rate : float,
    * - decay_steps : float,
    *
+   * Step Learning rate scheduler
+   * - learning_rate : float
+   * - decay_rate : float,
+   * - decay_steps : unsigned int,
+   *
+   * Cosine Learning rate scheduler
+   * - learning_rate : float
+   * - decay_steps : unsigned int,
+   * - min_learning_rate : float,
+   *
    * more to be added
    */
 
@@ -22,7 +22,7 @@
 namespace nntrainer {
 
 ConstantLearningRateScheduler::ConstantLearningRateScheduler() :
-  lr_props(props::LearningRate()) {}
+  lr_props(props::LearningRate(), props::WarmupSteps()) {}
 
 void ConstantLearningRateScheduler::finalize() {
   NNTR_THROW_IF(std::get<props::LearningRate>(lr_props).empty(),
@@ -43,7 +43,14 @@ void ConstantLearningRateScheduler::exportTo(
 }
 
 double ConstantLearningRateScheduler::getLearningRate(size_t iteration) {
-  return std::get<props::LearningRate>(lr_props);
+  auto const &[lr, warmup_steps] = lr_props;
+  size_t warmup = warmup_steps.empty() ? 0 : warmup_steps.get();
+
+  if (iteration < warmup) {
+    return lr * (iteration + 1) / (double)warmup;
+  }
+
+  return getDecayedLearningRate(lr, iteration - warmup);
 }
 
 } // namespace nntrainer
@@ -25,6 +25,10 @@ namespace nntrainer {
 /**
  * @class   Constant Learning Rate Scheduler class
  * @brief   class for constant Learning Rate Schedulers
+ *
+ * @details the learning rate linearly rises to its value over the first
+ * warmup_steps iterations if warmup_steps is given. The derived schedulers
+ * decay the learning rate after the warmup.
  */
 class ConstantLearningRateScheduler : public LearningRateScheduler {
 
@@ -70,8 +74,21 @@ public:
 
   inline static const std::string type = "constant";
 
+protected:
+  /**
+   * @brief     get the learning rate decayed for the given iteration after the
+   * warmup
+   *
+   * @param     lr learning rate to decay
+   * @param     iteration iteration counted from the end of the warmup
+   * @retval    decayed learning rate, lr for the constant scheduler
+   */
+  virtual double getDecayedLearningRate(double lr, size_t iteration) {
+    return lr;
+  }
+
 private:
-  std::tuple<props::LearningRate> lr_props;
+  std::tuple<props::LearningRate, props::WarmupSteps> lr_props;
 };
 
 } /* namespace nntrainer */
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   lr_scheduler_cosine.cpp
+ * @date   19 October 2026
+ * @brief  This is Cosine Annealing Learning Rate Scheduler class
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <common_properties.h>
+#include <lr_scheduler_cosine.h>
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+#include <node_exporter.h>
+
+namespace nntrainer {
+
+CosineLearningRateScheduler::CosineLearningRateScheduler() :
+  lr_props(props::DecaySteps(), props::MinLearningRate()) {}
+
+void CosineLearningRateScheduler::finalize() {
+  NNTR_THROW_IF(std::get<props::DecaySteps>(lr_props).empty(),
+                std::invalid_argument)
+    << "[CosineLearningRateScheduler] Decay Steps is not set";
+  ConstantLearningRateScheduler::finalize();
+}
+
+void CosineLearningRateScheduler::setProperty(
+  const std::vector<std::string> &values) {
+  auto left = loadProperties(values, lr_props);
+  ConstantLearningRateScheduler::setProperty(left);
+}
+
+void CosineLearningRateScheduler::exportTo(Exporter &exporter,
+                                           const ExportMethods &method) const {
+  ConstantLearningRateScheduler::exportTo(exporter, method);
+  exporter.saveResult(lr_props, method, this);
+}
+
+double CosineLearningRateScheduler::getDecayedLearningRate(double lr,
+                                                           size_t iteration) {
+  constexpr double pi = 3.14159265358979323846;
+  auto const &[decay_steps, min_lr_prop] = lr_props;
+  double min_lr = min_lr_prop.empty() ? 0.0 : min_lr_prop.get();
+  double steps = decay_steps.get();
+
+  /** stays at min_learning_rate once annealed */
+  double progress = std::min<double>(iteration, steps) / steps;
+  return min_lr + (lr - min_lr) * 0.5 * (1.0 + std::cos(pi * progress));
+}
+
+} // namespace nntrainer
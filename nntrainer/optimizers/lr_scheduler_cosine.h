@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   lr_scheduler_cosine.h
+ * @date   19 October 2026
+ * @brief  This is Cosine Annealing Learning Rate Scheduler class
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#ifndef __LEARNING_RATE_SCHEDULER_COSINE__
+#define __LEARNING_RATE_SCHEDULER_COSINE__
+#ifdef __cplusplus
+
+#include <string>
+
+#include <lr_scheduler_constant.h>
+
+namespace nntrainer {
+
+/**
+ * @class   Cosine Learning Rate Scheduler class
+ * @brief   class for Learning Rate Schedulers which anneal the learning rate
+ * down to min_learning_rate along a half cosine over decay_steps iterations
+ */
+class CosineLearningRateScheduler final : public ConstantLearningRateScheduler {
+
+public:
+  /**
+   * @brief Construct a new cosine learning rate scheduler object
+   *
+   */
+  CosineLearningRateScheduler();
+
+  /**
+   * @copydoc LearningRateScheduler::finalize()
+   *
+   */
+  void finalize() override;
+
+  /**
+   * @copydoc LearningRateScheduler::exportTo(Exporter &exporter, const
+   * ExportMethods& method)
+   *
+   */
+  void exportTo(Exporter &exporter, const ExportMethods &method) const override;
+
+  /**
+   * @copydoc LearningRateScheduler::setProperty(const std::vector<std::string>
+   * &values)
+   */
+  void setProperty(const std::vector<std::string> &values) override;
+
+  /**
+   * @copydoc LearningRateScheduler::getType() const
+   *
+   */
+  const std::string getType() const override {
+    return CosineLearningRateScheduler::type;
+  }
+
+  inline static const std::string type = "cosine";
+
+private:
+  /**
+   * @copydoc ConstantLearningRateScheduler::getDecayedLearningRate(double lr,
+   * size_t iteration)
+   *
+   */
+  double getDecayedLearningRate(double lr, size_t iteration) override;
+
+  std::tuple<props::DecaySteps, props::MinLearningRate> lr_props;
+};
+
+} /* namespace nntrainer */
+
+#endif /* __cplusplus */
+#endif /* __LEARNING_RATE_SCHEDULER_COSINE__ */
@@ -46,8 +46,8 @@ void ExponentialLearningRateScheduler::exportTo(
   exporter.saveResult(lr_props, method, this);
 }
 
-double ExponentialLearningRateScheduler::getLearningRate(size_t iteration) {
-  auto const &lr = ConstantLearningRateScheduler::getLearningRate(iteration);
+double ExponentialLearningRateScheduler::getDecayedLearningRate(
+  double lr, size_t iteration) {
   auto const &[decay_rate, decay_steps] = lr_props;
 
   return lr * pow(decay_rate, (iteration / (float)decay_steps));
@@ -35,12 +35,6 @@ public:
    */
   ExponentialLearningRateScheduler();
 
-  /**
-   * @copydoc LearningRateScheduler::getLearningRate(size_t iteration) const
-   *
-   */
-  double getLearningRate(size_t iteration) override;
-
   /**
    * @copydoc LearningRateScheduler::finalize()
    *
@@ -71,6 +65,13 @@ public:
   inline static const std::string type = "exponential";
 
 private:
+  /**
+   * @copydoc ConstantLearningRateScheduler::getDecayedLearningRate(double lr,
+   * size_t iteration)
+   *
+   */
+  double getDecayedLearningRate(double lr, size_t iteration) override;
+
   std::tuple<props::DecayRate, props::DecaySteps> lr_props;
 };
 
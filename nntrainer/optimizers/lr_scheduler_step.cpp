@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   lr_scheduler_step.cpp
+ * @date   19 October 2026
+ * @brief  This is Step Learning Rate Scheduler class
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <cmath>
+
+#include <common_properties.h>
+#include <lr_scheduler_step.h>
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+#include <node_exporter.h>
+
+namespace nntrainer {
+
+StepLearningRateScheduler::StepLearningRateScheduler() :
+  lr_props(props::DecayRate(), props::DecaySteps()) {}
+
+void StepLearningRateScheduler::finalize() {
+  NNTR_THROW_IF(std::get<props::DecayRate>(lr_props).empty(),
+                std::invalid_argument)
+    << "[StepLearningRateScheduler] Decay Rate is not set";
+  NNTR_THROW_IF(std::get<props::DecaySteps>(lr_props).empty(),
+                std::invalid_argument)
+    << "[StepLearningRateScheduler] Decay Steps is not set";
+  ConstantLearningRateScheduler::finalize();
+}
+
+void StepLearningRateScheduler::setProperty(
+  const std::vector<std::string> &values) {
+  auto left = loadProperties(values, lr_props);
+  ConstantLearningRateScheduler::setProperty(left);
+}
+
+void StepLearningRateScheduler::exportTo(Exporter &exporter,
+                                         const ExportMethods &method) const {
+  ConstantLearningRateScheduler::exportTo(exporter, method);
+  exporter.saveResult(lr_props, method, this);
+}
+
+double StepLearningRateScheduler::getDecayedLearningRate(double lr,
+                                                         size_t iteration) {
+  auto const &[decay_rate, decay_steps] = lr_props;
+
+  return lr * pow(decay_rate, iteration / decay_steps.get());
+}
+
+} // namespace nntrainer
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   lr_scheduler_step.h
+ * @date   19 October 2026
+ * @brief  This is Step Learning Rate Scheduler class
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#ifndef __LEARNING_RATE_SCHEDULER_STEP__
+#define __LEARNING_RATE_SCHEDULER_STEP__
+#ifdef __cplusplus
+
+#include <string>
+
+#include <lr_scheduler_constant.h>
+
+namespace nntrainer {
+
+/**
+ * @class   Step Learning Rate Scheduler class
+ * @brief   class for Learning Rate Schedulers which decay the learning rate by
+ * decay_rate every decay_steps iterations
+ */
+class StepLearningRateScheduler final : public ConstantLearningRateScheduler {
+
+public:
+  /**
+   * @brief Construct a new step learning rate scheduler object
+   *
+   */
+  StepLearningRateScheduler();
+
+  /**
+   * @copydoc LearningRateScheduler::finalize()
+   *
+   */
+  void finalize() override;
+
+  /**
+   * @copydoc LearningRateScheduler::exportTo(Exporter &exporter, const
+   * ExportMethods& method)
+   *
+   */
+  void exportTo(Exporter &exporter, const ExportMethods &method) const override;
+
+  /**
+   * @copydoc LearningRateScheduler::setProperty(const std::vector<std::string>
+   * &values)
+   */
+  void setProperty(const std::vector<std::string> &values) override;
+
+  /**
+   * @copydoc LearningRateScheduler::getType() const
+   *
+   */
+  const std::string getType() const override {
+    return StepLearningRateScheduler::type;
+  }
+
+  inline static const std::string type = "step";
+
+private:
+  /**
+   * @copydoc ConstantLearningRateScheduler::getDecayedLearningRate(double lr,
+   * size_t iteration)
+   *
+   */
+  double getDecayedLearningRate(double lr, size_t iteration) override;
+
+  std::tuple<props::DecayRate, props::DecaySteps> lr_props;
+};
+
+} /* namespace nntrainer */
+
+#endif /* __cplusplus */
+#endif /* __LEARNING_RATE_SCHEDULER_STEP__ */
@@ -40,6 +40,6 @@ Tensor &RunOptimizerContext::getOptimizerVariable(unsigned int idx) const {
  * @brief   Apply the gradient with the given learning rate
  */
 void RunOptimizerContext::applyGradient(double lr) const {
-  weight->applyGradient(lr);
+  weight->applyGradient(lr * lr_scale * weight->getLearningRateMultiplier());
 }
 } // namespace nntrainer
@@ -33,10 +33,16 @@ public:
   /**
    * @brief Construct a new Run Optimizer Context object
    *
+   * @param w weight to optimize
+   * @param iter iteration number
+   * @param lr_scale scale applied to the learning rate given to
+   * applyGradient()
    */
-  RunOptimizerContext(Weight *w = nullptr, size_t iter = 0) :
+  RunOptimizerContext(Weight *w = nullptr, size_t iter = 0,
+                      double lr_scale = 1.0) :
     weight(w),
-    iteration(iter) {}
+    iteration(iter),
+    lr_scale(lr_scale) {}
 
   /**
    * @brief Get the Weight tensor object
@@ -68,7 +74,9 @@ public:
   bool readyToUse() const { return weight != nullptr; }
 
   /**
-   * @brief   Apply the gradient with the given learning rate
+   * @brief   Apply the gradient with the given learning rate, scaled by the
+   * learning rate scale of the context and the learning rate multiplier of
+   * the weight
    *
    * @param lr learning rate
    */
@@ -84,6 +92,7 @@ public:
 private:
   Weight *weight;   /**< weights for the optimizer */
   size_t iteration; /**< iteration number */
+  double lr_scale;  /**< scale of the learning rate */
 };
 
 } // namespace nntrainer
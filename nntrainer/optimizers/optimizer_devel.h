@@ -24,6 +24,7 @@
 
 namespace nntrainer {
 
+class AppContext;
 class Exporter;
 enum class ExportMethods;
 
@@ -76,6 +77,13 @@ public:
    */
   virtual void finalize(){};
 
+  /**
+   * @brief     set the app context the optimizer creates its objects from,
+   * which is the context of the model the optimizer is set to
+   * @param[in] context app context
+   */
+  virtual void setAppContext(const AppContext &context){};
+
   /**
    * @brief     Read Training optimizer paramters from file
    * @param[in] file input stream file
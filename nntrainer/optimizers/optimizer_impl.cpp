@@ -16,6 +16,7 @@
 #include <fstream>
 #include <iostream>
 
+#include <app_context.h>
 #include <common_properties.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
@@ -27,20 +28,89 @@ namespace nntrainer {
 
 OptimizerImpl::OptimizerImpl() :
   optimizer_impl_props(props::LearningRate(), props::DecayRate(),
-                       props::DecaySteps()) {}
+                       props::DecaySteps()),
+  lr_scheduler_props(props::LearningRateSchedulerType()),
+  lr_scheduler(nullptr),
+  app_context(nullptr) {}
+
+/**
+ * @brief get the properties saved to the exporter as key=value strings
+ *
+ * @param e exporter the properties are saved to
+ * @return std::vector<std::string> saved properties
+ */
+static std::vector<std::string> getPropertyStrings(Exporter &e) {
+  auto props = e.getResult<ExportMethods::METHOD_STRINGVECTOR>();
+  std::vector<std::string> values;
+  for (auto &entry : *props) {
+    values.push_back(entry.first + "=" + entry.second);
+  }
+  return values;
+}
 
 void OptimizerImpl::setProperty(const std::vector<std::string> &values) {
-  auto left = loadProperties(values, optimizer_impl_props);
-  NNTR_THROW_IF(left.size(), std::invalid_argument)
-    << "[OptimizerImpl] There are unparsed properties";
+  auto left = loadProperties(values, lr_scheduler_props);
+  auto const &lr_scheduler_type =
+    std::get<props::LearningRateSchedulerType>(lr_scheduler_props);
+
+  if (lr_scheduler_type.empty()) {
+    left = loadProperties(left, optimizer_impl_props);
+    NNTR_THROW_IF(left.size(), std::invalid_argument)
+      << "[OptimizerImpl] There are unparsed properties";
+    return;
+  }
+
+  if (!lr_scheduler ||
+      !istrequal(lr_scheduler->getType(), lr_scheduler_type.get())) {
+    /** the learning rate properties set so far move over to the scheduler */
+    Exporter e;
+    e.saveResult(optimizer_impl_props, ExportMethods::METHOD_STRINGVECTOR,
+                 this);
+
+    lr_scheduler = getAppContext().createObject<LearningRateScheduler>(
+      lr_scheduler_type, getPropertyStrings(e));
+    optimizer_impl_props = decltype(optimizer_impl_props)();
+  }
+
+  lr_scheduler->setProperty(left);
+}
+
+void OptimizerImpl::setAppContext(const AppContext &context) {
+  app_context = std::make_shared<const AppContext>(context);
+
+  if (lr_scheduler) {
+    Exporter e;
+    lr_scheduler->exportTo(e, ExportMethods::METHOD_STRINGVECTOR);
+    lr_scheduler = app_context->createObject<LearningRateScheduler>(
+      std::get<props::LearningRateSchedulerType>(lr_scheduler_props),
+      getPropertyStrings(e));
+  }
+}
+
+const AppContext &OptimizerImpl::getAppContext() const {
+  return app_context ? *app_context : AppContext::Global();
+}
+
+void OptimizerImpl::finalize() {
+  if (lr_scheduler) {
+    lr_scheduler->finalize();
+  }
 }
 
 void OptimizerImpl::exportTo(Exporter &exporter,
                              const ExportMethods &method) const {
   exporter.saveResult(optimizer_impl_props, method, this);
+  exporter.saveResult(lr_scheduler_props, method, this);
+  if (lr_scheduler) {
+    lr_scheduler->exportTo(exporter, method);
+  }
 }
 
 double OptimizerImpl::getLearningRate(size_t iteration) const {
+  if (lr_scheduler) {
+    return lr_scheduler->getLearningRate(iteration);
+  }
+
 
   auto &[float_lr, decay_rate, decay_steps] = optimizer_impl_props;
   double ll = float_lr;
@@ -16,9 +16,11 @@
 #define __OPTIMIZER_IMPL_H__
 #ifdef __cplusplus
 
+#include <memory>
 #include <tuple>
 
 #include <common_properties.h>
+#include <lr_scheduler.h>
 #include <optimizer_devel.h>
 
 namespace nntrainer {
@@ -61,7 +63,8 @@ public:
   OptimizerImpl &operator=(OptimizerImpl &&rhs) noexcept = default;
 
   /**
-   * @brief     get Learning Rate for the given iteration
+   * @brief     get Learning Rate for the given iteration, given by the
+   * learning rate scheduler if it is set
    * @param[in] iteration Iteration for the learning rate
    * @retval    Learning rate
    */
@@ -69,9 +72,23 @@ public:
 
   /**
    * @copydoc Optimizer::setProperty(const std::vector<std::string> &values)
+   * @details   If learning_rate_scheduler is given, the learning rate
+   * properties are handed over to the scheduler of that type.
    */
   void setProperty(const std::vector<std::string> &values) override;
 
+  /**
+   * @copydoc Optimizer::finalize()
+   */
+  void finalize() override;
+
+  /**
+   * @copydoc Optimizer::setAppContext(const AppContext &context)
+   * @details   The learning rate scheduler set so far is created again from
+   * the given context.
+   */
+  void setAppContext(const AppContext &context) override;
+
   /**
    * @copydoc Optimizer::exportTo(Exporter &exporter, const ExportMethods&
    * method)
@@ -91,6 +108,19 @@ public:
 protected:
   std::tuple<props::LearningRate, props::DecayRate, props::DecaySteps>
     optimizer_impl_props;
+
+private:
+  std::tuple<props::LearningRateSchedulerType> lr_scheduler_props;
+  std::shared_ptr<LearningRateScheduler>
+    lr_scheduler; /**< learning rate scheduler, can be null */
+  std::shared_ptr<const AppContext>
+    app_context; /**< context of the scheduler, global one if null */
+
+  /**
+   * @brief     get the context the learning rate scheduler is created from
+   * @retval    app context
+   */
+  const AppContext &getAppContext() const;
 };
 
 } /* namespace nntrainer */
@@ -104,6 +104,14 @@ public:
    */
   void finalize() override { optimizer_devel->finalize(); }
 
+  /**
+   * @brief     set the app context the optimizer creates its objects from
+   * @param[in] context app context
+   */
+  void setAppContext(const AppContext &context) override {
+    optimizer_devel->setAppContext(context);
+  }
+
   /**
    * @brief     Read Training optimizer paramters from file
    * @param[in] file input stream file
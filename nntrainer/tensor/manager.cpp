@@ -366,7 +366,7 @@ std::vector<Weight *> Manager::requestWeights(
 
   for (unsigned int i = 0; i < weights_spec.size(); ++i) {
     auto &[dim, t_initializer, w_reg, w_reg_const, decay, clip_by_global_norm,
-           need_gradient, name] = weights_spec.at(i);
+           lr_multiplier, need_gradient, name] = weights_spec.at(i);
     auto grad_exec_order = default_grad_exec_order;
     /**
      * If the weight is supposed to be clip by global norm, extend its exec
@@ -402,7 +402,8 @@ std::vector<Weight *> Manager::requestWeights(
     }
 
     weights_v2.emplace_back(std::make_unique<Weight>(
-      var, grad, w_reg, w_reg_const, decay, is_dependent, clip_by_global_norm));
+      var, grad, w_reg, w_reg_const, decay, is_dependent, clip_by_global_norm,
+      lr_multiplier));
   }
 
   std::transform(weights_v2.begin() + current_size, weights_v2.end(),
@@ -488,7 +489,8 @@ Manager::requestTensors(const GraphNode &node,
 std::vector<Var_Grad *>
 Manager::requestInputs(const GraphNode &node,
                        const std::vector<TensorDim> &inputs_dim,
-                       const std::vector<std::string> &outputs_name) {
+                       const std::vector<std::string> &outputs_name,
+                       TensorLifespan steps) {
   using RT = TensorSpecV2::RequestType;
 
   TensorSpecV2 var_common_spec, grad_common_spec;
@@ -501,6 +503,16 @@ Manager::requestInputs(const GraphNode &node,
       node.getType() == BatchNormalizationLayer::type)
     var_common_spec.ls = TensorLifespan::FORWARD_FUNC_LIFESPAN;
 
+  /// the tensors are not kept for the backwarding steps which are not run
+  if (steps == TensorLifespan::UNMANAGED)
+    var_common_spec.ls = TensorLifespan::FORWARD_FUNC_LIFESPAN;
+  /// some layers, such as the recurrent cells, give the derivatives of the
+  /// inputs while calculating the gradient
+  grad_common_spec.ls =
+    enum_class_logical_and(steps, TensorLifespan::CALC_DERIV_LIFESPAN)
+      ? steps
+      : TensorLifespan::UNMANAGED;
+
   std::vector<Var_Grad *> ret;
   size_t current_size = inputs_v2.size();
 
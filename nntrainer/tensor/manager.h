@@ -213,6 +213,8 @@ public:
    * @param node Graph node to extract node identifiers/info
    * @param inputs_dim Specficiation for the tensors
    * @param outputs_name Name of the already requested output tensors
+   * @param steps calc gradient and calc derivative lifespans of the
+   * backwarding steps the node runs
    *
    * @return created tensors list
    *
@@ -221,11 +223,14 @@ public:
    * Var_Grad share tensors with the already allocated Var_Grad for outputs,
    * named with outputs_name. In this case, the input_dim and the shape of the
    * output_tensors must match. If the outputs_name are empty, then new tensors
-   * will be allocated.
+   * will be allocated. The inputs of a node which is not backwarded are only
+   * kept for the forwarding, and the derivatives are only kept if the node
+   * calculates them.
    */
   std::vector<Var_Grad *>
   requestInputs(const GraphNode &node, const std::vector<TensorDim> &inputs_dim,
-                const std::vector<std::string> &outputs_name = {});
+                const std::vector<std::string> &outputs_name = {},
+                TensorLifespan steps = TensorLifespan::BACKWARD_FUNC_LIFESPAN);
 
   /**
    * @brief     Get all the weights which match the above condition
@@ -319,6 +324,25 @@ public:
     tensor_pool.setBatchSize(name, batch);
   }
 
+  /**
+   * @brief Place the tensor @a dest inside @a src at @a offset for the next
+   * allocation, see TensorPool::mergeInto()
+   *
+   * @param dest name of the tensor to be placed
+   * @param src name of the tensor to place into
+   * @param offset elementwise offset from @a src
+   * @return true if placed, else false
+   */
+  bool mergeTensors(const std::string &dest, const std::string &src,
+                    unsigned int offset) {
+    return tensor_pool.mergeInto(dest, src, offset);
+  }
+
+  /**
+   * @brief Undo all the placements done by mergeTensors()
+   */
+  void clearMergedTensors() { tensor_pool.clearMerged(); }
+
   /**
    * @brief Allocate memory for all the managed tensors
    *
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <fstream>
@@ -30,7 +31,6 @@
 #include <iostream>
 #include <iterator>
 #include <numeric>
-#include <random>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
@@ -43,20 +43,6 @@
 #include <tensor.h>
 #include <util_func.h>
 
-#define transposeloop(cl, ci, cj, ck, sl, si, sj, sk)                 \
-  do {                                                                \
-    unsigned int i, j, k, l;                                          \
-    int inidx = 0, outidx = 0;                                        \
-    for (cl = 0; cl < sl; cl++)                                       \
-      for (ci = 0; ci < si; ci++)                                     \
-        for (cj = 0; cj < sj; cj++)                                   \
-          for (ck = 0; ck < sk; ck++) {                               \
-            outidx = si * sj * sk * cl + sj * sk * ci + sk * cj + ck; \
-            inidx = l * SI * SJ * SK + i * SJ * SK + j * SK + k;      \
-            outptr[outidx] = inptr[inidx];                            \
-          }                                                           \
-  } while (0);
-
 #define CREATE_IF_EMPTY_DIMS(tensor, ...) \
   do {                                    \
     if (tensor.empty())                   \
@@ -86,11 +72,476 @@ struct Tensor::BroadcastInfo {
     strides; /**< modified strides for the loop */
 };
 
-static auto rng = [] {
-  std::mt19937 rng;
-  rng.seed(getSeed());
-  return rng;
-}();
+/**
+ * @brief minimum number of elements for an elementwise kernel to be split
+ * over the openmp threads. Below this, thread spawning costs more than the
+ * work itself
+ */
+static constexpr unsigned int parallel_threshold = 1u << 15;
+
+/**
+ * @brief edge length of the square blocks a transpose is tiled with. A block
+ * of 16 floats spans a whole cache line on both the read and the write side
+ */
+static constexpr unsigned int transpose_tile = 16;
+
+/**
+ * @brief transpose a full tile, dst[r][c] = src[c][r]
+ * @note the bounds are compile time constants so that the compiler can unroll
+ * and vectorize the block
+ */
+template <unsigned int T>
+static inline void transpose_block(const float *src, unsigned int ld_src,
+                                   float *dst, unsigned int ld_dst) {
+  for (unsigned int r = 0; r < T; ++r)
+    for (unsigned int c = 0; c < T; ++c)
+      dst[r * ld_dst + c] = src[c * ld_src + r];
+}
+
+/**
+ * @brief transpose a rows x cols plane, dst[r][c] = src[c][r], one band of
+ * transpose_tile rows
+ */
+static void transpose_band(const float *src, unsigned int ld_src, float *dst,
+                           unsigned int ld_dst, unsigned int rows,
+                           unsigned int cols) {
+  constexpr unsigned int T = transpose_tile;
+  unsigned int c0 = 0;
+  if (rows == T) {
+    for (; c0 + T <= cols; c0 += T)
+      transpose_block<T>(src + c0 * ld_src, ld_src, dst + c0, ld_dst);
+  }
+
+  for (unsigned int r = 0; r < rows; ++r)
+    for (unsigned int c = c0; c < cols; ++c)
+      dst[r * ld_dst + c] = src[c * ld_src + r];
+}
+
+/**
+ * @brief transpose the feature axes of contiguous batched data
+ *
+ * @param in input data
+ * @param out output data, must not alias @a in
+ * @param batch number of batches
+ * @param out_dims size of the output channel, height and width
+ * @param in_strides stride in the input of each output axis
+ */
+static void transpose_feature(const float *in, float *out, unsigned int batch,
+                              const std::array<unsigned int, 3> &out_dims,
+                              const std::array<unsigned int, 3> &in_strides) {
+  const unsigned int feature_len = out_dims[0] * out_dims[1] * out_dims[2];
+  const unsigned int len = batch * feature_len;
+  const std::array<unsigned int, 2> out_strides = {out_dims[1] * out_dims[2],
+                                                   out_dims[2]};
+
+  /// width is kept, copy a row at a time
+  if (in_strides[2] == 1) {
+    const unsigned int rows = batch * out_dims[0] * out_dims[1];
+#pragma omp parallel for if (len >= parallel_threshold)
+    for (unsigned int r = 0; r < rows; ++r) {
+      unsigned int b = r / (out_dims[0] * out_dims[1]);
+      unsigned int rem = r % (out_dims[0] * out_dims[1]);
+      const float *src = in + b * feature_len +
+                         rem / out_dims[1] * in_strides[0] +
+                         rem % out_dims[1] * in_strides[1];
+      std::copy(src, src + out_dims[2], out + r * out_dims[2]);
+    }
+    return;
+  }
+
+  /// p is the output axis which is contiguous in the input, q is the
+  /// remaining one. For each index of q, a (p, width) plane is transposed.
+  const unsigned int p = in_strides[0] == 1 ? 0 : 1;
+  const unsigned int q = 1 - p;
+  const unsigned int rows = out_dims[p], cols = out_dims[2];
+  const unsigned int bands = (rows + transpose_tile - 1) / transpose_tile;
+  const unsigned int planes = batch * out_dims[q];
+
+#pragma omp parallel for if (len >= parallel_threshold)
+  for (unsigned int t = 0; t < planes * bands; ++t) {
+    unsigned int plane = t / bands;
+    unsigned int r0 = t % bands * transpose_tile;
+    unsigned int b = plane / out_dims[q], x = plane % out_dims[q];
+
+    const float *src = in + b * feature_len + x * in_strides[q] + r0;
+    float *dst = out + b * feature_len + x * out_strides[q] +
+                 r0 * out_strides[p];
+    transpose_band(src, in_strides[2], dst, out_strides[p],
+                   std::min(transpose_tile, rows - r0), cols);
+  }
+}
+
+/**
+ * @brief swap two feature axes of the same size in place
+ *
+ * @param data data to transpose
+ * @param batch number of batches
+ * @param n size of the swapped axes
+ * @param stride_a stride of the first swapped axis
+ * @param stride_b stride of the second swapped axis
+ * @param len_r size of the remaining axis
+ * @param stride_r stride of the remaining axis
+ */
+static void transpose_square_inplace(float *data, unsigned int batch,
+                                     unsigned int n, unsigned int stride_a,
+                                     unsigned int stride_b, unsigned int len_r,
+                                     unsigned int stride_r) {
+  constexpr unsigned int T = transpose_tile;
+  const unsigned int feature_len = n * n * len_r;
+  const unsigned int planes = batch * len_r;
+
+#pragma omp parallel for if (planes * feature_len >= parallel_threshold)
+  for (unsigned int t = 0; t < planes; ++t) {
+    float *base = data + t / len_r * feature_len + t % len_r * stride_r;
+    for (unsigned int a0 = 0; a0 < n; a0 += T) {
+      unsigned int a_end = std::min(a0 + T, n);
+      for (unsigned int b0 = a0; b0 < n; b0 += T) {
+        unsigned int b_end = std::min(b0 + T, n);
+        for (unsigned int a = a0; a < a_end; ++a)
+          for (unsigned int b = std::max(b0, a + 1); b < b_end; ++b)
+            std::swap(base[a * stride_a + b * stride_b],
+                      base[b * stride_a + a * stride_b]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief number of elements a pairwise summation adds up directly before
+ * splitting the range in halves
+ */
+static constexpr unsigned int pairwise_block = 128;
+
+/**
+ * @brief number of independent accumulators of the reduction kernels. Each
+ * lane is accumulated on its own, which lets the compiler vectorize the loop
+ * without reassociating the additions
+ */
+static constexpr unsigned int reduce_lanes = 8;
+
+/**
+ * @brief sum contiguous elements with pairwise summation, the error grows
+ * with log(len) instead of len
+ */
+static float sum_pairwise(const float *x, unsigned int len) {
+  if (len > pairwise_block) {
+    unsigned int half = len / 2 / reduce_lanes * reduce_lanes;
+    return sum_pairwise(x, half) + sum_pairwise(x + half, len - half);
+  }
+
+  float acc[reduce_lanes] = {0.0f};
+  unsigned int i = 0;
+  for (; i + reduce_lanes <= len; i += reduce_lanes)
+    for (unsigned int l = 0; l < reduce_lanes; ++l)
+      acc[l] += x[i + l];
+
+  float sum = 0.0f;
+  for (; i < len; ++i)
+    sum += x[i];
+  for (unsigned int l = 0; l < reduce_lanes; ++l)
+    sum += acc[l];
+
+  return sum;
+}
+
+/**
+ * @brief reduce sum over the flagged axes, out = alpha * sum + beta * out
+ * @note contiguous runs are summed pairwise, while runs which are strided over
+ * the reduced axes are accumulated elementwise with kahan compensation.
+ * Independent outputs are split over the openmp threads.
+ *
+ * @param in contiguous input data
+ * @param dims dimension of the input
+ * @param reduce axes to be reduced
+ * @param out contiguous output data, shaped as @a dims with the reduced axes
+ * being 1
+ * @param alpha scale of the sum
+ * @param beta scale of the previous output, out is not read when zero
+ */
+static void reduce_sum(const float *in, const unsigned int *dims,
+                       const std::array<bool, TensorDim::MAXDIM> &reduce,
+                       float *out, float alpha, float beta) {
+  /// merge neighbouring axes of the same kind, so that the groups alternate
+  /// between kept and reduced from the outermost one. Axes of size 1 can be
+  /// either of them and are skipped.
+  struct Group {
+    unsigned int size;
+    unsigned int stride;
+    bool reduced;
+  };
+  std::vector<Group> groups;
+  for (unsigned int i = 0; i < TensorDim::MAXDIM; ++i) {
+    if (dims[i] == 1)
+      continue;
+    if (!groups.empty() && groups.back().reduced == reduce[i])
+      groups.back().size *= dims[i];
+    else
+      groups.push_back({dims[i], 0, reduce[i]});
+  }
+
+  unsigned int len = 1;
+  for (auto it = groups.rbegin(); it != groups.rend(); ++it) {
+    it->stride = len;
+    len *= it->size;
+  }
+
+  auto store = [alpha, beta](float &o, float sum) {
+    o = beta == 0.0f ? alpha * sum : alpha * sum + beta * o;
+  };
+
+  if (groups.empty()) {
+    store(*out, *in);
+    return;
+  }
+
+  /// the innermost group is handled by the kernels, the others are walked
+  std::vector<Group> kept, reduced;
+  for (unsigned int i = 0; i + 1 < groups.size(); ++i)
+    (groups[i].reduced ? reduced : kept).push_back(groups[i]);
+
+  /// offset in the input of the idx-th element of the given groups
+  auto offset_of = [](unsigned int idx, const std::vector<Group> &g) {
+    unsigned int offset = 0;
+    for (auto it = g.rbegin(); it != g.rend(); ++it) {
+      offset += idx % it->size * it->stride;
+      idx /= it->size;
+    }
+    return offset;
+  };
+
+  auto count_of = [](const std::vector<Group> &g) {
+    unsigned int count = 1;
+    for (auto &group : g)
+      count *= group.size;
+    return count;
+  };
+
+  const unsigned int run = groups.back().size;
+  const unsigned int num_out = count_of(kept);
+  const unsigned int num_runs = count_of(reduced);
+
+  if (groups.back().reduced) {
+    /// every output sums num_runs contiguous runs
+    if (num_out == 1 && num_runs == 1 && len >= parallel_threshold) {
+      /// a single long run, sum chunks in parallel and add them up in order
+      constexpr unsigned int chunk = parallel_threshold / 4;
+      const unsigned int num_chunks = (run + chunk - 1) / chunk;
+      std::vector<float> partial(num_chunks);
+#pragma omp parallel for
+      for (unsigned int c = 0; c < num_chunks; ++c)
+        partial[c] = sum_pairwise(in + c * chunk, std::min(chunk, run - c * chunk));
+      store(*out, sum_pairwise(partial.data(), num_chunks));
+      return;
+    }
+
+#pragma omp parallel for if (len >= parallel_threshold)
+    for (unsigned int o = 0; o < num_out; ++o) {
+      const float *base = in + offset_of(o, kept);
+      float sum = 0.0f;
+      for (unsigned int r = 0; r < num_runs; ++r)
+        sum += sum_pairwise(base + offset_of(r, reduced), run);
+      store(out[o], sum);
+    }
+    return;
+  }
+
+  /// every output row of length run accumulates num_runs input rows
+#pragma omp parallel if (len >= parallel_threshold)
+  {
+    std::vector<float> acc(run), comp(run);
+#pragma omp for
+    for (unsigned int o = 0; o < num_out; ++o) {
+      const float *base = in + offset_of(o, kept);
+      std::fill(acc.begin(), acc.end(), 0.0f);
+      std::fill(comp.begin(), comp.end(), 0.0f);
+      float *a = acc.data(), *c = comp.data();
+
+      for (unsigned int r = 0; r < num_runs; ++r) {
+        const float *src = base + offset_of(r, reduced);
+        for (unsigned int i = 0; i < run; ++i) {
+          float y = src[i] - c[i];
+          float t = a[i] + y;
+          c[i] = (t - a[i]) - y;
+          a[i] = t;
+        }
+      }
+
+      float *dst = out + o * run;
+      for (unsigned int i = 0; i < run; ++i)
+        store(dst[i], a[i]);
+    }
+  }
+}
+
+/**
+ * @brief index of the first maximum of contiguous elements. NaN is taken as
+ * greater than any number, so the first NaN is reported if there is any
+ */
+static unsigned int argmax_contiguous(const float *x, unsigned int len) {
+  if (len == 0)
+    return 0;
+
+  /** once NaN, a lane stays NaN as nothing compares greater than NaN */
+  auto greater = [](float a, float b) { return a > b || std::isnan(a); };
+
+  float max[reduce_lanes];
+  std::fill(max, max + reduce_lanes, x[0]);
+
+  unsigned int i = 0;
+  for (; i + reduce_lanes <= len; i += reduce_lanes)
+    for (unsigned int l = 0; l < reduce_lanes; ++l)
+      max[l] = greater(x[i + l], max[l]) ? x[i + l] : max[l];
+
+  float max_val = max[0];
+  for (unsigned int l = 1; l < reduce_lanes; ++l)
+    max_val = greater(max[l], max_val) ? max[l] : max_val;
+  for (; i < len; ++i)
+    max_val = greater(x[i], max_val) ? x[i] : max_val;
+
+  if (std::isnan(max_val))
+    return std::distance(
+      x, std::find_if(x, x + len, [](float v) { return std::isnan(v); }));
+
+  return std::distance(x, std::find(x, x + len, max_val));
+}
+
+/**
+ * @brief check if strides lay out the dimension without gaps. Axes of size 1
+ * do not matter
+ */
+static bool is_packed(const TensorDim &dim,
+                      const std::array<unsigned int, TensorDim::MAXDIM> &strides) {
+  unsigned int expected = 1;
+  for (int axis = TensorDim::MAXDIM - 1; axis >= 0; --axis) {
+    if (dim.getTensorDim(axis) == 1)
+      continue;
+    if (strides[axis] != expected)
+      return false;
+    expected *= dim.getTensorDim(axis);
+  }
+  return true;
+}
+
+/**
+ * @brief stride between the rows of a tensor seen as a (batch * channel *
+ * height) x width matrix, which is the leading dimension to pass to blas
+ * @retval 0 if the tensor cannot be seen as such a matrix
+ */
+static unsigned int row_stride(const Tensor &t) {
+  const TensorDim &dim = t.getDim();
+  const auto strides = t.getStrides();
+
+  if (dim.width() > 1 && strides[3] != 1)
+    return 0;
+
+  unsigned int ld = 0, rows = 1;
+  for (int axis = 2; axis >= 0; --axis) {
+    if (dim.getTensorDim(axis) == 1)
+      continue;
+    if (ld == 0)
+      ld = strides[axis];
+    else if (strides[axis] != ld * rows)
+      return 0;
+    rows *= dim.getTensorDim(axis);
+  }
+
+  if (ld == 0)
+    return dim.width();
+
+  return ld < dim.width() ? 0 : ld;
+}
+
+/**
+ * @brief apply op(x, y, out) elementwise over tensors of any strides. The
+ * elements are matched by the index in the dimension of @a x
+ * @note rows are split over the openmp threads, and rows of unit strides are
+ * left to be vectorized
+ */
+template <typename T>
+static void apply_strided(const Tensor &x, const Tensor &y, Tensor &out,
+                          T op) {
+  const TensorDim &dim = x.getDim();
+  const auto xs = x.getStrides(), ys = y.getStrides(), os = out.getStrides();
+  const float *x_data = x.getData();
+  const float *y_data = y.getData();
+  float *out_data = out.getData();
+
+  const unsigned int width = dim.width();
+  const unsigned int rows = dim.batch() * dim.channel() * dim.height();
+  const bool unit = xs[3] == 1 && ys[3] == 1 && os[3] == 1;
+
+#pragma omp parallel for if (rows * width >= parallel_threshold)
+  for (unsigned int r = 0; r < rows; ++r) {
+    unsigned int h = r % dim.height();
+    unsigned int c = r / dim.height() % dim.channel();
+    unsigned int b = r / dim.height() / dim.channel();
+
+    const float *xp = x_data + b * xs[0] + c * xs[1] + h * xs[2];
+    const float *yp = y_data + b * ys[0] + c * ys[1] + h * ys[2];
+    float *op_ = out_data + b * os[0] + c * os[1] + h * os[2];
+
+    if (unit) {
+      for (unsigned int w = 0; w < width; ++w)
+        op(xp[w], yp[w], op_[w]);
+    } else {
+      for (unsigned int w = 0; w < width; ++w)
+        op(xp[w * xs[3]], yp[w * ys[3]], op_[w * os[3]]);
+    }
+  }
+}
+
+/**
+ * @brief Philox4x32-10 counter based random number generator
+ * @note every block of four words is a pure function of the key and the
+ * counter, so any element can be generated independently of the others. A
+ * tensor is filled in parallel with the same values regardless of the number
+ * of threads. (Salmon et al., Parallel random numbers: as easy as 1, 2, 3)
+ */
+static inline void philox4x32(uint64_t counter, uint64_t key, uint32_t out[4]) {
+  constexpr uint32_t mul0 = 0xD2511F53, mul1 = 0xCD9E8D57;
+  constexpr uint32_t weyl0 = 0x9E3779B9, weyl1 = 0xBB67AE85;
+
+  uint32_t c0 = (uint32_t)counter, c1 = (uint32_t)(counter >> 32), c2 = 0,
+           c3 = 0;
+  uint32_t k0 = (uint32_t)key, k1 = (uint32_t)(key >> 32);
+
+  for (unsigned int round = 0; round < 10; ++round) {
+    uint64_t p0 = (uint64_t)mul0 * c0;
+    uint64_t p1 = (uint64_t)mul1 * c2;
+    uint32_t hi0 = p0 >> 32, lo0 = (uint32_t)p0;
+    uint32_t hi1 = p1 >> 32, lo1 = (uint32_t)p1;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += weyl0;
+    k1 += weyl1;
+  }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+/**
+ * @brief uniform float in [0, 1) from the upper 24 bits of a random word
+ */
+static inline float to_unit_float(uint32_t bits) {
+  return (bits >> 8) * (1.0f / (1u << 24));
+}
+
+/**
+ * @brief key of the tensor random number generator
+ */
+static const uint64_t rng_key = getSeed();
+
+/**
+ * @brief next unused counter of the tensor random number generator. Every
+ * call reserves the blocks it needs, so consecutive calls draw disjoint
+ * streams
+ */
+static std::atomic<uint64_t> rng_counter{0};
 
 Tensor::Tensor(const TensorDim &d, bool alloc_now, Tensor::Initializer init,
                std::string name_) :
@@ -240,25 +691,50 @@ template <typename T> void Tensor::setDist(T dist) {
     << getName() << " Tensor is not contiguous, cannot set distribution";
 
   float *data = getData();
-  unsigned int len = size();
-  for (unsigned int i = 0; i < len; ++i) {
-    data[i] = dist(rng);
+  const unsigned int len = size();
+  const unsigned int blocks = (len + 3) / 4;
+  const uint64_t counter = rng_counter.fetch_add(blocks);
+
+#pragma omp parallel for if (len >= parallel_threshold)
+  for (unsigned int b = 0; b < blocks; ++b) {
+    uint32_t bits[4];
+    float values[4];
+    philox4x32(counter + b, rng_key, bits);
+    dist(bits, values);
+
+    const unsigned int n = std::min(4u, len - b * 4);
+    std::copy(values, values + n, data + b * 4);
   }
 }
 
 void Tensor::setRandNormal(float mean, float std) {
-  setDist<std::normal_distribution<float>>(
-    std::normal_distribution<float>(mean, std));
+  /// box-muller transform, two pairs of uniforms make four normals
+  setDist([mean, std](const uint32_t *bits, float *values) {
+    constexpr float two_pi = 6.283185307179586f;
+    for (unsigned int i = 0; i < 4; i += 2) {
+      /// (0, 1] to keep the log finite
+      float u1 = 1.0f - to_unit_float(bits[i]);
+      float u2 = to_unit_float(bits[i + 1]);
+      float r = std::sqrt(-2.0f * std::log(u1));
+      values[i] = mean + std * r * std::cos(two_pi * u2);
+      values[i + 1] = mean + std * r * std::sin(two_pi * u2);
+    }
+  });
 }
 
 void Tensor::setRandUniform(float min, float max) {
-  setDist<std::uniform_real_distribution<float>>(
-    std::uniform_real_distribution<float>(min, max));
+  const float range = max - min;
+  setDist([min, range](const uint32_t *bits, float *values) {
+    for (unsigned int i = 0; i < 4; ++i)
+      values[i] = min + range * to_unit_float(bits[i]);
+  });
 }
 
 void Tensor::setRandBernoulli(float probability) {
-  setDist<std::bernoulli_distribution>(
-    std::bernoulli_distribution(probability));
+  setDist([probability](const uint32_t *bits, float *values) {
+    for (unsigned int i = 0; i < 4; ++i)
+      values[i] = to_unit_float(bits[i]) < probability ? 1.0f : 0.0f;
+  });
 }
 
 void Tensor::initialize() {
@@ -367,32 +843,12 @@ Tensor &Tensor::multiply_strided(Tensor const &m, Tensor &output,
     throw std::invalid_argument(
       "Strided multiplication does not support broadcasting");
 
-  if (strides[3] != 1 || m.strides[3] != 1 || output.strides[3] != 1 ||
-      beta != 0.0) {
-    for (unsigned int b = 0; b < batch(); ++b) {
-      for (unsigned int c = 0; c < channel(); ++c) {
-        for (unsigned int h = 0; h < height(); ++h) {
-          for (unsigned int w = 0; w < width(); ++w) {
-            output.addValue(
-              b, c, h, w, getValue(b, c, h, w) * m.getValue(b, c, h, w), beta);
-          }
-        }
-      }
-    }
-  } else {
-    /** @todo optimize this with combining these loops where stride is 1 */
-    for (unsigned int b = 0; b < batch(); ++b) {
-      for (unsigned int c = 0; c < channel(); ++c) {
-        for (unsigned int h = 0; h < height(); ++h) {
-          float *out_data = output.getAddress(b, c, h, 0);
-          const float *m_data = m.getAddress(b, c, h, 0);
-          const float *in_data = getAddress(b, c, h, 0);
-          std::transform(in_data, in_data + width(), m_data, out_data,
-                         std::multiplies<float>());
-        }
-      }
-    }
-  }
+  if (beta == 0.0f)
+    apply_strided(*this, m, output,
+                  [](float x, float y, float &o) { o = x * y; });
+  else
+    apply_strided(*this, m, output,
+                  [beta](float x, float y, float &o) { o = x * y + beta * o; });
 
   return output;
 }
@@ -422,32 +878,10 @@ Tensor &Tensor::add_strided(Tensor const &m, Tensor &output,
     throw std::invalid_argument(
       "Strided addition does not support broadcasting");
 
-  if (strides[3] != 1 || m.strides[3] != 1 || output.strides[3] != 1 ||
-      beta != 0.0) {
-    for (unsigned int b = 0; b < batch(); ++b) {
-      for (unsigned int c = 0; c < channel(); ++c) {
-        for (unsigned int h = 0; h < height(); ++h) {
-          for (unsigned int w = 0; w < width(); ++w) {
-            output.setValue(
-              b, c, h, w, getValue(b, c, h, w) + m.getValue(b, c, h, w) * beta);
-          }
-        }
-      }
-    }
-  } else {
-    /** @todo optimize this with combining these loops where stride is 1 */
-    for (unsigned int b = 0; b < batch(); ++b) {
-      for (unsigned int c = 0; c < channel(); ++c) {
-        for (unsigned int h = 0; h < height(); ++h) {
-          float *out_data = output.getAddress(b, c, h, 0);
-          const float *m_data = m.getAddress(b, c, h, 0);
-          const float *in_data = getAddress(b, c, h, 0);
-          std::transform(in_data, in_data + width(), m_data, out_data,
-                         std::plus<float>());
-        }
-      }
-    }
-  }
+  /// beta of 0 adds @a m as is
+  const float scale = beta == 0.0f ? 1.0f : beta;
+  apply_strided(*this, m, output,
+                [scale](float x, float y, float &o) { o = x + y * scale; });
 
   return output;
 }
@@ -518,7 +952,11 @@ Tensor &Tensor::multiply(Tensor const &m, Tensor &output,
                 std::invalid_argument)
     << getName() << " is not contiguous, cannot multiply";
 
-  apply_broadcast(m, f, output);
+  if (beta == 0.0) {
+    apply_broadcast_op(m, std::multiplies<float>(), f, output);
+  } else {
+    apply_broadcast(m, f, output);
+  }
   return output;
 }
 
@@ -582,7 +1020,7 @@ Tensor &Tensor::divide(Tensor const &m, Tensor &output) const {
                 std::invalid_argument)
     << getName() << " is not contiguous, cannot divide";
 
-  apply_broadcast(m, f, output);
+  apply_broadcast_op(m, std::divides<float>(), f, output);
   return output;
 }
 
@@ -615,7 +1053,8 @@ int Tensor::add_i(Tensor const &m, float const alpha) {
   //   << getName() << " is not contiguous, cannot add";
 
   try {
-    apply_broadcast(m, f, *this);
+    apply_broadcast_op(
+      m, [alpha](float x, float y) { return x + alpha * y; }, f, *this);
   } catch (std::exception &err) {
     ml_loge("%s %s", typeid(err).name(), err.what());
     return ML_ERROR_INVALID_PARAMETER;
@@ -632,7 +1071,7 @@ Tensor Tensor::add(Tensor const &m, float const alpha) const {
 Tensor &Tensor::add(Tensor const &m, Tensor &output, float const alpha) const {
   auto f = [&](const BroadcastInfo &e, const float *buf, const float *m_buf,
                float *out_buf) {
-    if (e.strides[3] == 1 && strides[3] == 1 && strides[3] == 1 && alpha == 0) {
+    if (e.strides[3] == 1 && strides[3] == 1 && strides[3] == 1 && alpha == 1) {
       std::transform(buf, buf + e.buffer_size, m_buf, out_buf,
                      std::plus<float>());
     } else {
@@ -649,7 +1088,8 @@ Tensor &Tensor::add(Tensor const &m, Tensor &output, float const alpha) const {
                 std::invalid_argument)
     << getName() << " is not contiguous, cannot add";
 
-  apply_broadcast(m, f, output);
+  apply_broadcast_op(
+    m, [alpha](float x, float y) { return x + alpha * y; }, f, output);
 
   return output;
 }
@@ -700,6 +1140,24 @@ Tensor Tensor::getBatchSlice(unsigned int offset, unsigned int size) const {
   return getSharedDataTensor(dim_, offset * this->dim.getFeatureLen());
 }
 
+Tensor Tensor::getSlice(unsigned int axis, unsigned int offset,
+                        unsigned int size) const {
+  NNTR_THROW_IF(axis >= TensorDim::MAXDIM, std::invalid_argument)
+    << "cannot slice axis of axis: " << axis;
+  NNTR_THROW_IF(size == 0 || offset + size > dim.getTensorDim(axis),
+                std::invalid_argument)
+    << getName() << " cannot be sliced from " << offset << " by " << size
+    << " along axis " << axis;
+
+  TensorDim dim_ = dim;
+  dim_.setTensorDim(axis, size);
+
+  Tensor ret = getSharedDataTensor(dim_, offset * strides[axis], false);
+  ret.contiguous = contiguous && is_packed(dim_, strides);
+
+  return ret;
+}
+
 void Tensor::createSharedDataTensor(const Tensor &src, Tensor &dest,
                                     unsigned int offset) {
   /**
@@ -926,25 +1384,91 @@ void Tensor::apply_broadcast_util(
   }
 }
 
+template <typename T>
+void Tensor::apply_broadcast_op(
+  Tensor const &m, T op,
+  std::function<void(const BroadcastInfo &e, const float *, const float *,
+                     float *)>
+    v_func,
+  Tensor &output) const {
+  CREATE_IF_EMPTY_DIMS(output, dim);
+
+  /// the kernels below assume every tensor is laid out densely, strided
+  /// tensors are left to the generic path
+  if (!contiguous || !m.contiguous || !output.contiguous ||
+      output.dim != dim) {
+    apply_broadcast(m, v_func, output);
+    return;
+  }
+
+  const float *buf = getData();
+  const float *m_buf = m.getData();
+  float *out_buf = output.getData();
+  const unsigned int len = size();
+
+  /// shortcut to cover when dimension matches
+  if (dim == m.dim) {
+#pragma omp parallel for if (len >= parallel_threshold)
+    for (unsigned int i = 0; i < len; ++i)
+      out_buf[i] = op(buf[i], m_buf[i]);
+    return;
+  }
+
+  const BroadcastInfo e = computeBroadcastInfo(m);
+
+  /// every axis up to the buffer axis is flattened into a single loop of
+  /// runs. For contiguous tensors, the offset of @a this and @a output is
+  /// simply run index * run size, only @a m needs to be calculated per run
+  const unsigned int run_size = e.buffer_size;
+  const unsigned int num_runs = len / run_size;
+  const TensorDim &d = dim;
+  auto m_offset = [&e, &d](unsigned int run) {
+    unsigned int offset = 0;
+    for (int axis = e.buffer_axis; axis >= 0; --axis) {
+      unsigned int axis_len = d.getTensorDim(axis);
+      offset += (run % axis_len) * e.strides[axis];
+      run /= axis_len;
+    }
+    return offset;
+  };
+
+  if (e.strides[3] == 0) {
+    /// m is a scalar for a run, ex) [B, C, H, W] op [1, C, 1, 1]
+#pragma omp parallel for if (len >= parallel_threshold)
+    for (unsigned int r = 0; r < num_runs; ++r) {
+      const float val = m_buf[m_offset(r)];
+      const float *in = buf + r * run_size;
+      float *out = out_buf + r * run_size;
+      for (unsigned int i = 0; i < run_size; ++i)
+        out[i] = op(in[i], val);
+    }
+  } else {
+    /// m is a vector repeated for each run, ex) [B, 1, 1, W] op [1, 1, 1, W]
+#pragma omp parallel for if (len >= parallel_threshold)
+    for (unsigned int r = 0; r < num_runs; ++r) {
+      const float *m_in = m_buf + m_offset(r);
+      const float *in = buf + r * run_size;
+      float *out = out_buf + r * run_size;
+      for (unsigned int i = 0; i < run_size; ++i)
+        out[i] = op(in[i], m_in[i]);
+    }
+  }
+}
+
 /**
  * This is to sum the Tensor data according to the dim.batch().
  * Therefore the result has M(dim.batch(), 1, 1, 1) dimension.
  */
 Tensor Tensor::sum_by_batch() const {
-  NNTR_THROW_IF(!contiguous, std::invalid_argument)
-    << getName() << " is not contiguous, cannot sum";
+  if (!contiguous) {
+    Tensor packed;
+    packed.copy_with_stride(*this);
+    return packed.sum_by_batch();
+  }
 
   Tensor ret(dim.batch(), 1, 1, 1);
-  unsigned int feat_len = dim.getFeatureLen();
-  unsigned int batch = dim.batch();
-
-  const float *data = getData();
-  float *rdata = ret.getData();
-
-  Tensor ones(1, 1, 1, feat_len);
-  ones.setValue(1.0);
-  sgemv(CblasRowMajor, CblasNoTrans, batch, feat_len, 1, data, feat_len,
-        ones.getData(), 1, 0.0, rdata, 1);
+  reduce_sum(getData(), dim.getDim(), {false, true, true, true}, ret.getData(),
+             1.0f, 0.0f);
 
   return ret;
 }
@@ -958,12 +1482,14 @@ Tensor Tensor::sum(unsigned int axis, float alpha) const {
 }
 Tensor &Tensor::sum(unsigned int axis, Tensor &ret, float alpha,
                     float beta) const {
-  const float *data = getData();
-
-  NNTR_THROW_IF(!contiguous, std::invalid_argument)
-    << getName() << " is not contiguous, cannot sum";
+  /// a strided view is gathered first, the reduction walks packed memory
+  if (!contiguous) {
+    Tensor packed;
+    packed.copy_with_stride(*this);
+    return packed.sum(axis, ret, alpha, beta);
+  }
 
-  if (axis >= 4)
+  if (axis >= TensorDim::MAXDIM)
     throw std::out_of_range("Error: axis is invalid");
 
   if (dim.getDim()[axis] == 1 and alpha == 1.0 and !beta) {
@@ -972,58 +1498,14 @@ Tensor &Tensor::sum(unsigned int axis, Tensor &ret, float alpha,
     return ret;
   }
 
-  switch (axis) {
-  case 0: {
-    CREATE_IF_EMPTY_DIMS(ret, 1, dim.channel(), dim.height(), dim.width());
-    unsigned int feat_len = dim.getFeatureLen();
-    unsigned int batch = dim.batch();
-    Tensor ones(1, 1, 1, batch);
-    ones.setValue(alpha);
-    sgemv(CblasRowMajor, CblasTrans, batch, feat_len, 1, data, feat_len,
-          ones.getData(), 1, beta, ret.getData(), 1);
-  } break;
-  case 1: {
-    CREATE_IF_EMPTY_DIMS(ret, dim.batch(), 1, dim.height(), dim.width());
-    unsigned int feat_len = dim.height() * dim.width();
-    unsigned int channel = dim.channel();
-    Tensor ones(1, 1, 1, channel);
-    ones.setValue(alpha);
-    float *rdata = ret.getData();
-    for (unsigned int k = 0; k < dim.batch(); ++k) {
-      sgemv(CblasRowMajor, CblasTrans, channel, feat_len, 1,
-            &data[k * dim.getFeatureLen()], feat_len, ones.getData(), 1, beta,
-            &rdata[k * feat_len], 1);
-    }
-  } break;
-  case 2: {
-    CREATE_IF_EMPTY_DIMS(ret, dim.batch(), dim.channel(), 1, dim.width());
-    unsigned int width = dim.width();
-    unsigned int height = dim.height();
-    Tensor ones(1, 1, 1, height);
-    ones.setValue(alpha);
-    float *rdata = ret.getData();
-    for (unsigned int k = 0; k < dim.batch(); ++k) {
-      for (unsigned int c = 0; c < dim.channel(); ++c) {
-        unsigned int idx =
-          k * dim.getFeatureLen() + c * dim.width() * dim.height();
-        unsigned int ridx = k * ret.dim.getFeatureLen() + c * dim.width();
-        sgemv(CblasRowMajor, CblasTrans, height, width, 1, &data[idx], width,
-              ones.getData(), 1, beta, &rdata[ridx], 1);
-      }
-    }
-  } break;
-  case 3: {
-    CREATE_IF_EMPTY_DIMS(ret, dim.batch(), dim.channel(), dim.height(), 1);
-    unsigned int m = ret.dim.getDataLen();
-    unsigned int n = dim.width();
-    Tensor ones(1, 1, 1, n);
-    ones.setValue(alpha);
-    sgemv(CblasRowMajor, CblasNoTrans, m, n, 1, data, n, ones.getData(), 1,
-          beta, ret.getData(), 1);
-  } break;
-  default:
-    throw std::out_of_range("Error: Dimension cannot exceed 3");
-  }
+  std::array<bool, TensorDim::MAXDIM> reduce = {false, false, false, false};
+  reduce[axis] = true;
+
+  TensorDim ret_dim = dim;
+  ret_dim.setTensorDim(axis, 1);
+  CREATE_IF_EMPTY_DIMS(ret, ret_dim);
+
+  reduce_sum(getData(), dim.getDim(), reduce, ret.getData(), alpha, beta);
   return ret;
 }
 
@@ -1032,43 +1514,31 @@ Tensor Tensor::sum(const std::vector<unsigned int> &axes, float alpha) const {
   return sum(axes, ret, alpha);
 }
 
-void Tensor::mergeAxis(unsigned int axis1, unsigned int axis2) {
-  NNTR_THROW_IF(!contiguous, std::invalid_argument)
-    << getName() << " is not contiguous, cannot merge axis";
-
-  if (axis2 != axis1 + 1)
-    throw std::invalid_argument("axis2 must be axis1 + 1 for merging.");
-
-  dim.setTensorDim(axis2, dim.getTensorDim(axis1) * dim.getTensorDim(axis2));
-  dim.setTensorDim(axis1, 1);
-}
-
 Tensor &Tensor::sum(const std::vector<unsigned int> &axes, Tensor &output,
                     float alpha) const {
   if (axes.empty())
     throw std::invalid_argument("empty axes given");
 
-  if (axes.size() == 1) {
-    this->sum(axes[0], output, alpha);
-  } else {
-    /** club axes together */
-    Tensor new_reshaped = *this;
-    std::vector<unsigned int> new_axes = {axes[0]};
-    for (unsigned int i = 1; i < axes.size(); ++i) {
-      if (axes[i] == axes[i - 1] + 1) {
-        new_reshaped.mergeAxis(axes[i - 1], axes[i]);
-        new_axes.back() = axes[i];
-      } else {
-        new_axes.push_back(axes[i]);
-      }
-    }
+  if (axes.size() == 1)
+    return this->sum(axes[0], output, alpha);
 
-    Tensor ret = new_reshaped.sum(new_axes[0]);
-    for (unsigned int i = 1; i < new_axes.size() - 1; ++i)
-      ret = ret.sum(axes[i]);
-    ret.sum(new_axes.back(), output, alpha);
+  if (!contiguous) {
+    Tensor packed;
+    packed.copy_with_stride(*this);
+    return packed.sum(axes, output, alpha);
+  }
+
+  std::array<bool, TensorDim::MAXDIM> reduce = {false, false, false, false};
+  TensorDim ret_dim = dim;
+  for (auto axis : axes) {
+    if (axis >= TensorDim::MAXDIM)
+      throw std::out_of_range("Error: axis is invalid");
+    reduce[axis] = true;
+    ret_dim.setTensorDim(axis, 1);
   }
+  CREATE_IF_EMPTY_DIMS(output, ret_dim);
 
+  reduce_sum(getData(), dim.getDim(), reduce, output.getData(), alpha, 0.0f);
   return output;
 }
 
@@ -1166,8 +1636,14 @@ Tensor &Tensor::dot_batched_deriv_wrt_2(Tensor &m_deriv,
  */
 Tensor &Tensor::dot(Tensor const &m, Tensor &result, bool trans, bool trans_m,
                     float beta) const {
-  NNTR_THROW_IF(!contiguous, std::invalid_argument)
-    << getName() << " is not contiguous. Cannot dot product.";
+  /// strided views can be passed to blas as long as the rows are evenly
+  /// spaced, which is described by the leading dimension
+  const unsigned int lda = row_stride(*this);
+  const unsigned int ldb = row_stride(m);
+  NNTR_THROW_IF(lda == 0, std::invalid_argument)
+    << getName() << " has no even row stride. Cannot dot product.";
+  NNTR_THROW_IF(ldb == 0, std::invalid_argument)
+    << m.getName() << " has no even row stride. Cannot dot product.";
 
   if (m.dim.rank() > 2) {
     throw exception::not_supported("Error: support only for rank of dot "
@@ -1186,7 +1662,7 @@ Tensor &Tensor::dot(Tensor const &m, Tensor &result, bool trans, bool trans_m,
   unsigned int mdim1 = m.batch() * m.channel() * m.height();
   unsigned int mdim2 = m.width();
 
-  unsigned int M, N, K, lda, ldb, ldc;
+  unsigned int M, N, K, ldc;
 
   if (!trans && !trans_m) {
     if (dim2 != mdim1)
@@ -1227,9 +1703,12 @@ Tensor &Tensor::dot(Tensor const &m, Tensor &result, bool trans, bool trans_m,
     M = dim2;
     CREATE_IF_EMPTY_DIMS(result, 1, 1, M, N);
   }
-  lda = dim2;
-  ldb = mdim2;
-  ldc = result.width();
+  ldc = row_stride(result);
+  NNTR_THROW_IF(ldc == 0, std::invalid_argument)
+    << result.getName() << " has no even row stride. Cannot dot product.";
+
+  /// vector shortcuts assume packed rows
+  const bool packed = lda == dim2 && ldb == mdim2 && ldc == result.width();
 
   const float *data = getData();
   const float *mdata = m.getData();
@@ -1245,18 +1724,18 @@ Tensor &Tensor::dot(Tensor const &m, Tensor &result, bool trans, bool trans_m,
   /// For example, there is no case like (1 * K) X (1 * K) while
   /// (1 * K) X (1 * M) can be a case
   /// case1: (1 * K) X (K * 1)
-  if (M == 1 && N == 1) {
+  if (packed && M == 1 && N == 1) {
     *rdata = sdot(K, data, 1, mdata, 1) + beta * (*rdata);
   }
   /// case2: (M * K) X (K * 1)
-  else if (N == 1) {
+  else if (packed && N == 1) {
     sgemv(CblasRowMajor, transA, dim1, dim2, alpha, data, lda, mdata, 1, beta,
           rdata, 1);
   }
   /// case3: (1 * K) X (K * N) = 1 * N = R
   /// = R^T = (K * N) ^T * (1 * K) ^T = (N * K) * (K * 1) = (N * K) * (1 * K)
   /// Effectively a translation of sgemv
-  else if (M == 1) {
+  else if (packed && M == 1) {
     transB = transB == CblasTrans ? CblasNoTrans : CblasTrans;
     sgemv(CblasRowMajor, transB, mdim1, mdim2, alpha, mdata, ldb, data, 1, beta,
           rdata, 1);
@@ -1271,52 +1750,55 @@ Tensor &Tensor::dot(Tensor const &m, Tensor &result, bool trans, bool trans_m,
 }
 
 Tensor &Tensor::transpose(const std::string &direction, Tensor &out) const {
-  NNTR_THROW_IF(!contiguous, std::invalid_argument)
-    << getName() << " is not contiguous. Cannot transpose.";
-
-  if (out.getData() == getData()) {
-    Tensor tmp = clone();
-    return tmp.transpose(direction, out);
+  if (!contiguous) {
+    Tensor packed;
+    packed.copy_with_stride(*this);
+    return packed.transpose(direction, out);
   }
 
-  unsigned int SL, SI, SJ, SK;
-  const float *inptr;
-  float *outptr;
-
-  out.reshape(dim.transpose(direction));
-
-  int indexI = direction[0] - '0';
-  int indexJ = direction[2] - '0';
-
-  SL = dim.batch(), SI = dim.channel(), SJ = dim.height(), SK = dim.width();
+  /// output axis i comes from the input axis axes[i] (0: channel, 1: height,
+  /// 2: width)
+  const unsigned int indexI = direction[0] - '0';
+  const unsigned int indexJ = direction[2] - '0';
+  const std::array<unsigned int, 3> axes = {indexI, indexJ,
+                                            3 - indexI - indexJ};
+  const std::array<unsigned int, 3> in_dims = {dim.channel(), dim.height(),
+                                               dim.width()};
+  const std::array<unsigned int, 3> in_strides = {
+    dim.height() * dim.width(), dim.width(), 1};
 
-  inptr = getData();
-  outptr = out.getData();
+  std::array<unsigned int, 3> out_dims, strides;
+  for (unsigned int i = 0; i < 3; ++i) {
+    out_dims[i] = in_dims[axes[i]];
+    strides[i] = in_strides[axes[i]];
+  }
 
-  switch (indexI) {
-  case 0:
-    if (indexJ == 1) {
-      transposeloop(l, i, j, k, SL, SI, SJ, SK);
-    } else {
-      transposeloop(l, i, k, j, SL, SI, SK, SJ);
-    }
-    break;
-  case 1:
-    if (indexJ == 0) {
-      transposeloop(l, j, i, k, SL, SJ, SI, SK);
-    } else {
-      transposeloop(l, j, k, i, SL, SJ, SK, SI);
+  if (out.getData() == getData()) {
+    if (axes[0] == 0 && axes[1] == 1) {
+      out.reshape(dim);
+      return out;
     }
-    break;
-  case 2:
-    if (indexJ == 0) {
-      transposeloop(l, k, i, j, SL, SK, SI, SJ);
-    } else {
-      transposeloop(l, k, j, i, SL, SK, SJ, SI);
+
+    /// a swap of two axes of the same size can be done in place
+    unsigned int fixed = 0;
+    while (axes[fixed] != fixed && fixed < 2)
+      ++fixed;
+    unsigned int a = (fixed + 1) % 3, b = (fixed + 2) % 3;
+    if (axes[fixed] == fixed && in_dims[a] == in_dims[b]) {
+      out.reshape(dim);
+      transpose_square_inplace(out.getData(), dim.batch(), in_dims[a],
+                               in_strides[a], in_strides[b], in_dims[fixed],
+                               in_strides[fixed]);
+      return out;
     }
-    break;
+
+    Tensor tmp = clone();
+    return tmp.transpose(direction, out);
   }
 
+  out.reshape(dim.transpose(direction));
+  transpose_feature(getData(), out.getData(), dim.batch(), out_dims, strides);
+
   return out;
 }
 
@@ -1333,16 +1815,13 @@ Tensor Tensor::dropout_mask(float dropout) const {
 }
 
 void Tensor::dropout_mask(float dropout) {
-  setRandUniform(0.0, 1.0);
-  float scale = 1.0 / (1 - dropout);
-  float *data_ = getData();
+  const float scale = 1.0 / (1 - dropout);
 
-  for (unsigned int i = 0; i < size(); ++i) {
-    if (data_[i] >= dropout)
-      data_[i] = scale;
-    else
-      data_[i] = 0.0;
-  }
+  /// the mask is drawn directly instead of thresholding a uniform tensor
+  setDist([dropout, scale](const uint32_t *bits, float *values) {
+    for (unsigned int i = 0; i < 4; ++i)
+      values[i] = to_unit_float(bits[i]) >= dropout ? scale : 0.0f;
+  });
 }
 
 void Tensor::filter_mask(const Tensor &mask_len, bool reverse) {
@@ -1372,17 +1851,19 @@ Tensor Tensor::zoneout_mask(float zoneout) {
 }
 
 void Tensor::zoneout_mask(Tensor &opposite, float zoneout) {
+  NNTR_THROW_IF(!contiguous, std::invalid_argument)
+    << getName() << " Tensor is not contiguous, cannot set zoneout mask";
+  NNTR_THROW_IF(opposite.size() != size(), std::invalid_argument)
+    << getName() << " zoneout mask size mismatch with opposite mask";
+
   opposite.setRandBernoulli(zoneout);
   float *data = getData();
-  float *opposite_data = opposite.getData();
+  const float *opposite_data = opposite.getData();
+  const unsigned int len = size();
 
-  for (unsigned int i = 0; i < size(); ++i) {
-    if (opposite_data[i] > epsilon) {
-      data[i] = 0.0f;
-    } else {
-      data[i] = 1.0f;
-    }
-  }
+#pragma omp parallel for if (len >= parallel_threshold)
+  for (unsigned int i = 0; i < len; ++i)
+    data[i] = opposite_data[i] > epsilon ? 0.0f : 1.0f;
 }
 
 int Tensor::apply_i(std::function<float(float)> f) {
@@ -1494,29 +1975,12 @@ void Tensor::copy(const float *buf) noexcept {
 
 void Tensor::copy_with_stride(const Tensor &from) {
 
-  if (dim == from.getDim()) {
-    for (unsigned int b = 0; b < batch(); ++b) {
-      for (unsigned int c = 0; c < channel(); ++c) {
-        for (unsigned int h = 0; h < height(); ++h) {
-          for (unsigned int w = 0; w < width(); ++w) {
-            setValue(b, c, h, w, from.getValue(b, c, h, w));
-          }
-        }
-      }
-    }
-  } else {
+  if (dim != from.getDim()) {
     Tensor t = Tensor(from.getDim(), true);
-    for (unsigned int b = 0; b < t.batch(); ++b) {
-      for (unsigned int c = 0; c < t.channel(); ++c) {
-        for (unsigned int h = 0; h < t.height(); ++h) {
-          for (unsigned int w = 0; w < t.width(); ++w) {
-            t.setValue(b, c, h, w, from.getValue(b, c, h, w));
-          }
-        }
-      }
-    }
     swap(t, *this);
   }
+
+  apply_strided(from, from, *this, [](float x, float, float &o) { o = x; });
 }
 
 void Tensor::copy(const Tensor &from) {
@@ -1687,8 +2151,11 @@ void Tensor::setZero() {
 }
 
 std::vector<unsigned int> Tensor::argmax() const {
-  NNTR_THROW_IF(!contiguous, std::invalid_argument)
-    << getName() << " is not contiguous, cannot get argmax.";
+  if (!contiguous) {
+    Tensor packed;
+    packed.copy_with_stride(*this);
+    return packed.argmax();
+  }
 
   const float *data = getData();
   std::vector<unsigned int> result;
@@ -1697,11 +2164,9 @@ std::vector<unsigned int> Tensor::argmax() const {
 
   result.resize(batch_size);
 
-  for (unsigned int b = 0; b < batch_size; b++) {
-    auto max_iter =
-      std::max_element(data + b * feature_len, data + (b + 1) * feature_len);
-    result[b] = std::distance(data, max_iter) - (b * feature_len);
-  }
+#pragma omp parallel for if (size() >= parallel_threshold)
+  for (unsigned int b = 0; b < batch_size; b++)
+    result[b] = argmax_contiguous(data + b * feature_len, feature_len);
 
   return result;
 }
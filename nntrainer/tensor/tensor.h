@@ -1057,6 +1057,19 @@ public:
    */
   Tensor getBatchSlice(unsigned int offset, unsigned int size) const;
 
+  /**
+   * @brief Get slice of the tensor along any axis
+   * @param[in] axis axis to slice along
+   * @param[in] offset offset in the axis to start the slice
+   * @param[in] size size of the slice
+   * @retval slice of this tensor
+   * @note The slice shares the memory and keeps the strides of this tensor,
+   * so it is not contiguous unless the sliced memory happens to be packed.
+   * Strided ops and dot take such a slice as is.
+   */
+  Tensor getSlice(unsigned int axis, unsigned int offset,
+                  unsigned int size) const;
+
   /**
    * @brief Get new tensor which shares memory with current tensor but different
    * shape
@@ -1199,6 +1212,21 @@ public:
     dim.batch(batch);
   }
 
+  /**
+   * @brief     Update batch size of an allocated tensor in place. The tensor
+   * views the leading @a batch samples of its memory, nothing is reallocated
+   * @param[in] batch batch size
+   *
+   * @note      The memory must hold @a batch samples, which is not checked.
+   * This is to run a batch smaller than the one the memory is planned for.
+   */
+  void updateBatchView(unsigned int batch) {
+    if (!contiguous)
+      throw std::invalid_argument(
+        "Cannot view batch of a non-contiguous tensor");
+    dim.batch(batch);
+  }
+
   /**
    * @brief     return Data pointer of Tensor
    * @retval    template T pointer (float pointer as default)
@@ -1381,6 +1409,26 @@ private:
                          v_func,
                        Tensor &output) const;
 
+  /**
+   * @brief Applies the given elementwise binary operator with broadcasting.
+   * Common broadcasting patterns over contiguous tensors are run by inlined
+   * kernels parallelized over the outer axes, falling back to @a v_func
+   * through apply_broadcast_util otherwise.
+   *
+   * @tparam T binary operator of float(float, float)
+   * @param[in] m Tensor
+   * @param[in] op operator to apply, output = op(this, m)
+   * @param[in] v_func vectorized function to use for the generic path
+   * @param[out] output output tensor
+   */
+  template <typename T>
+  void apply_broadcast_op(Tensor const &m, T op,
+                          std::function<void(const BroadcastInfo &e,
+                                             const float *, const float *,
+                                             float *)>
+                            v_func,
+                          Tensor &output) const;
+
   /**
    * @brief compute Loop info for broadcasting and vectorization
    *
@@ -1392,8 +1440,10 @@ private:
   /**
    * @brief Set the Dist object
    *
-   * @tparam T distrubution engine
-   * @param dist distribution engine
+   * @tparam T callable of void(const uint32_t *bits, float *values)
+   * @param dist distribution which maps four random words to four values
+   * @note the words are drawn from a counter based generator in parallel, the
+   * result does not depend on the number of threads
    */
   template <typename T> void setDist(T dist);
 
@@ -1430,14 +1480,6 @@ private:
     deallocate();
     allocate();
   }
-
-  /**
-   * @brief Merge the given two axis for tensor at second axis inplace
-   *
-   * @param axis1 first axis to merge
-   * @param axis2 second axis to merge
-   */
-  void mergeAxis(unsigned int axis1, unsigned int axis2);
 }; // namespace nntrainer
 
 /**
@@ -36,7 +36,7 @@ Tensor *TensorPool::request(const std::string &name, const TensorDim &dim,
                             const Tensor::Initializer &init) {
   return registerRequestSpec(
     {std::make_unique<Tensor>(dim, false, init, name),
-     TensorPool::SourceDetails{0, lifespan, exec_order, {}}});
+     TensorPool::SourceDetails{0, lifespan, exec_order, {}, {}}});
 }
 
 /**
@@ -103,15 +103,47 @@ Tensor *TensorPool::view(const std::string &name, const std::string &reference,
 void TensorPool::finalize(const MemoryPlanner &planner,
                           unsigned int start_order, unsigned int end_order) {
   mem_pool.clear();
+
+  /** 0. merged sources live as long as the source they are placed into */
+  std::unordered_map<unsigned int, SourceDetails> merged_details;
+  for (unsigned int idx = 0; idx < pool.size(); ++idx) {
+    auto details = std::get_if<SourceDetails>(&pool[idx].details);
+    if (!details || !details->merged)
+      continue;
+    details->token = 0;
+
+    unsigned int offset;
+    unsigned int root = getMergedRoot(idx, offset);
+    auto iter = merged_details.find(root);
+    if (iter == merged_details.end())
+      iter =
+        merged_details.emplace(root, std::get<SourceDetails>(pool[root].details))
+          .first;
+    iter->second.lifespan =
+      enum_class_or<TensorLifespan>(iter->second.lifespan, details->lifespan);
+    iter->second.exec_order.insert(iter->second.exec_order.end(),
+                                   details->exec_order.begin(),
+                                   details->exec_order.end());
+  }
+
   unsigned int bytes_requested = 0;
-  for (auto &spec : pool) {
+  for (unsigned int spec_idx = 0; spec_idx < pool.size(); ++spec_idx) {
+    auto &spec = pool[spec_idx];
     auto details = std::get_if<SourceDetails>(&spec.details);
     if (!details || details->lifespan == TensorLifespan::UNMANAGED ||
-        details->exec_order.empty()) {
+        details->merged) {
       continue;
     }
     details->token = 0;
 
+    if (auto iter = merged_details.find(spec_idx);
+        iter != merged_details.end()) {
+      iter->second.token = 0;
+      details = &iter->second;
+    }
+    if (details->exec_order.empty())
+      continue;
+
     /**
      * 1. create the validity ranges for the all the requested tensors.
      * validity_start/validity_end should be a value in the exec order of the
@@ -154,10 +186,10 @@ void TensorPool::finalize(const MemoryPlanner &planner,
      * 3. requestMemory for all the tensors and set their tokens
      * @note +1 is to make the validity_end exlusive in the interval range
      */
-    details->token = mem_pool.requestMemory(spec.tensor->bytes(),
-                                            validity_start, validity_end + 1);
+    std::get<SourceDetails>(spec.details).token = mem_pool.requestMemory(
+      spec.tensor->bytes(), validity_start, validity_end + 1);
 #ifdef DEBUG
-    if (details->token == 0)
+    if (std::get<SourceDetails>(spec.details).token == 0)
       throw std::runtime_error("Received invalid token from memory pool");
 #endif
 
@@ -198,6 +230,20 @@ void TensorPool::allocate() {
     spec.tensor->setData(mem_pool.getMemory(details->token), true);
     syncDependents(spec);
   }
+
+  /** merged sources are initialized after the source they are placed into */
+  for (unsigned int idx = 0; idx < pool.size(); ++idx) {
+    auto details = std::get_if<SourceDetails>(&pool[idx].details);
+    if (!details || !details->merged)
+      continue;
+
+    unsigned int offset;
+    float *data = pool[getMergedRoot(idx, offset)].tensor->getData();
+    if (data == nullptr)
+      continue;
+    pool[idx].tensor->setData(data + offset, true);
+    syncDependents(pool[idx]);
+  }
 }
 
 /**
@@ -378,6 +424,62 @@ void TensorPool::reidentifySource(const std::string &dest,
   old_spec.details = DependentDetails{new_parent_idx, base_offset};
 }
 
+bool TensorPool::mergeInto(const std::string &dest, const std::string &src,
+                           unsigned int offset) {
+  /** offset of a tensor from its source */
+  auto offset_of = [this](unsigned int idx) {
+    auto dep = std::get_if<DependentDetails>(&pool[idx].details);
+    return dep ? dep->offset : 0u;
+  };
+
+  auto &dest_spec = getSourceSpec(dest);
+  auto &dest_details = std::get<SourceDetails>(dest_spec.details);
+  auto dest_idx = name_map.at(dest_spec.tensor->getName());
+  if (dest_details.lifespan == TensorLifespan::UNMANAGED ||
+      dest_details.merged || offset_of(name_map.at(dest)) != 0 ||
+      dest_spec.tensor->size() != getTensor(dest)->size())
+    return false;
+
+  auto &src_spec = getSourceSpec(src);
+  auto src_idx = name_map.at(src_spec.tensor->getName());
+  if (std::get<SourceDetails>(src_spec.details).lifespan ==
+      TensorLifespan::UNMANAGED)
+    return false;
+
+  unsigned int src_offset = offset_of(name_map.at(src)) + offset;
+  if (src_offset + dest_spec.tensor->size() > src_spec.tensor->size())
+    return false;
+
+  /** placing into the tensor which is (finally) placed into dest is a cycle */
+  unsigned int root_offset;
+  if (src_idx == dest_idx ||
+      (std::get<SourceDetails>(src_spec.details).merged &&
+       getMergedRoot(src_idx, root_offset) == dest_idx))
+    return false;
+
+  dest_details.merged = {src_idx, src_offset};
+  return true;
+}
+
+void TensorPool::clearMerged() {
+  for (auto &spec : pool) {
+    if (auto details = std::get_if<SourceDetails>(&spec.details))
+      details->merged.reset();
+  }
+}
+
+unsigned int TensorPool::getMergedRoot(unsigned int idx,
+                                       unsigned int &offset) const {
+  offset = 0;
+  const SourceDetails *details = &std::get<SourceDetails>(pool[idx].details);
+  while (details->merged) {
+    idx = details->merged->first;
+    offset += details->merged->second;
+    details = &std::get<SourceDetails>(pool[idx].details);
+  }
+  return idx;
+}
+
 bool TensorPool::tensorExist(const std::string &name) {
   /// @todo consider use a helper function to check, eg) something like
   /// getTensor()
@@ -19,6 +19,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -233,6 +234,30 @@ public:
   void reidentifySource(const std::string &dest, const std::string &new_src,
                         unsigned int offset);
 
+  /**
+   * @brief place the source of @a dest inside @a src at @a offset. Unlike
+   * reidentifySource(), the placement is undone by clearMerged(), so it can be
+   * decided again for every allocation with the current dimensions. The
+   * lifespans of both are merged when planning.
+   *
+   * @param dest identifier of the tensor to be placed
+   * @param src identifier of the tensor to place into
+   * @param offset elementwise offset from @a src
+   * @retval true if placed
+   * @retval false if @a dest can not be placed, as its source is unmanaged,
+   * already placed, does not cover the same memory as @a dest or does not fit
+   * in @a src
+   * @note caller must guarantee that the tensors placed into the same source
+   * do not overlap
+   */
+  bool mergeInto(const std::string &dest, const std::string &src,
+                 unsigned int offset);
+
+  /**
+   * @brief undo all placements done by mergeInto()
+   */
+  void clearMerged();
+
 private:
   /**
    * @brief Source tensor detailed specification
@@ -244,6 +269,8 @@ private:
     std::vector<unsigned int> exec_order; /**< exec order */
     std::vector<unsigned int>
       dependents; /**< list of dependents to the source */
+    std::optional<std::pair<unsigned int, unsigned int>>
+      merged; /**< index of the source and the offset it is placed into */
   };
 
   /**
@@ -314,6 +341,15 @@ private:
    */
   void syncDependents(const RequestSpec &spec);
 
+  /**
+   * @brief get the source a merged source is finally placed into
+   *
+   * @param idx index of the merged source
+   * @param[out] offset elementwise offset from the returned source
+   * @return unsigned int index of the source which is not merged
+   */
+  unsigned int getMergedRoot(unsigned int idx, unsigned int &offset) const;
+
   /**
    * @brief register a spec after creation
    *
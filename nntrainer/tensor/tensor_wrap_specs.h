@@ -61,11 +61,11 @@ enum class TensorLifespan {
  * @brief Specification of the Weight as a tensor wrapper
  *
  * @details The tuple values are dimension, initializer, regularizer,
- * regularizer_constant, decay, clip gradient constant, need_gradient property
- * amd name of the tensor object.
+ * regularizer_constant, decay, clip gradient constant, learning rate
+ * multiplier, need_gradient property amd name of the tensor object.
  */
 typedef std::tuple<TensorDim, Tensor::Initializer, WeightRegularizer, float,
-                   float, float, bool, const std::string>
+                   float, float, float, bool, const std::string>
   WeightSpec;
 
 /**
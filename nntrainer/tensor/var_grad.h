@@ -203,14 +203,23 @@ public:
 
   /**
    * @brief Set batch size
+   * @note an allocated tensor views its memory in place, the caller must make
+   * sure that the memory holds @a batch samples
    *
    * @param batch batch size
    */
   void setBatchSize(unsigned int batch) {
+    auto update = [batch](Tensor &t) {
+      if (t.isAllocated())
+        t.updateBatchView(batch);
+      else
+        t.updateBatch(batch);
+    };
+
     if (!var->empty())
-      var->updateBatch(batch);
+      update(*var);
     if (grad && !grad->empty())
-      grad->updateBatch(batch);
+      update(*grad);
   }
 
   /**
@@ -20,13 +20,15 @@ namespace nntrainer {
 
 Weight::Weight(const TensorDim &dim, const Tensor::Initializer init,
                const WeightRegularizer reg, const float reg_const,
-               const float decay_const, const float max_norm, bool train,
-               bool alloc_now_, std::string name) :
+               const float decay_const, const float max_norm,
+               const float lr_multiplier_, bool train, bool alloc_now_,
+               std::string name) :
   Var_Grad(dim, init, train, alloc_now_, name),
   regularizer(reg),
   regularizer_constant(reg_const),
   decay(decay_const),
-  clip_by_global_norm(max_norm) {
+  clip_by_global_norm(max_norm),
+  lr_multiplier(lr_multiplier_) {
   if (init == Tensor::Initializer::NONE)
     throw std::invalid_argument("Weight initializer cannot be none");
   if (regularizer == WeightRegularizer::UNKNOWN)
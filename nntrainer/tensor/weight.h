@@ -44,7 +44,8 @@ public:
     regularizer(WeightRegularizer::UNKNOWN),
     regularizer_constant(1.0f),
     decay(0.0f),
-    clip_by_global_norm(0.0f) {}
+    clip_by_global_norm(0.0f),
+    lr_multiplier(1.0f) {}
 
   /**
    * @brief Construct a new Weight object
@@ -53,6 +54,7 @@ public:
    * @param init Initializer for the weight
    * @param reg Regularizer for the weight
    * @param reg_const Constant multiplier for regularizer
+   * @param lr_multiplier Multiplier of the learning rate for the weight
    * @param ng If the variable needs gradient
    * @param alloc_now The memory for the weight tensors be allocated upon init
    * @param name Name for this weight
@@ -62,8 +64,8 @@ public:
     const Tensor::Initializer init = Tensor::Initializer::XAVIER_UNIFORM,
     const WeightRegularizer reg = WeightRegularizer::NONE,
     const float reg_const = 1.0f, const float decay = 0.0f,
-    const float clip_by_global_norm = 0.0f, bool ng = true,
-    bool alloc_now = false, std::string name = "");
+    const float clip_by_global_norm = 0.0f, const float lr_multiplier = 1.0f,
+    bool ng = true, bool alloc_now = false, std::string name = "");
 
   /**
    * @brief Construct a new Weight object
@@ -77,9 +79,10 @@ public:
            std::get<3>(spec), // WeightRegularizerConstant
            std::get<4>(spec), // weight decay constant
            std::get<5>(spec), // MaxNorm for clipping
-           std::get<6>(spec), // need_gradient
+           std::get<6>(spec), // learning rate multiplier
+           std::get<7>(spec), // need_gradient
            alloc_now,
-           std::get<7>(spec) // Name
+           std::get<8>(spec) // Name
     ) {}
 
   /**
@@ -102,7 +105,8 @@ public:
     regularizer(WeightRegularizer::NONE),
     regularizer_constant(1.0f),
     decay(0.0f),
-    clip_by_global_norm(0.0f) {}
+    clip_by_global_norm(0.0f),
+    lr_multiplier(1.0f) {}
 
   /**
    * @brief Construct a new Weight object
@@ -111,15 +115,18 @@ public:
    * @param g ptr to already created gradient tensor
    * @param reg Regularizer for the weight
    * @param reg_const Constant multiplier for regularizer
+   * @param lr_multiplier Multiplier of the learning rate for the weight
    */
   explicit Weight(Tensor *v, Tensor *g, const WeightRegularizer reg,
                   const float reg_const, const float decay,
-                  bool is_dependent = false, const float max_norm = 0.0f) :
+                  bool is_dependent = false, const float max_norm = 0.0f,
+                  const float lr_multiplier = 1.0f) :
     Var_Grad(v, g, is_dependent),
     regularizer(reg),
     regularizer_constant(reg_const),
     decay(decay),
-    clip_by_global_norm(max_norm) {}
+    clip_by_global_norm(max_norm),
+    lr_multiplier(lr_multiplier) {}
 
   /**
    * @brief Swap for weight
@@ -135,6 +142,7 @@ public:
     swap(lhs.regularizer_constant, rhs.regularizer_constant);
     swap(lhs.decay, rhs.decay);
     swap(lhs.clip_by_global_norm, rhs.clip_by_global_norm);
+    swap(lhs.lr_multiplier, rhs.lr_multiplier);
     swap(lhs.opt_vars, rhs.opt_vars);
   }
 
@@ -276,6 +284,13 @@ public:
     return clip_by_global_norm > epsilon;
   }
 
+  /**
+   * @brief Get the multiplier of the learning rate for the weight
+   *
+   * @return float learning rate multiplier
+   */
+  float getLearningRateMultiplier() const { return lr_multiplier; }
+
   /**
    * @brief clip the gradient value based on the given global norm
    *
@@ -295,6 +310,7 @@ private:
   float regularizer_constant;    /**< constant factor for regularization */
   float decay;                   /**< constant factor for the weight decay */
   float clip_by_global_norm; /**< constant factor to clip gradient by L2 norm */
+  float lr_multiplier;       /**< multiplier of the learning rate */
   std::vector<Tensor *> opt_vars; /**< optimizer variables */
 
   /**
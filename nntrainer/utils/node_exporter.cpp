@@ -13,6 +13,7 @@
 
 #ifdef ENABLE_TFLITE_INTERPRETER
 #include <common_properties.h>
+#include <conv2d_layer.h>
 #include <fc_layer.h>
 #include <node_exporter.h>
 #include <tf_schema_generated.h>
@@ -57,7 +58,8 @@ void Exporter::saveTflResult(
   const std::tuple<props::Name, props::Distribute, props::Trainable,
                    std::vector<props::InputConnection>,
                    std::vector<props::InputShape>, props::SharedFrom,
-                   props::ClipGradByGlobalNorm> &props,
+                   props::ClipGradByGlobalNorm,
+                   props::LearningRateMultiplier> &props,
   const LayerNode *self) {
   createIfNull(tf_node);
   tf_node->setLayerNode(*self);
@@ -99,6 +101,77 @@ void Exporter::saveTflResult(const std::tuple<props::Unit> &props,
   tf_node->setBuiltinOptions(tflite::BuiltinOptions_FullyConnectedOptions,
                              flatbuffers::Offset<void>());
 }
+
+template <>
+void Exporter::saveTflResult(
+  const std::tuple<props::FilterSize,
+                   std::array<props::KernelSize, CONV2D_DIM>,
+                   std::array<props::Stride, CONV2D_DIM>, props::Padding2D,
+                   props::ConvAlgorithm, props::Groups,
+                   props::Im2ColCache> &props,
+  const Conv2DLayer *self) {
+  createIfNull(tf_node);
+
+  const std::string &padding_str = std::get<props::Padding2D>(props).get();
+  tflite::Padding padding;
+  if (istrequal(padding_str, "same")) {
+    padding = tflite::Padding_SAME;
+  } else if (istrequal(padding_str, "valid")) {
+    padding = tflite::Padding_VALID;
+  } else {
+    throw exception::not_supported(
+      "only same or valid padding can be exported, padding: " + padding_str);
+  }
+
+  auto &stride = std::get<std::array<props::Stride, CONV2D_DIM>>(props);
+  int stride_h = stride[0].get(), stride_w = stride[1].get();
+  unsigned int groups = std::get<props::Groups>(props);
+  unsigned int filters = std::get<props::FilterSize>(props);
+
+  /// a grouped convolution is exported only if it is depthwise, which is
+  /// checked from the channel of the filter
+  auto weight_transform = [groups](std::vector<const Tensor *> &weights) {
+    std::vector<Tensor> new_weights;
+    new_weights.reserve(weights.size());
+
+    const Tensor &filter = *weights[0];
+    if (groups > 1) {
+      NNTR_THROW_IF(filter.channel() != 1, exception::not_supported)
+        << "only depthwise convolution can be exported among grouped ones";
+      /// (filters, 1, kh, kw) -> (1, kh, kw, filters)
+      Tensor depthwise = filter.getSharedDataTensor(
+        TensorDim(1, filter.batch(), filter.height(), filter.width()), 0);
+      new_weights.push_back(depthwise.transpose("1:2:0"));
+    } else {
+      /// (filters, channel, kh, kw) -> (filters, kh, kw, channel)
+      new_weights.push_back(filter.transpose("1:2:0"));
+    }
+
+    for (unsigned int i = 1; i < weights.size(); ++i)
+      new_weights.push_back(*weights[i]);
+    return new_weights;
+  };
+  tf_node->setWeightTransformFn(weight_transform);
+
+  if (groups > 1) {
+    tf_node->setOpType(tflite::BuiltinOperator_DEPTHWISE_CONV_2D);
+    tf_node->setBuiltinOptionsFn(
+      tflite::BuiltinOptions_DepthwiseConv2DOptions,
+      [=](flatbuffers::FlatBufferBuilder &f) {
+        return tflite::CreateDepthwiseConv2DOptions(f, padding, stride_w,
+                                                    stride_h, filters / groups)
+          .Union();
+      });
+  } else {
+    tf_node->setOpType(tflite::BuiltinOperator_CONV_2D);
+    tf_node->setBuiltinOptionsFn(
+      tflite::BuiltinOptions_Conv2DOptions,
+      [=](flatbuffers::FlatBufferBuilder &f) {
+        return tflite::CreateConv2DOptions(f, padding, stride_w, stride_h)
+          .Union();
+      });
+  }
+}
 #endif
 
 } // namespace nntrainer
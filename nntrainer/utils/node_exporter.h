@@ -12,6 +12,7 @@
 #ifndef __NODE_EXPORTER_H__
 #define __NODE_EXPORTER_H__
 
+#include <array>
 #include <memory>
 #include <regex>
 #include <string>
@@ -218,7 +219,15 @@ class BiasInitializer;
 class SharedFrom;
 class InputConnection;
 class ClipGradByGlobalNorm;
+class LearningRateMultiplier;
 class DisableBias;
+class FilterSize;
+class KernelSize;
+class Stride;
+class Padding2D;
+class ConvAlgorithm;
+class Groups;
+class Im2ColCache;
 } // namespace props
 
 class LayerNode;
@@ -231,7 +240,8 @@ void Exporter::saveTflResult(
   const std::tuple<props::Name, props::Distribute, props::Trainable,
                    std::vector<props::InputConnection>,
                    std::vector<props::InputShape>, props::SharedFrom,
-                   props::ClipGradByGlobalNorm> &props,
+                   props::ClipGradByGlobalNorm,
+                   props::LearningRateMultiplier> &props,
   const LayerNode *self);
 
 class LayerImpl;
@@ -256,6 +266,19 @@ class FullyConnectedLayer;
 template <>
 void Exporter::saveTflResult(const std::tuple<props::Unit> &props,
                              const FullyConnectedLayer *self);
+
+class Conv2DLayer;
+/**
+ * @copydoc template <typename PropsType, typename NodeType> void
+ * Exporter::saveTflResult(const PropsType &props, const NodeType *self);
+ */
+template <>
+void Exporter::saveTflResult(
+  const std::tuple<props::FilterSize, std::array<props::KernelSize, 2>,
+                   std::array<props::Stride, 2>, props::Padding2D,
+                   props::ConvAlgorithm, props::Groups,
+                   props::Im2ColCache> &props,
+  const Conv2DLayer *self);
 #endif
 
 /**
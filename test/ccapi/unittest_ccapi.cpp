@@ -11,6 +11,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 
 #include <dataset.h>
@@ -20,6 +22,7 @@
 #include <nntrainer_test_util.h>
 #include <optimizer.h>
 #include <nntrainer_error.h>
+#include <weight_registry.h>
 
 static const std::string getTestResPath(const std::string &file) {
   return getResPath(file, {"test"});
@@ -205,8 +208,8 @@ TEST(nntrainer_ccapi, train_with_config_01_p) {
   EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
   EXPECT_NO_THROW(model->train());
 
-  EXPECT_NEAR(model->getTrainingLoss(), 4.13896, tolerance);
-  EXPECT_NEAR(model->getValidationLoss(), 3.64587, tolerance);
+  EXPECT_NEAR(model->getTrainingLoss(), 3.9478376, tolerance);
+  EXPECT_NEAR(model->getValidationLoss(), 2.6556323, tolerance);
 }
 
 /**
@@ -258,8 +261,8 @@ TEST(nntrainer_ccapi, train_dataset_with_file_01_p) {
   EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
   EXPECT_NO_THROW(model->train());
 
-  EXPECT_NEAR(model->getTrainingLoss(), 2.1782395, tolerance);
-  EXPECT_NEAR(model->getValidationLoss(), 2.2059061, tolerance);
+  EXPECT_NEAR(model->getTrainingLoss(), 2.1374955, tolerance);
+  EXPECT_NEAR(model->getValidationLoss(), 2.2373335, tolerance);
 }
 
 /**
@@ -311,8 +314,8 @@ TEST(nntrainer_ccapi, train_dataset_with_generator_01_p) {
   EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
   EXPECT_NO_THROW(model->train());
 
-  EXPECT_NEAR(model->getTrainingLoss(), 2.238682, tolerance);
-  EXPECT_NEAR(model->getValidationLoss(), 2.0042247, tolerance);
+  EXPECT_NEAR(model->getTrainingLoss(), 2.1580095, tolerance);
+  EXPECT_NEAR(model->getValidationLoss(), 1.9506602, tolerance);
 }
 
 /**
@@ -382,8 +385,362 @@ TEST(nntrainer_ccapi, train_batch_size_update_after) {
   EXPECT_NO_THROW(model->setProperty({"batch_size=4"}));
   EXPECT_NO_THROW(model->train());
 
-  EXPECT_NEAR(model->getTrainingLoss(), 1.9332184, tolerance);
-  EXPECT_NEAR(model->getValidationLoss(), 2.179843, tolerance);
+  EXPECT_NEAR(model->getTrainingLoss(), 1.9154897, tolerance);
+  EXPECT_NEAR(model->getValidationLoss(), 2.1859045, tolerance);
+}
+
+/**
+ * @brief create a model trained on the generator datasets
+ *
+ * @param train_data train data for the generator
+ * @param valid_data valid data for the generator
+ * @return std::unique_ptr<ml::train::Model> created model
+ */
+static std::unique_ptr<ml::train::Model>
+createGeneratorModel(DataInformation &train_data, DataInformation &valid_data) {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+
+  model->addLayer(ml::train::layer::Input(
+    {"input_shape=1:1:62720", "normalization=true"}));
+  model->addLayer(ml::train::layer::FullyConnected(
+    {"unit= 10", "activation=softmax", "bias_initializer=zeros",
+     "weight_initializer=xavier_uniform", "input_layers=input0"}));
+  model->setOptimizer(
+    ml::train::optimizer::Adam({"learning_rate=0.0001", "beta1=0.002",
+                                "beta2=0.001", "epsilon=1e-7"}));
+
+  std::shared_ptr<ml::train::Dataset> dataset = ml::train::createDataset(
+    ml::train::DatasetType::GENERATOR, getSample, &train_data);
+  dataset->setProperty({"buffer_size=100"});
+  model->setDataset(ml::train::DatasetModeType::MODE_TRAIN, dataset);
+
+  dataset = ml::train::createDataset(ml::train::DatasetType::GENERATOR,
+                                     getSample, &valid_data);
+  dataset->setProperty({"buffer_size=100"});
+  model->setDataset(ml::train::DatasetModeType::MODE_VALID, dataset);
+
+  model->setProperty({"loss=cross", "batch_size=16", "epochs=2"});
+  return model;
+}
+
+/**
+ * @brief Neural Network Model Training with the metrics kept in the ring
+ */
+TEST(nntrainer_ccapi, train_metrics_ring_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+
+  EXPECT_NO_THROW(model->setProperty({"metrics=ring", "metrics_interval=1"}));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_NO_THROW(model->train());
+
+  auto metrics = model->takeMetrics();
+  std::vector<ml::train::TrainingMetrics> epoch_ends;
+  unsigned int epoch = 1;
+  for (auto const &m : metrics) {
+    EXPECT_EQ(m.epoch, epoch);
+    if (m.epoch_end) {
+      epoch_ends.push_back(m);
+      epoch++;
+    } else {
+      EXPECT_GT(m.iteration, 0u);
+    }
+  }
+
+  ASSERT_EQ(epoch_ends.size(), 2u);
+  EXPECT_EQ(epoch_ends[1].iteration, 4u);
+  EXPECT_EQ(epoch_ends[1].num_samples, 50u);
+  EXPECT_FLOAT_EQ(epoch_ends[1].loss, model->getTrainingLoss());
+  EXPECT_TRUE(epoch_ends[1].has_validation);
+  EXPECT_FLOAT_EQ(epoch_ends[1].validation_loss, model->getValidationLoss());
+
+  EXPECT_TRUE(model->takeMetrics().empty());
+}
+
+/**
+ * @brief Neural Network Model Training with the metrics given to a callback
+ */
+TEST(nntrainer_ccapi, train_metrics_callback_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+
+  unsigned int num_epoch_ends = 0;
+  float loss = 0.0f;
+  model->setMetricsCallback(
+    [&num_epoch_ends, &loss](const ml::train::TrainingMetrics &m) {
+      if (m.epoch_end) {
+        num_epoch_ends++;
+        loss = m.loss;
+      }
+    });
+
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_NO_THROW(model->train());
+
+  EXPECT_EQ(num_epoch_ends, 2u);
+  EXPECT_FLOAT_EQ(loss, model->getTrainingLoss());
+  /** nothing is kept without the ring sink */
+  EXPECT_TRUE(model->takeMetrics().empty());
+}
+
+/**
+ * @brief Neural Network Model metrics properties
+ */
+TEST(nntrainer_ccapi, set_metrics_property_n) {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+
+  EXPECT_THROW(model->setProperty({"metrics=file"}), std::invalid_argument);
+  EXPECT_THROW(model->setProperty({"metrics_interval=0"}),
+               std::invalid_argument);
+}
+
+/**
+ * @brief training callback counting the hooks called
+ */
+class CountingCallback : public ml::train::TrainingCallback {
+public:
+  /**
+   * @brief Construct a new Counting Callback object
+   *
+   * @param stop_at iteration of the first epoch to stop the training at, 0 to
+   * never stop
+   */
+  CountingCallback(unsigned int stop_at = 0) : stop_at(stop_at) {}
+
+  void onTrainBegin(ml::train::Model &model) override { train_begins++; }
+
+  void onIteration(ml::train::Model &model, unsigned int epoch,
+                   const ml::train::RunStats &stats) override {
+    iterations++;
+    if (stats.num_iterations == static_cast<int>(stop_at)) {
+      model.stopTraining();
+    }
+  }
+
+  void onValidation(ml::train::Model &model, unsigned int epoch,
+                    const ml::train::RunStats &stats) override {
+    validations++;
+  }
+
+  void onEpochEnd(ml::train::Model &model, unsigned int epoch,
+                  const ml::train::RunStats &training,
+                  const ml::train::RunStats *validation) override {
+    epoch_ends++;
+    validated_epochs += validation != nullptr;
+  }
+
+  unsigned int stop_at;
+  unsigned int train_begins = 0;
+  unsigned int iterations = 0;
+  unsigned int validations = 0;
+  unsigned int epoch_ends = 0;
+  unsigned int validated_epochs = 0;
+};
+
+/**
+ * @brief Neural Network Model Training with a training callback
+ */
+TEST(nntrainer_ccapi, train_callback_hooks_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+
+  auto counter = std::make_shared<CountingCallback>();
+  EXPECT_NO_THROW(model->addTrainingCallback(counter));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_NO_THROW(model->train());
+
+  EXPECT_EQ(counter->train_begins, 1u);
+  EXPECT_EQ(counter->iterations, 8u);
+  EXPECT_EQ(counter->validations, 2u);
+  EXPECT_EQ(counter->epoch_ends, 2u);
+  EXPECT_EQ(counter->validated_epochs, 2u);
+}
+
+/**
+ * @brief Neural Network Model Training stopped by a training callback
+ */
+TEST(nntrainer_ccapi, train_callback_stop_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+
+  auto counter = std::make_shared<CountingCallback>(2);
+  EXPECT_NO_THROW(model->addTrainingCallback(counter));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_NO_THROW(model->train());
+
+  EXPECT_EQ(counter->iterations, 2u);
+  EXPECT_EQ(counter->epoch_ends, 1u);
+  /** a stopped epoch is not validated */
+  EXPECT_EQ(counter->validated_epochs, 0u);
+
+  /** the stop request does not outlive the training */
+  counter->stop_at = 0;
+  EXPECT_NO_THROW(model->train());
+  EXPECT_EQ(counter->train_begins, 2u);
+  EXPECT_EQ(counter->epoch_ends, 3u);
+}
+
+/**
+ * @brief generator data which stops the training when a sample is given
+ */
+struct StoppingData {
+  DataInformation data;    /**< data given by the generator */
+  ml::train::Model *model; /**< model to stop */
+  unsigned int stop_at;    /**< number of samples given before stopping */
+  unsigned int count;      /**< number of samples given */
+};
+
+/**
+ * @brief generator callback which stops the model at the given sample
+ */
+static int getSampleAndStop(float **outVec, float **outLabel, bool *last,
+                            void *user_data) {
+  auto stopping = reinterpret_cast<StoppingData *>(user_data);
+  if (++stopping->count == stopping->stop_at) {
+    stopping->model->stopTraining();
+  }
+  return getSample(outVec, outLabel, last, &stopping->data);
+}
+
+/**
+ * @brief Neural Network Model Training stopped in the middle of a validation
+ */
+TEST(nntrainer_ccapi, train_callback_stop_validation_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+  const std::string save_best_path = "train_callback_stop_validation_p.bin";
+  std::remove(save_best_path.c_str());
+
+  /** stopped at the last sample of the first validation */
+  StoppingData stopping{createValidData(), model.get(), 0, 0};
+  stopping.stop_at = stopping.data.num_samples;
+  std::shared_ptr<ml::train::Dataset> dataset = ml::train::createDataset(
+    ml::train::DatasetType::GENERATOR, getSampleAndStop, &stopping);
+  EXPECT_EQ(model->setDataset(ml::train::DatasetModeType::MODE_VALID, dataset),
+            ML_ERROR_NONE);
+
+  auto counter = std::make_shared<CountingCallback>();
+  EXPECT_NO_THROW(model->addTrainingCallback(counter));
+  EXPECT_NO_THROW(model->setProperty({"save_best_path=" + save_best_path}));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_NO_THROW(model->train());
+
+  /** the statistics of the validated subset are neither reported nor saved */
+  EXPECT_EQ(counter->epoch_ends, 1u);
+  EXPECT_EQ(counter->validations, 0u);
+  EXPECT_EQ(counter->validated_epochs, 0u);
+  EXPECT_FALSE(std::ifstream(save_best_path).good());
+  std::remove(save_best_path.c_str());
+}
+
+/**
+ * @brief Neural Network Model Training with early stopping
+ */
+TEST(nntrainer_ccapi, train_early_stopping_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+
+  auto counter = std::make_shared<CountingCallback>();
+  EXPECT_NO_THROW(model->setProperty({"epochs=5"}));
+  /** no epoch improves enough, so the training stops after the second */
+  EXPECT_NO_THROW(model->addTrainingCallback(ml::train::callback::EarlyStopping(
+    {"monitor=loss", "patience=1", "min_delta=100"})));
+  EXPECT_NO_THROW(model->addTrainingCallback(counter));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_NO_THROW(model->train());
+
+  EXPECT_EQ(counter->epoch_ends, 2u);
+  EXPECT_EQ(counter->iterations, 8u);
+}
+
+/**
+ * @brief Neural Network Model Training with the learning rate reduced on
+ * plateau
+ */
+TEST(nntrainer_ccapi, train_reduce_lr_on_plateau_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+
+  EXPECT_NO_THROW(model->setProperty({"epochs=3"}));
+  EXPECT_NO_THROW(
+    model->addTrainingCallback(ml::train::callback::ReduceLROnPlateau(
+      {"monitor=val_accuracy", "patience=1", "min_delta=200", "factor=0.5",
+       "min_scale=0.3"})));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ(model->getLearningRateScale(), 1.0f);
+  EXPECT_NO_THROW(model->train());
+
+  /** reduced on the second and the third epoch, bounded by min_scale */
+  EXPECT_FLOAT_EQ(model->getLearningRateScale(), 0.3f);
+}
+
+/**
+ * @brief Neural Network Model Training with the periodic validation
+ */
+TEST(nntrainer_ccapi, train_periodic_validation_p) {
+  auto train_data = createTrainData();
+  auto valid_data = createValidData();
+  auto model = createGeneratorModel(train_data, valid_data);
+
+  auto counter = std::make_shared<CountingCallback>();
+  EXPECT_NO_THROW(model->addTrainingCallback(
+    ml::train::callback::PeriodicValidation({"interval=3"})));
+  EXPECT_NO_THROW(model->addTrainingCallback(counter));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_NO_THROW(model->train());
+
+  /** validated at the third iteration and at the end of each epoch */
+  EXPECT_EQ(counter->validations, 4u);
+  EXPECT_EQ(counter->epoch_ends, 2u);
+}
+
+/**
+ * @brief Training callback creation with invalid arguments
+ */
+TEST(nntrainer_ccapi, create_training_callback_n) {
+  EXPECT_THROW(ml::train::createTrainingCallback("unknown"),
+               std::invalid_argument);
+  EXPECT_THROW(ml::train::callback::EarlyStopping({"monitor=accuracy"}),
+               std::invalid_argument);
+  EXPECT_THROW(ml::train::callback::EarlyStopping({"min_delta=-1"}),
+               std::invalid_argument);
+  EXPECT_THROW(ml::train::callback::EarlyStopping({"factor=0.5"}),
+               std::invalid_argument);
+  EXPECT_THROW(ml::train::callback::ReduceLROnPlateau({"factor=1"}),
+               std::invalid_argument);
+  EXPECT_THROW(ml::train::callback::PeriodicValidation(),
+               std::invalid_argument);
+  EXPECT_THROW(ml::train::callback::PeriodicValidation({"interval=0"}),
+               std::invalid_argument);
+}
+
+/**
+ * @brief Neural Network Model training callback and learning rate scale with
+ * invalid arguments
+ */
+TEST(nntrainer_ccapi, training_callback_model_n) {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+
+  EXPECT_THROW(model->addTrainingCallback(nullptr), std::invalid_argument);
+  EXPECT_THROW(model->setLearningRateScale(0.0f), std::invalid_argument);
+  EXPECT_THROW(model->setLearningRateScale(-1.0f), std::invalid_argument);
+  EXPECT_NO_THROW(model->setLearningRateScale(0.5f));
+  EXPECT_FLOAT_EQ(model->getLearningRateScale(), 0.5f);
 }
 
 /**
@@ -428,6 +785,78 @@ TEST(nntrainer_ccapi, save_ini_p) {
   model->save(saved_ini_name, ml::train::ModelFormat::MODEL_FORMAT_INI);
 }
 
+/**
+ * @brief create an initialized model of a fully connected layer
+ *
+ * @param unit unit of the layer
+ * @param initializer initializer of the weight and the bias
+ * @return std::unique_ptr<ml::train::Model> created model
+ */
+static std::unique_ptr<ml::train::Model>
+createFcModel(unsigned int unit, const std::string &initializer) {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+
+  model->addLayer(ml::train::layer::Input({"input_shape=1:1:3"}));
+  model->addLayer(ml::train::layer::FullyConnected(
+    {"unit=" + std::to_string(unit), "weight_initializer=" + initializer,
+     "bias_initializer=" + initializer}));
+  model->setOptimizer(ml::train::optimizer::SGD({"learning_rate=0.1"}));
+  model->setProperty({"loss=mse", "batch_size=1"});
+
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  return model;
+}
+
+/**
+ * @brief Neural Network Model weights handed over in memory through the
+ * weight registry
+ */
+TEST(nntrainer_ccapi, weight_registry_handover_p) {
+  auto &registry = nntrainer::WeightRegistry::Global();
+  auto publisher = createFcModel(2, "ones");
+  auto subscriber = createFcModel(2, "zeros");
+
+  std::vector<float> input = {1.0f, 2.0f, 3.0f};
+  EXPECT_FLOAT_EQ(subscriber->inference(1, {input.data()}, {})[0][0], 0.0f);
+
+  /// nothing is pulled before the weights are published
+  EXPECT_EQ(registry.pull("weight_registry_handover_p", *subscriber), 0u);
+
+  unsigned int version =
+    registry.publish("weight_registry_handover_p", *publisher);
+  EXPECT_GT(version, 0u);
+  EXPECT_EQ(registry.pull("weight_registry_handover_p", *subscriber), version);
+  EXPECT_EQ(registry.pull("weight_registry_handover_p", *subscriber, version),
+            version);
+
+  auto output = subscriber->inference(1, {input.data()}, {});
+  EXPECT_FLOAT_EQ(output[0][0], 7.0f);
+  EXPECT_FLOAT_EQ(output[0][1], 7.0f);
+
+  registry.drop("weight_registry_handover_p");
+  EXPECT_EQ(registry.pull("weight_registry_handover_p", *subscriber), 0u);
+}
+
+/**
+ * @brief Neural Network Model weights of another graph are not pulled
+ */
+TEST(nntrainer_ccapi, weight_registry_mismatch_n) {
+  auto &registry = nntrainer::WeightRegistry::Global();
+  auto publisher = createFcModel(2, "ones");
+  auto subscriber = createFcModel(3, "zeros");
+
+  registry.publish("weight_registry_mismatch_n", *publisher);
+  EXPECT_THROW(registry.pull("weight_registry_mismatch_n", *subscriber),
+               std::invalid_argument);
+
+  /// the weights are left as they are
+  std::vector<float> input = {1.0f, 2.0f, 3.0f};
+  EXPECT_FLOAT_EQ(subscriber->inference(1, {input.data()}, {})[0][0], 0.0f);
+
+  registry.drop("weight_registry_mismatch_n");
+}
+
 /**
  * @brief Main gtest
  */
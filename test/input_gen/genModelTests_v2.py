@@ -101,6 +101,27 @@ class FCRelu(torch.nn.Module):
                 {'params': non_decay_params},
                 {'params': decay_params, 'weight_decay': 0.9}], lr=0.1)
 
+class FCSigmoidSoftmax(torch.nn.Module):
+    def __init__(self):
+        super().__init__()
+        self.fc = torch.nn.Linear(3, 5)
+        self.fc1 = torch.nn.Linear(5, 10)
+        self.loss = torch.nn.MSELoss()
+
+    def forward(self, inputs, labels):
+        out = torch.sigmoid(self.fc(inputs[0]))
+        out = torch.softmax(self.fc1(out), dim=-1)
+        loss = self.loss(out, labels[0])
+        return out, loss
+
+    ##
+    # @brief sgd applying the learning rate multiplier of each layer as the
+    # learning rate of its param group
+    def getMultipliedOptimizer(self, lr, multipliers):
+        return torch.optim.SGD([
+            {'params': self.fc.parameters(), 'lr': lr * multipliers[0]},
+            {'params': self.fc1.parameters(), 'lr': lr * multipliers[1]}], lr=lr)
+
 
 if __name__ == "__main__":
     record_v2(
@@ -140,4 +161,31 @@ if __name__ == "__main__":
         optimizer=fc_relu_decay.getOptimizer()
     )
 
+    fc_sigmoid_lr_multiplier = FCSigmoidSoftmax()
+    record_v2(
+        fc_sigmoid_lr_multiplier,
+        iteration=10,
+        input_dims=[(3,3)],
+        input_dtype=[float],
+        label_dims=[(3,10)],
+        name="fc_sigmoid_mse_lr_multiplier",
+        optimizer=fc_sigmoid_lr_multiplier.getMultipliedOptimizer(4, (0.25, 0.5))
+    )
+
+    fc_sigmoid_lr_step = FCSigmoidSoftmax()
+    fc_sigmoid_lr_step_optimizer = torch.optim.SGD(
+        fc_sigmoid_lr_step.parameters(), lr=1)
+    record_v2(
+        fc_sigmoid_lr_step,
+        iteration=10,
+        input_dims=[(3,3)],
+        input_dtype=[float],
+        label_dims=[(3,10)],
+        name="fc_sigmoid_mse_lr_step",
+        optimizer=fc_sigmoid_lr_step_optimizer,
+        # step scheduler of decay_rate 0.5 and decay_steps 4
+        scheduler=torch.optim.lr_scheduler.LambdaLR(
+            fc_sigmoid_lr_step_optimizer, lambda i: 0.5 ** (i // 4))
+    )
+
     inspect_file("fc_relu_decay.nnmodelgolden")
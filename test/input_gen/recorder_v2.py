@@ -61,8 +61,11 @@ def _rand_like(shapes, scale=1, dtype=None):
 # @param input_dims dimensions to record including batch (list of tuple)
 # @param label_dims dimensions to record including batch (list of tuple)
 # @param name golden name
+# @param scheduler learning rate scheduler, stepped at every iteration as the
+# learning rate scheduler of nntrainer
 def record_v2(model, iteration, input_dims, label_dims, name, clip=False,
-              input_dtype=None, input_label_reader=None, optimizer=None):
+              input_dtype=None, input_label_reader=None, optimizer=None,
+              scheduler=None):
     ## file format is as below
     # [<number of iteration(int)> <Iteration> <Iteration>...<Iteration>]
     # Each iteration contains
@@ -94,6 +97,8 @@ def record_v2(model, iteration, input_dims, label_dims, name, clip=False,
         if clip:
             norm = torch.nn.utils.clip_grad_norm_(model.parameters(), 0.0001)
         optimizer.step()
+        if scheduler != None:
+            scheduler.step()
 
     with open(file_name, "wb") as f:
         # write number of iterations
@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file test_nnstreamer_trainer.cpp
+ * @date 19 October 2026
+ * @brief NNTrainer tensor_trainer sub-plugin test
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug No known bugs except for NYI items
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <dataset.h>
+#include <model.h>
+#include <nntrainer_test_util.h>
+#include <weight_registry.h>
+
+#include <tensor_trainer_nntrainer.hh>
+
+static constexpr unsigned int feature_len = 3;
+static constexpr unsigned int num_class = 2;
+
+static nntrainer::IniSection model_base("Model", "Type = NeuralNetwork"
+                                                 " | batch_size = 2"
+                                                 " | loss = mse");
+
+static nntrainer::IniSection optimizer("Optimizer", "Type = sgd"
+                                                    " | Learning_rate = 0.1");
+
+static nntrainer::IniSection input_layer("inputlayer",
+                                         "Type = input"
+                                         " | Input_Shape = 1:1:3");
+
+static nntrainer::IniSection fc_layer("fclayer",
+                                      "Type = fully_connected"
+                                      " | Unit = 2"
+                                      " | weight_initializer = ones"
+                                      " | bias_initializer = zeros");
+
+/**
+ * @brief frames of the pipeline, the inputs followed by the labels
+ */
+struct Frames {
+  /**
+   * @brief Construct frames of deterministic samples
+   *
+   * @param num_frames number of frames
+   */
+  Frames(unsigned int num_frames) :
+    inputs(num_frames, std::vector<float>(feature_len)),
+    labels(num_frames, std::vector<float>(num_class)) {
+    for (unsigned int i = 0; i < num_frames; ++i) {
+      for (unsigned int j = 0; j < feature_len; ++j)
+        inputs[i][j] = 0.1f * (i + 1) - 0.2f * j;
+      labels[i][i % num_class] = 1.0f;
+    }
+  }
+
+  /**
+   * @brief get the tensors of a frame as pushed by tensor_trainer
+   *
+   * @param idx index of the frame
+   * @return std::vector<GstTensorMemory> input followed by label
+   */
+  std::vector<GstTensorMemory> memory(unsigned int idx) {
+    return {{inputs[idx].data(), inputs[idx].size() * sizeof(float)},
+            {labels[idx].data(), labels[idx].size() * sizeof(float)}};
+  }
+
+  std::vector<std::vector<float>> inputs;
+  std::vector<std::vector<float>> labels;
+};
+
+/**
+ * @brief generator giving the frames from @a begin to @a end in order
+ */
+struct FrameRange {
+  Frames *frames;      /**< frames to give */
+  unsigned int begin;  /**< first frame */
+  unsigned int end;    /**< one past the last frame */
+  unsigned int cursor; /**< next frame */
+};
+
+/**
+ * @brief generator callback of a frame range
+ */
+static int getFrame(float **outVec, float **outLabel, bool *last,
+                    void *user_data) {
+  auto range = reinterpret_cast<FrameRange *>(user_data);
+  auto &frames = *range->frames;
+
+  std::copy(frames.inputs[range->cursor].begin(),
+            frames.inputs[range->cursor].end(), *outVec);
+  std::copy(frames.labels[range->cursor].begin(),
+            frames.labels[range->cursor].end(), *outLabel);
+
+  *last = ++range->cursor == range->end;
+  if (*last)
+    range->cursor = range->begin;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief tensor_trainer sub-plugin test
+ *
+ */
+class nntrainerTrainer : public testing::Test {
+protected:
+  /**
+   * @brief SetUp the test case
+   *
+   */
+  void SetUp() override {
+    ini = std::make_unique<ScopedIni>(
+      "test_nnstreamer_trainer",
+      nntrainer::IniWrapper::Sections{model_base, optimizer, input_layer,
+                                      fc_layer});
+
+    prop = {};
+    gst_tensors_info_init(&prop.input_meta);
+    prop.input_meta.num_tensors = 2;
+    for (unsigned int i = 0; i < 2; ++i) {
+      GstTensorInfo *info = prop.input_meta.info + i;
+      info->type = _NNS_FLOAT32;
+      info->dimension[0] = i == 0 ? feature_len : num_class;
+      info->dimension[1] = info->dimension[2] = info->dimension[3] = 1;
+    }
+
+    config = ini->getIniName();
+    prop.model_config = config.c_str();
+    prop.num_inputs = 1;
+    prop.num_labels = 1;
+    prop.num_epochs = 1;
+    prop.num_training_samples = 4;
+    prop.num_validation_samples = 2;
+  }
+
+  /**
+   * @brief wait until the trainer reports the epochs trained
+   *
+   * @param trainer trainer to wait for
+   * @param epochs number of epochs to wait for
+   * @return GstTensorTrainerProperties status of the trainer
+   */
+  GstTensorTrainerProperties waitEpochs(NNTrainerTrain &trainer,
+                                        unsigned int epochs) {
+    GstTensorTrainerProperties status = {};
+    for (unsigned int i = 0; i < 1000; ++i) {
+      trainer.getStatus(&status);
+      if (status.epoch_count >= epochs)
+        break;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return status;
+  }
+
+  std::unique_ptr<ScopedIni> ini;
+  std::string config;
+  GstTensorTrainerProperties prop;
+};
+
+/**
+ * @brief a trainer without training samples is rejected
+ */
+TEST_F(nntrainerTrainer, no_training_samples_n) {
+  prop.num_training_samples = 0;
+  EXPECT_THROW(NNTrainerTrain trainer(&prop), std::invalid_argument);
+}
+
+/**
+ * @brief frames of a size different from the model are rejected
+ */
+TEST_F(nntrainerTrainer, frame_size_mismatch_n) {
+  prop.input_meta.info[0].dimension[0] = feature_len + 1;
+  EXPECT_THROW(NNTrainerTrain trainer(&prop), std::invalid_argument);
+}
+
+/**
+ * @brief a frame smaller than its tensor info is not pushed
+ */
+TEST_F(nntrainerTrainer, short_frame_n) {
+  NNTrainerTrain trainer(&prop);
+  Frames frames(1);
+  auto memory = frames.memory(0);
+  memory[0].size -= sizeof(float);
+
+  EXPECT_EQ(trainer.pushData(memory.data()), -EINVAL);
+}
+
+/**
+ * @brief the frames of an epoch are trained and validated as the samples of a
+ * model given by generators in the same order
+ */
+TEST_F(nntrainerTrainer, frames_to_samples_p) {
+  const unsigned int num_frames =
+    prop.num_training_samples + prop.num_validation_samples;
+  Frames frames(num_frames);
+
+  NNTrainerTrain trainer(&prop);
+  trainer.start(nullptr);
+  for (unsigned int i = 0; i < num_frames; ++i) {
+    auto memory = frames.memory(i);
+    EXPECT_EQ(trainer.pushData(memory.data()), 0);
+  }
+  auto status = waitEpochs(trainer, 1);
+  trainer.stop();
+  EXPECT_EQ(status.epoch_count, 1u);
+
+  FrameRange train_range{&frames, 0, prop.num_training_samples, 0};
+  FrameRange valid_range{&frames, prop.num_training_samples, num_frames,
+                         prop.num_training_samples};
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+  model->load(config, ml::train::ModelFormat::MODEL_FORMAT_INI);
+  model->setProperty({"epochs=1"});
+  std::shared_ptr<ml::train::Dataset> train_dataset =
+    ml::train::createDataset(ml::train::DatasetType::GENERATOR, getFrame,
+                             &train_range);
+  std::shared_ptr<ml::train::Dataset> valid_dataset =
+    ml::train::createDataset(ml::train::DatasetType::GENERATOR, getFrame,
+                             &valid_range);
+  model->setDataset(ml::train::DatasetModeType::MODE_TRAIN, train_dataset);
+  model->setDataset(ml::train::DatasetModeType::MODE_VALID, valid_dataset);
+  ASSERT_EQ(model->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(model->initialize(), ML_ERROR_NONE);
+  ASSERT_EQ(model->train(), ML_ERROR_NONE);
+
+  EXPECT_FLOAT_EQ(status.training_loss, model->getTrainingLoss());
+  EXPECT_FLOAT_EQ(status.validation_loss, model->getValidationLoss());
+}
+
+/**
+ * @brief an epoch is counted when it is trained and its weights are saved and
+ * published, and no frame is taken once the trainer is stopped
+ */
+TEST_F(nntrainerTrainer, epoch_count_p) {
+  const unsigned int num_epochs = 3;
+  const std::string save_path = "test_nnstreamer_trainer_epoch_count_p.bin";
+  std::remove(save_path.c_str());
+  prop.num_epochs = num_epochs;
+  prop.num_validation_samples = 0;
+  prop.model_save_path = save_path.c_str();
+  Frames frames(prop.num_training_samples);
+
+  NNTrainerTrain trainer(&prop);
+  GstTensorTrainerProperties status = {};
+  trainer.getStatus(&status);
+  EXPECT_EQ(status.epoch_count, 0u);
+
+  trainer.start(nullptr);
+  for (unsigned int epoch = 0; epoch < num_epochs; ++epoch) {
+    for (unsigned int i = 0; i < prop.num_training_samples; ++i) {
+      auto memory = frames.memory(i);
+      EXPECT_EQ(trainer.pushData(memory.data()), 0);
+    }
+  }
+
+  status = waitEpochs(trainer, num_epochs);
+  EXPECT_EQ(status.epoch_count, num_epochs);
+  EXPECT_GT(status.training_loss, 0.0);
+
+  trainer.stop();
+  auto memory = frames.memory(0);
+  EXPECT_EQ(trainer.pushData(memory.data()), -ESHUTDOWN);
+
+  trainer.getStatus(&status);
+  EXPECT_EQ(status.epoch_count, num_epochs);
+
+  /// the weights are renamed over the save path once written
+  EXPECT_TRUE(std::ifstream(save_path).good());
+  EXPECT_FALSE(std::ifstream(save_path + ".tmp").good());
+  std::remove(save_path.c_str());
+
+  /// and handed over in memory to the models of the same config
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+  model->load(config, ml::train::ModelFormat::MODEL_FORMAT_INI);
+  ASSERT_EQ(model->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(model->initialize(), ML_ERROR_NONE);
+  auto &registry = nntrainer::WeightRegistry::Global();
+  auto key = nntrainer::WeightRegistry::resolveKey(config);
+  EXPECT_GT(registry.pull(key, *model), 0u);
+  registry.drop(key);
+}
@@ -260,6 +260,68 @@ TEST(nntrainer_cpi_dataset, add_file_null_handle_n) {
   EXPECT_EQ(status, ML_ERROR_INVALID_PARAMETER);
 }
 
+/**
+ * @brief Neural Network Add push Test (positive test)
+ */
+TEST(nntrainer_cpi_dataset, add_push_01_p) {
+  ml_train_dataset_h dataset;
+  int status = ml_train_dataset_create(&dataset);
+  EXPECT_EQ(status, ML_ERROR_NONE);
+
+  status = ml_train_dataset_add_push(dataset, ML_TRAIN_DATASET_MODE_TRAIN);
+  EXPECT_EQ(status, ML_ERROR_NONE);
+
+  status = ml_train_dataset_set_property_for_mode(
+    dataset, ML_TRAIN_DATASET_MODE_TRAIN, "backpressure=drop",
+    "epoch_samples=10", NULL);
+  EXPECT_EQ(status, ML_ERROR_NONE);
+
+  float input[2] = {1, 2};
+  float label[1] = {1};
+  const float *inputs[1] = {input};
+  const float *labels[1] = {label};
+
+  /// dropped as no epoch is running
+  status = ml_train_dataset_push(dataset, ML_TRAIN_DATASET_MODE_TRAIN, inputs,
+                                 1, labels, 1);
+  EXPECT_EQ(status, ML_ERROR_TRY_AGAIN);
+
+  status = ml_train_dataset_close_push(dataset, ML_TRAIN_DATASET_MODE_TRAIN);
+  EXPECT_EQ(status, ML_ERROR_NONE);
+
+  status = ml_train_dataset_destroy(dataset);
+  EXPECT_EQ(status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Neural Network push Test (negative test)
+ */
+TEST(nntrainer_cpi_dataset, push_without_push_source_n) {
+  ml_train_dataset_h dataset;
+  int status = ml_train_dataset_create(&dataset);
+  EXPECT_EQ(status, ML_ERROR_NONE);
+
+  status = ml_train_dataset_add_file(dataset, ML_TRAIN_DATASET_MODE_TRAIN,
+                                     getTestResPath("trainingSet.dat").c_str());
+  EXPECT_EQ(status, ML_ERROR_NONE);
+
+  float input[2] = {1, 2};
+  const float *inputs[1] = {input};
+  status = ml_train_dataset_push(dataset, ML_TRAIN_DATASET_MODE_TRAIN, inputs,
+                                 1, NULL, 0);
+  EXPECT_EQ(status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_train_dataset_push(dataset, ML_TRAIN_DATASET_MODE_VALID, inputs,
+                                 1, NULL, 0);
+  EXPECT_EQ(status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_train_dataset_close_push(dataset, ML_TRAIN_DATASET_MODE_TRAIN);
+  EXPECT_EQ(status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_train_dataset_destroy(dataset);
+  EXPECT_EQ(status, ML_ERROR_NONE);
+}
+
 /**
  * @brief Neural Network Dataset set Property Test (positive test )
  */
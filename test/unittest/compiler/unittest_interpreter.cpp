@@ -191,6 +191,66 @@ TEST(nntrainerInterpreterTflite, simple_fc) {
               << "failed, reason: " << strerror(errno);
   }
 }
+
+/**
+ * @brief every layer node property must be known to the tflite exporter,
+ * otherwise the export falls back to the generic, not supported path
+ */
+TEST(nntrainerInterpreterTflite, learning_rate_multiplier_p) {
+
+  nntrainer::TfliteInterpreter interpreter;
+
+  auto fc0_scaled = LayerRepresentation(
+    "fully_connected",
+    {"name=fc0", "unit=2", "input_shape=1:1:1", "bias_initializer=ones",
+     "weight_initializer=ones", "learning_rate_multiplier=0.5"});
+
+  auto g = makeGraph({fc0_scaled});
+
+  nntrainer::NetworkGraph ng;
+
+  for (auto &node : g) {
+    ng.addLayer(node);
+  }
+  EXPECT_EQ(ng.compile(""), ML_ERROR_NONE);
+  EXPECT_EQ(ng.initialize(), ML_ERROR_NONE);
+
+  ng.allocateTensors(nntrainer::ExecutionMode::INFERENCE);
+  EXPECT_NO_THROW(interpreter.serialize(g, "test_lr_multiplier.tflite"));
+  ng.deallocateTensors();
+
+  tflite::ops::builtin::BuiltinOpResolver resolver;
+  std::unique_ptr<tflite::Interpreter> tf_interpreter;
+  std::unique_ptr<tflite::FlatBufferModel> model =
+    tflite::FlatBufferModel::BuildFromFile("test_lr_multiplier.tflite");
+  ASSERT_NE(model, nullptr);
+  tflite::InterpreterBuilder(*model, resolver)(&tf_interpreter);
+  ASSERT_NE(tf_interpreter, nullptr);
+
+  EXPECT_EQ(tf_interpreter->AllocateTensors(), kTfLiteOk);
+
+  nntrainer::Tensor in(nntrainer::TensorDim({1, 1, 1, 1}));
+  in.setValue(2.0f);
+  nntrainer::Tensor out(nntrainer::TensorDim({1, 1, 1, 2}));
+
+  tf_interpreter->tensor(tf_interpreter->inputs()[0])->data.raw =
+    reinterpret_cast<char *>(in.getData());
+  tf_interpreter->tensor(tf_interpreter->outputs()[0])->data.raw =
+    reinterpret_cast<char *>(out.getData());
+
+  EXPECT_EQ(tf_interpreter->Invoke(), TfLiteStatus::kTfLiteOk);
+
+  nntrainer::Tensor ans(nntrainer::TensorDim({1, 1, 1, 2}));
+  ans.setValue(3.0f);
+
+  EXPECT_EQ(out, ans);
+
+  if (remove("test_lr_multiplier.tflite")) {
+    std::cerr << "remove ini "
+              << "test_lr_multiplier.tflite"
+              << "failed, reason: " << strerror(errno);
+  }
+}
 #endif
 /**
  * @brief make ini test case from given parameter
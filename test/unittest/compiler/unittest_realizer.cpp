@@ -16,6 +16,7 @@
 #include <activation_realizer.h>
 #include <connection.h>
 #include <flatten_realizer.h>
+#include <fusion_realizer.h>
 #include <input_realizer.h>
 #include <multiout_realizer.h>
 #include <previous_input_realizer.h>
@@ -764,3 +765,42 @@ TEST(ActivationRealizer, activation_unknown_n) {
 
   EXPECT_ANY_THROW(realizeAndEqual(ar, before, {}));
 }
+
+TEST(FusionRealizer, fusion_p) {
+  FusionRealizer fr;
+
+  std::vector<LayerRepresentation> before = {
+    {"fully_connected", {"name=a"}},
+    {"batch_normalization", {"name=b", "epsilon=0.01", "input_layers=a"}},
+    {"activation", {"name=c", "activation=relu", "input_layers=b"}},
+    {"fully_connected", {"name=d", "input_layers=c"}},
+    {"activation",
+     {"name=e", "activation=softmax", "input_layers=d"}}, /// output, kept
+  };
+
+  std::vector<LayerRepresentation> after = {
+    {"fully_connected",
+     {"name=a", "fused_batch_normalization=true", "epsilon=0.01",
+      "moving_mean_initializer=zeros", "moving_variance_initializer=ones",
+      "beta_initializer=zeros", "gamma_initializer=ones",
+      "fused_activation=relu"}},
+    {"fully_connected", {"name=d", "input_layers=a"}},
+    {"activation", {"name=e", "activation=softmax", "input_layers=d"}},
+  };
+
+  realizeAndEqual(fr, before, after);
+}
+
+TEST(FusionRealizer, fusion_shared_producer_p) {
+  FusionRealizer fr;
+
+  /// a has two consumers, nothing is fused
+  std::vector<LayerRepresentation> before = {
+    {"conv2d", {"name=a", "filters=2", "kernel_size=1,1"}},
+    {"batch_normalization", {"name=b", "input_layers=a"}},
+    {"activation", {"name=c", "activation=relu", "input_layers=a"}},
+    {"addition", {"name=d", "input_layers=b,c"}},
+  };
+
+  realizeAndEqual(fr, before, before);
+}
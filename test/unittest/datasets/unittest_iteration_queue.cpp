@@ -154,6 +154,29 @@ TEST_P(IterQueueScenarios, produceAndConsumeSingle_p) {
   EXPECT_FLOAT_EQ(sum_from_producer, sum_from_consumer);
 }
 
+TEST_P(IterQueueScenarios, notifyEmptiedWhenIterationIsGivenBack_p) {
+  unsigned int num_emptied = 0;
+  iq->setOnEmptied([&num_emptied] { num_emptied++; });
+
+  auto q_size_in_sample = iq->slots() * iq->batch();
+  for (unsigned int i = 0; i < q_size_in_sample; ++i) {
+    produceSample(i);
+  }
+  EXPECT_FALSE(iq->hasEmptySlot());
+  EXPECT_EQ(num_emptied, 0u);
+
+  consumeIteration();
+  EXPECT_EQ(num_emptied, 1u);
+  EXPECT_TRUE(iq->hasEmptySlot());
+
+  /// an unset callback is not called anymore
+  iq->setOnEmptied(nullptr);
+  if (iq->slots() > 1) {
+    consumeIteration();
+  }
+  EXPECT_EQ(num_emptied, 1u);
+}
+
 TEST_P(IterQueueScenarios, produceAndConsumeOnce_p) {
   auto q_size = iq->slots();
   auto q_size_in_sample = q_size * iq->batch();
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file unittest_push_data_producer.cpp
+ * @date 19 October 2026
+ * @brief push data producer test
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug No known bugs except for NYI items
+ */
+#include <gtest/gtest.h>
+
+#include <databuffer.h>
+#include <push_data_producer.h>
+#include <random_data_producers.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+/**
+ * @brief create a databuffer with a push data producer
+ *
+ * @param properties properties of the databuffer
+ * @return std::unique_ptr<nntrainer::DataBuffer> created databuffer
+ */
+static std::unique_ptr<nntrainer::DataBuffer>
+createPushBuffer(const std::vector<std::string> &properties) {
+  auto db = std::make_unique<nntrainer::DataBuffer>(
+    std::make_unique<nntrainer::PushDataProducer>());
+  db->setProperty(properties);
+  return db;
+}
+
+/**
+ * @brief push a sample filled with the given value
+ *
+ * @param db databuffer to push to
+ * @param value value of the input and label
+ * @return bool true if accepted
+ */
+static bool pushSample(nntrainer::DataBuffer &db, float value) {
+  float input[2] = {value, value};
+  float label[1] = {value};
+  return db.push({input}, {label});
+}
+
+TEST(PushDataProducer, setProperty_p) {
+  nntrainer::PushDataProducer prod;
+  EXPECT_NO_THROW(prod.setProperty(
+    {"backpressure=drop", "epoch_samples=3", "epoch_duration=10"}));
+}
+
+TEST(PushDataProducer, setPropertyInvalidBackpressure_n) {
+  nntrainer::PushDataProducer prod;
+  EXPECT_THROW(prod.setProperty({"backpressure=wait"}), std::invalid_argument);
+}
+
+TEST(PushDataProducer, fetchBySampleCount_p) {
+  auto db = createPushBuffer({"buffer_size=2", "epoch_samples=5"});
+  auto future_iq = db->startFetchWorker({{2, 1, 1, 2}}, {{2, 1, 1, 1}});
+
+  std::thread pusher([&db] {
+    for (unsigned int i = 0; i < 5; ++i) {
+      EXPECT_TRUE(pushSample(*db, i));
+    }
+  });
+
+  std::vector<unsigned int> batches;
+  float expected = 0;
+  while (true) {
+    auto iteration_view = db->fetch();
+    if (iteration_view.isEmpty()) {
+      break;
+    }
+
+    auto &iter = iteration_view.get();
+    batches.push_back(iter.batch());
+    for (unsigned int b = 0; b < iter.batch(); ++b, expected += 1) {
+      EXPECT_FLOAT_EQ(iter.getInputsRef()[0].getValue(b, 0, 0, 1), expected);
+      EXPECT_FLOAT_EQ(iter.getLabelsRef()[0].getValue(b, 0, 0, 0), expected);
+    }
+  }
+
+  pusher.join();
+  future_iq.get();
+  EXPECT_EQ(batches, std::vector<unsigned int>({2, 2, 1}));
+}
+
+TEST(PushDataProducer, fetchByDuration_p) {
+  auto db = createPushBuffer({"buffer_size=4", "epoch_duration=50"});
+  auto future_iq = db->startFetchWorker({{4, 1, 1, 2}}, {{4, 1, 1, 1}});
+
+  EXPECT_TRUE(pushSample(*db, 1));
+  {
+    auto iteration_view = db->fetch();
+    EXPECT_FALSE(iteration_view.isEmpty());
+    EXPECT_EQ(iteration_view.get().batch(), 1u);
+  }
+  EXPECT_TRUE(db->fetch().isEmpty());
+  future_iq.get();
+}
+
+TEST(PushDataProducer, dropWithoutEpoch_n) {
+  auto db = createPushBuffer({"buffer_size=2", "backpressure=drop"});
+  EXPECT_FALSE(pushSample(*db, 1));
+}
+
+TEST(PushDataProducer, dropWhenFull_n) {
+  auto db = createPushBuffer(
+    {"buffer_size=2", "backpressure=drop", "epoch_samples=6"});
+  auto future_iq = db->startFetchWorker({{2, 1, 1, 2}}, {{2, 1, 1, 1}});
+
+  /// wait for the epoch to start
+  while (!pushSample(*db, 0)) {
+    std::this_thread::yield();
+  }
+
+  /// the two iterations of the queue take four samples
+  for (unsigned int i = 1; i < 4; ++i) {
+    EXPECT_TRUE(pushSample(*db, i));
+  }
+  EXPECT_FALSE(pushSample(*db, 4));
+
+  db->closePush();
+  while (!db->fetch().isEmpty()) {
+  }
+  future_iq.get();
+}
+
+TEST(PushDataProducer, closeWhileWaiting_n) {
+  auto db = createPushBuffer({"buffer_size=2"});
+  std::thread pusher([&db] { EXPECT_FALSE(pushSample(*db, 1)); });
+
+  db->closePush();
+  pusher.join();
+  EXPECT_FALSE(pushSample(*db, 1));
+
+  /// a pusher waiting on a full queue is woken up as well
+  db = createPushBuffer({"buffer_size=2"});
+  auto future_iq = db->startFetchWorker({{2, 1, 1, 2}}, {{2, 1, 1, 1}});
+  for (unsigned int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(pushSample(*db, i));
+  }
+
+  std::thread full_pusher([&db] { EXPECT_FALSE(pushSample(*db, 4)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  db->closePush();
+  full_pusher.join();
+
+  unsigned int num_samples = 0;
+  while (true) {
+    auto iteration_view = db->fetch();
+    if (iteration_view.isEmpty()) {
+      break;
+    }
+    num_samples += iteration_view.get().batch();
+  }
+  future_iq.get();
+  EXPECT_EQ(num_samples, 4u);
+}
+
+TEST(PushDataProducer, pushToGenerator_n) {
+  nntrainer::DataBuffer db(
+    std::make_unique<nntrainer::RandomDataOneHotProducer>());
+  EXPECT_THROW(pushSample(db, 1), std::invalid_argument);
+  EXPECT_THROW(db.closePush(), std::invalid_argument);
+}
@@ -20,7 +20,10 @@
 #include <tuple>
 #include <vector>
 
+#include <layer_context.h>
 #include <layer_devel.h>
+#include <var_grad.h>
+#include <weight.h>
 
 typedef enum {
   AVAILABLE_FROM_APP_CONTEXT =
@@ -158,4 +161,85 @@ public:
   bool shouldSkipCalcGrad();
 };
 
+/**
+ * @brief layer finalized for the given input dimensions, with the tensors of
+ * its run context allocated to run the layer without a model
+ * @note in-place, the outputs share the memory of the inputs
+ */
+class StandaloneLayer {
+public:
+  /**
+   * @brief Construct a new Standalone Layer object
+   *
+   * @param layer_ layer to finalize, properties are already set
+   * @param input_dims dimensions of the inputs
+   * @param in_place true to run the layer in-place
+   */
+  StandaloneLayer(std::unique_ptr<nntrainer::Layer> &&layer_,
+                  const std::vector<nntrainer::TensorDim> &input_dims,
+                  bool in_place = false) :
+    layer(std::move(layer_)) {
+    nntrainer::InitLayerContext init_context(input_dims, {true}, in_place,
+                                             "standalone");
+    layer->finalize(init_context);
+
+    auto const &weight_specs = init_context.getWeightsSpec();
+    weights.reserve(weight_specs.size());
+    for (auto const &spec : weight_specs) {
+      weights.emplace_back(spec, true);
+      weights.back().getGradientRef().setZero();
+    }
+    inputs.reserve(input_dims.size());
+    for (auto const &dim : input_dims) {
+      inputs.emplace_back(dim, nntrainer::Tensor::Initializer::NONE, true,
+                          true, "input");
+    }
+    /// the outputs are batched as the inputs, as in a model
+    auto const &out_specs = init_context.getOutSpecs();
+    outputs.reserve(out_specs.size());
+    for (unsigned int i = 0; i < out_specs.size(); ++i) {
+      if (in_place) {
+        outputs.emplace_back(inputs[i].getVariableRef(),
+                             inputs[i].getGradientRef(), "output");
+        continue;
+      }
+      nntrainer::TensorDim dim = out_specs[i].variable_spec.dim;
+      dim.batch(input_dims[0].batch());
+      outputs.emplace_back(dim, nntrainer::Tensor::Initializer::NONE, true,
+                           true, "output");
+    }
+    auto const &tensor_specs = init_context.getTensorsSpec();
+    tensors.reserve(tensor_specs.size());
+    for (auto const &spec : tensor_specs) {
+      tensors.emplace_back(spec, true);
+    }
+
+    context = std::make_unique<nntrainer::RunLayerContext>(
+      "standalone", true, 0.0f, in_place, views(weights), views(inputs),
+      views(outputs), views(tensors));
+  }
+
+  std::unique_ptr<nntrainer::Layer> layer; /**< layer to run */
+  std::unique_ptr<nntrainer::RunLayerContext> context; /**< run context */
+
+private:
+  /**
+   * @brief get the pointers to the given tensors
+   *
+   * @param tensors weights or var_grads
+   * @return std::vector<T *> pointers to the tensors
+   */
+  template <typename T> static std::vector<T *> views(std::vector<T> &tensors) {
+    std::vector<T *> ret;
+    for (auto &t : tensors)
+      ret.push_back(&t);
+    return ret;
+  }
+
+  std::vector<nntrainer::Weight> weights;   /**< weights of the layer */
+  std::vector<nntrainer::Var_Grad> inputs;  /**< inputs of the layer */
+  std::vector<nntrainer::Var_Grad> outputs; /**< outputs of the layer */
+  std::vector<nntrainer::Var_Grad> tensors; /**< tensors of the layer */
+};
+
 #endif // __LAYERS_COMMON_TESTS_H__
@@ -9,6 +9,7 @@
  * @author Parichay Kapoor <pk.kapoor@samsung.com>
  * @bug No known bugs except for NYI items
  */
+#include <cmath>
 #include <tuple>
 
 #include <gtest/gtest.h>
@@ -36,9 +37,82 @@ auto semantic_activation_none = LayerSemanticsParamType(
   nntrainer::createLayer<nntrainer::ActivationLayer>,
   nntrainer::ActivationLayer::type, {"activation=none"}, 0, false, 1);
 
+auto semantic_activation_relu_mask = LayerSemanticsParamType(
+  nntrainer::createLayer<nntrainer::ActivationLayer>,
+  nntrainer::ActivationLayer::type,
+  {"activation=relu", "derivative_mask=true"}, 0, false, 1);
+
 INSTANTIATE_TEST_CASE_P(Activation, LayerSemantics,
                         ::testing::Values(semantic_activation_relu,
+                                          semantic_activation_relu_mask,
                                           semantic_activation_sigmoid,
                                           semantic_activation_softmax,
                                           semantic_activation_tanh,
                                           semantic_activation_none));
+
+/**
+ * @brief the derivative kept as a mask gives the derivative of the output, a
+ * bit per element exactly and in half precision approximately, in-place as well
+ */
+TEST(Activation, derivative_mask_p) {
+  const nntrainer::TensorDim dim(3, 1, 1, 48);
+
+  for (auto &[act, mask_len, tol] :
+       std::vector<std::tuple<std::string, unsigned int, float>>{
+         {"relu", 2, 1e-6f},
+         {"leaky_relu", 2, 1e-6f},
+         {"sigmoid", 24, 1e-3f},
+         {"tanh", 24, 1e-3f}}) {
+    auto create = [&act = act](bool mask) {
+      return nntrainer::createLayer<nntrainer::ActivationLayer>(
+        {"activation=" + act,
+         std::string("derivative_mask=") + (mask ? "true" : "false")});
+    };
+
+    StandaloneLayer reference(create(false), {dim});
+    auto &ref = *reference.context;
+    ref.getInput(0).setRandNormal();
+    ref.getOutputGradUnsafe(0).setRandNormal();
+    nntrainer::Tensor input = ref.getInput(0).clone();
+    reference.layer->forwarding(ref, true);
+    nntrainer::Tensor expected_out = ref.getOutput(0).clone();
+    reference.layer->calcDerivative(ref);
+    const nntrainer::Tensor &expected = ref.getOutgoingDerivative(0);
+
+    for (bool in_place : {false, true}) {
+      StandaloneLayer masked(create(true), {dim}, in_place);
+      auto &rc = *masked.context;
+      ASSERT_EQ(rc.getNumTensors(), 1u);
+      EXPECT_EQ(rc.getTensor(0).getDim(),
+                nntrainer::TensorDim(3, 1, 1, mask_len));
+
+      /// in-place, the incoming derivative is given after the forwarding
+      rc.getInput(0).copyData(input);
+      masked.layer->forwarding(rc, true);
+      const nntrainer::Tensor &out = rc.getOutput(0);
+      for (unsigned int i = 0; i < expected_out.size(); ++i)
+        EXPECT_FLOAT_EQ(out.getValue(i), expected_out.getValue(i));
+
+      rc.getOutputGradUnsafe(0).copyData(ref.getOutputGradUnsafe(0));
+      masked.layer->calcDerivative(rc);
+
+      const nntrainer::Tensor &result = rc.getOutgoingDerivative(0);
+      for (unsigned int i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(result.getValue(i), expected.getValue(i),
+                    tol * (1.0f + std::abs(expected.getValue(i))))
+          << act << (in_place ? " in-place" : "");
+      }
+    }
+  }
+}
+
+/**
+ * @brief softmax can not keep the derivative mask
+ */
+TEST(Activation, derivative_mask_n) {
+  auto layer = nntrainer::createLayer<nntrainer::ActivationLayer>(
+    {"activation=softmax", "derivative_mask=true"});
+  nntrainer::InitLayerContext init_context(
+    {nntrainer::TensorDim(3, 1, 1, 48)}, {true}, false, "act");
+  EXPECT_THROW(layer->finalize(init_context), std::invalid_argument);
+}
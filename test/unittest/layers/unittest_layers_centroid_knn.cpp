@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file unittest_layers_centroid_knn.cpp
+ * @date 19 October 2026
+ * @brief Centroid KNN Layer Test
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author agent <agent@local>
+ * @bug No known bugs except for NYI items
+ */
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include <centroid_knn.h>
+#include <layers_common_tests.h>
+
+auto semantic_centroid_knn = LayerSemanticsParamType(
+  nntrainer::createLayer<nntrainer::CentroidKNN>,
+  nntrainer::CentroidKNN::type, {"num_class=5"}, 0, false, 1);
+
+INSTANTIATE_TEST_CASE_P(CentroidKNN, LayerSemantics,
+                        ::testing::Values(semantic_centroid_knn));
+
+/**
+ * @brief centroid knn gives the distances to the centroids, which are updated
+ * with every sample of a batch before, and follow the map when it is replaced
+ */
+TEST(CentroidKNN, distance_p) {
+  const unsigned int batch = 6, feature_len = 8, num_class = 5;
+
+  StandaloneLayer knn(nntrainer::createLayer<nntrainer::CentroidKNN>(
+                        {"num_class=" + std::to_string(num_class)}),
+                      {nntrainer::TensorDim(batch, 1, 1, feature_len)});
+  auto &context = *knn.context;
+
+  /// naive incremental centroids, classes 1 and 3 stay empty at first
+  std::vector<std::vector<float>> centroids(
+    num_class, std::vector<float>(feature_len, 0.0f));
+  std::vector<unsigned int> seen(num_class, 0);
+  const std::vector<std::vector<unsigned int>> classes = {{0, 2, 0, 4, 2, 0},
+                                                          {1, 0, 3, 3, 2, 2}};
+
+  auto &input = context.getInput(0);
+  auto &label = context.getLabel(0);
+  auto &map = context.getWeight(0);
+  for (unsigned int step = 0; step <= classes.size() + 1; ++step) {
+    bool training = step < classes.size();
+    input.setRandNormal();
+    label.setZero();
+
+    for (unsigned int b = 0; training && b < batch; ++b) {
+      unsigned int c = classes[step][b];
+      label.setValue(b, 0, 0, c, 1.0f);
+      for (unsigned int f = 0; f < feature_len; ++f) {
+        centroids[c][f] =
+          (centroids[c][f] * seen[c] + input.getValue(b, 0, 0, f)) /
+          (seen[c] + 1);
+      }
+      seen[c]++;
+    }
+
+    /// the last step replaces the map as read() does, keeping the samples
+    if (step == classes.size() + 1) {
+      map.setRandNormal();
+      for (unsigned int c = 0; c < num_class; ++c)
+        for (unsigned int f = 0; f < feature_len; ++f)
+          centroids[c][f] = map.getValue(0, 0, c, f);
+      knn.layer->weightsLoaded(context);
+    }
+
+    knn.layer->forwarding(context, training);
+
+    auto &output = context.getOutput(0);
+    for (unsigned int b = 0; b < batch; ++b) {
+      for (unsigned int c = 0; c < num_class; ++c) {
+        float expected = std::numeric_limits<float>::min();
+        if (seen[c] != 0) {
+          float sum = 0.0f;
+          for (unsigned int f = 0; f < feature_len; ++f) {
+            float diff = input.getValue(b, 0, 0, f) - centroids[c][f];
+            sum += diff * diff;
+          }
+          expected = -std::sqrt(sum);
+        }
+        EXPECT_NEAR(output.getValue(b, 0, 0, c), expected, 1e-4)
+          << "step " << step << " batch " << b << " class " << c;
+      }
+    }
+  }
+}
@@ -139,6 +139,41 @@ auto conv1d_mb_1x1_kernel =
                            "3:2:1:5", "conv1d_mb_1x1_kernel.nnlayergolden",
                            LayerGoldenTestParamOptions::DEFAULT);
 
+auto conv1d_mb_same_uneven_remain_im2col = LayerGoldenTestParamType(
+  nntrainer::createLayer<nntrainer::Conv1DLayer>,
+  {
+    "filters=2",
+    "kernel_size=3",
+    "stride=2",
+    "padding=same",
+    "conv_algorithm=im2col",
+  },
+  "3:3:1:4", "conv1d_mb_same_uneven_remain.nnlayergolden",
+  LayerGoldenTestParamOptions::DEFAULT);
+
+auto conv1d_mb_valid_drop_last_im2col =
+  LayerGoldenTestParamType(nntrainer::createLayer<nntrainer::Conv1DLayer>,
+                           {
+                             "filters=2",
+                             "kernel_size=3",
+                             "stride=2",
+                             "padding=valid",
+                             "conv_algorithm=im2col",
+                           },
+                           "3:3:1:7", "conv1d_mb_valid_drop_last.nnlayergolden",
+                           LayerGoldenTestParamOptions::DEFAULT);
+
+auto conv1d_mb_no_overlap_im2col =
+  LayerGoldenTestParamType(nntrainer::createLayer<nntrainer::Conv1DLayer>,
+                           {
+                             "filters=3",
+                             "kernel_size=2",
+                             "stride=3",
+                             "conv_algorithm=im2col",
+                           },
+                           "3:2:1:5", "conv1d_mb_no_overlap.nnlayergolden",
+                           LayerGoldenTestParamOptions::DEFAULT);
+
 INSTANTIATE_TEST_CASE_P(
   Convolution1D, LayerGoldenTest,
   ::testing::Values(conv1d_sb_minimum, conv1d_mb_minimum, conv1d_sb_same_remain,
@@ -148,4 +183,105 @@ INSTANTIATE_TEST_CASE_P(
                     conv1d_mb_same_uneven_remain_2, conv1d_sb_valid_drop_last,
                     conv1d_mb_valid_drop_last, conv1d_sb_no_overlap,
                     conv1d_mb_no_overlap, conv1d_sb_1x1_kernel,
-                    conv1d_mb_1x1_kernel));
+                    conv1d_mb_1x1_kernel, conv1d_mb_same_uneven_remain_im2col,
+                    conv1d_mb_valid_drop_last_im2col,
+                    conv1d_mb_no_overlap_im2col));
+
+/**
+ * @brief dilated and strided convolutions give the output, the derivative and
+ * the gradient of a naive convolution
+ */
+TEST(Convolution1D, dilation_p) {
+  struct Conv1DCase {
+    std::vector<std::string> props;
+    unsigned int kernel, stride, dilation, pad;
+  };
+
+  std::vector<Conv1DCase> cases;
+  for (std::string algo : {"auto", "im2col", "direct"}) {
+    cases.push_back({{"filters=4", "kernel_size=3", "dilation=2",
+                      "padding=same", "conv_algorithm=" + algo},
+                     3, 1, 2, 2});
+    cases.push_back({{"filters=2", "kernel_size=5", "dilation=3", "stride=2",
+                      "padding=valid", "conv_algorithm=" + algo},
+                     5, 2, 3, 0});
+  }
+
+  for (auto &c : cases) {
+    StandaloneLayer conv(
+      nntrainer::createLayer<nntrainer::Conv1DLayer>(c.props),
+      {nntrainer::TensorDim(2, 3, 1, 20)});
+    auto &rc = *conv.context;
+    rc.getInput(0).setRandNormal();
+    rc.getOutputGradUnsafe(0).setRandNormal();
+    rc.getWeight(0).setRandNormal();
+
+    conv.layer->forwarding(rc, true);
+    conv.layer->calcGradient(rc);
+    conv.layer->calcDerivative(rc);
+
+    const nntrainer::Tensor &in = rc.getInput(0);
+    const nntrainer::Tensor &out = rc.getOutput(0);
+    const nntrainer::Tensor &filter = rc.getWeight(0);
+    const nntrainer::Tensor &deriv = rc.getIncomingDerivative(0);
+    ASSERT_EQ(out.width(),
+              (in.width() + 2 * c.pad - (c.kernel - 1) * c.dilation - 1) /
+                  c.stride +
+                1);
+
+    nntrainer::Tensor expected_out(out.getDim());
+    nntrainer::Tensor expected_in_deriv(in.getDim());
+    nntrainer::Tensor expected_grad(filter.getDim());
+    expected_out.setZero();
+    expected_in_deriv.setZero();
+    expected_grad.setZero();
+
+    for (unsigned int b = 0; b < in.batch(); ++b) {
+      for (unsigned int k = 0; k < out.channel(); ++k) {
+        for (unsigned int ow = 0; ow < out.width(); ++ow) {
+          float d = deriv.getValue(b, k, 0, ow);
+          for (unsigned int ch = 0; ch < in.channel(); ++ch) {
+            for (unsigned int kw = 0; kw < c.kernel; ++kw) {
+              int w = ow * c.stride + kw * c.dilation - c.pad;
+              if (w < 0 || w >= (int)in.width())
+                continue;
+
+              float x = in.getValue(b, ch, 0, w);
+              float wt = filter.getValue(k, ch, 0, kw);
+              expected_out.addValue(b, k, 0, ow, x * wt, 1.0f);
+              expected_in_deriv.addValue(b, ch, 0, w, d * wt, 1.0f);
+              expected_grad.addValue(k, ch, 0, kw, d * x, 1.0f);
+            }
+          }
+        }
+      }
+    }
+
+    /// bias is initialized to zero
+    auto check = [](const nntrainer::Tensor &result,
+                    const nntrainer::Tensor &expected) {
+      ASSERT_EQ(result.getDim(), expected.getDim());
+      for (unsigned int i = 0; i < expected.size(); ++i)
+        EXPECT_NEAR(result.getValue(i), expected.getValue(i), 1e-4);
+    };
+    check(out, expected_out);
+    check(rc.getOutgoingDerivative(0), expected_in_deriv);
+    check(rc.getWeightGrad(0), expected_grad);
+  }
+}
+
+/**
+ * @brief the dilated kernel must fit in the input, and winograd is not
+ * supported
+ */
+TEST(Convolution1D, dilation_n) {
+  /// the dilated kernel spans 1 + 9 * 3 = 28 > 20 columns
+  for (auto &props : std::vector<std::vector<std::string>>{
+         {"filters=2", "kernel_size=10", "dilation=3"},
+         {"filters=2", "kernel_size=3", "conv_algorithm=winograd"}}) {
+    auto conv = nntrainer::createLayer<nntrainer::Conv1DLayer>(props);
+    nntrainer::InitLayerContext init_context(
+      {nntrainer::TensorDim(2, 3, 1, 20)}, {true}, false, "conv");
+    EXPECT_THROW(conv->finalize(init_context), std::invalid_argument);
+  }
+}
@@ -139,6 +139,35 @@ auto conv2d_mb_1x1_kernel =
                            "3:2:5:5", "conv2d_mb_1x1_kernel.nnlayergolden",
                            LayerGoldenTestParamOptions::DEFAULT);
 
+auto conv2d_mb_same_remain_winograd = LayerGoldenTestParamType(
+  nntrainer::createLayer<nntrainer::Conv2DLayer>,
+  {"filters=2", "kernel_size=3,3", "padding=same", "conv_algorithm=winograd"},
+  "3:1:4:4", "conv2d_mb_same_remain.nnlayergolden",
+  LayerGoldenTestParamOptions::DEFAULT);
+
+auto conv2d_mb_same_uneven_remain_im2col = LayerGoldenTestParamType(
+  nntrainer::createLayer<nntrainer::Conv2DLayer>,
+  {
+    "filters=2",
+    "kernel_size=3,3",
+    "stride=2,2",
+    "padding=same",
+    "conv_algorithm=im2col",
+  },
+  "3:3:4:4", "conv2d_mb_same_uneven_remain.nnlayergolden",
+  LayerGoldenTestParamOptions::DEFAULT);
+
+auto conv2d_mb_1x1_kernel_im2col =
+  LayerGoldenTestParamType(nntrainer::createLayer<nntrainer::Conv2DLayer>,
+                           {
+                             "filters=3",
+                             "kernel_size=1,1",
+                             "stride=2,2",
+                             "conv_algorithm=im2col",
+                           },
+                           "3:2:5:5", "conv2d_mb_1x1_kernel.nnlayergolden",
+                           LayerGoldenTestParamOptions::DEFAULT);
+
 INSTANTIATE_TEST_CASE_P(
   Convolution2D, LayerGoldenTest,
   ::testing::Values(conv2d_sb_minimum, conv2d_mb_minimum, conv2d_sb_same_remain,
@@ -148,4 +177,196 @@ INSTANTIATE_TEST_CASE_P(
                     conv2d_mb_same_uneven_remain_2, conv2d_sb_valid_drop_last,
                     conv2d_mb_valid_drop_last, conv2d_sb_no_overlap,
                     conv2d_mb_no_overlap, conv2d_sb_1x1_kernel,
-                    conv2d_mb_1x1_kernel));
+                    conv2d_mb_1x1_kernel, conv2d_mb_same_remain_winograd,
+                    conv2d_mb_same_uneven_remain_im2col,
+                    conv2d_mb_1x1_kernel_im2col));
+
+/**
+ * @brief every algorithm gives the output, the derivative and the gradient of
+ * im2col for the same weights
+ */
+TEST(Convolution2D, algorithms_p) {
+  /// 3x3 convolutions with padding and pointwise convolutions
+  std::vector<std::pair<std::vector<std::string>, std::vector<std::string>>>
+    cases = {
+      {{"filters=8", "kernel_size=3,3", "padding=same"},
+       {"auto", "winograd", "direct"}},
+      {{"filters=4", "kernel_size=1,1"}, {"auto", "gemm", "direct"}},
+    };
+
+  for (auto &[props, algorithms] : cases) {
+    auto run = [&props = props](const std::string &algorithm,
+                                StandaloneLayer *reference) {
+      std::vector<std::string> layer_props = props;
+      layer_props.push_back("conv_algorithm=" + algorithm);
+      auto conv = std::make_unique<StandaloneLayer>(
+        nntrainer::createLayer<nntrainer::Conv2DLayer>(layer_props),
+        std::vector<nntrainer::TensorDim>{nntrainer::TensorDim(2, 8, 9, 7)});
+      auto &rc = *conv->context;
+      if (reference == nullptr) {
+        rc.getInput(0).setRandNormal();
+        rc.getOutputGradUnsafe(0).setRandNormal();
+        rc.getWeight(0).setRandNormal();
+      } else {
+        auto &ref = *reference->context;
+        rc.getInput(0).copyData(ref.getInput(0));
+        rc.getOutputGradUnsafe(0).copyData(ref.getOutputGradUnsafe(0));
+        for (unsigned int i = 0; i < rc.getNumWeights(); ++i)
+          rc.getWeight(i).copyData(ref.getWeight(i));
+      }
+
+      /// backwarded as in a model, the gradient before the derivative
+      conv->layer->forwarding(rc, true);
+      conv->layer->calcGradient(rc);
+      conv->layer->calcDerivative(rc);
+      return conv;
+    };
+
+    auto reference = run("im2col", nullptr);
+    auto &ref = *reference->context;
+    for (auto &algorithm : algorithms) {
+      auto conv = run(algorithm, reference.get());
+      auto &rc = *conv->context;
+
+      auto check = [&algorithm = algorithm](const nntrainer::Tensor &result,
+                                            const nntrainer::Tensor &expected) {
+        ASSERT_EQ(result.getDim(), expected.getDim());
+        for (unsigned int i = 0; i < expected.size(); ++i)
+          EXPECT_NEAR(result.getValue(i), expected.getValue(i), 1e-4)
+            << algorithm;
+      };
+      check(rc.getOutput(0), ref.getOutput(0));
+      check(rc.getOutgoingDerivative(0), ref.getOutgoingDerivative(0));
+      for (unsigned int i = 0; i < rc.getNumWeights(); ++i)
+        check(rc.getWeightGrad(i), ref.getWeightGrad(i));
+    }
+  }
+}
+
+/**
+ * @brief gemm is only for pointwise convolutions and winograd for 3x3 ones
+ */
+TEST(Convolution2D, algorithms_unsupported_n) {
+  for (auto &props : std::vector<std::vector<std::string>>{
+         {"filters=8", "kernel_size=3,3", "conv_algorithm=gemm"},
+         {"filters=4", "kernel_size=1,1", "conv_algorithm=winograd"}}) {
+    auto conv = nntrainer::createLayer<nntrainer::Conv2DLayer>(props);
+    nntrainer::InitLayerContext init_context(
+      {nntrainer::TensorDim(2, 8, 9, 7)}, {true}, false, "conv");
+    EXPECT_THROW(conv->finalize(init_context), std::invalid_argument);
+  }
+}
+
+/**
+ * @brief grouped and depthwise convolutions, with and without the im2col cache,
+ * give the output, the derivative and the gradient of a naive convolution
+ */
+TEST(Convolution2D, groups_p) {
+  struct GroupedConvCase {
+    std::vector<std::string> props;
+    unsigned int groups, kernel, stride, pad;
+  };
+
+  /// grouped, and depthwise with a channel multiplier of 2
+  std::vector<GroupedConvCase> cases;
+  for (std::string algo : {"auto", "im2col", "direct"}) {
+    cases.push_back({{"filters=6", "kernel_size=3,3", "groups=2",
+                      "padding=same", "conv_algorithm=" + algo},
+                     2, 3, 1, 1});
+    cases.push_back({{"filters=8", "kernel_size=3,3", "groups=4",
+                      "stride=2,2", "padding=1,1", "conv_algorithm=" + algo},
+                     4, 3, 2, 1});
+  }
+  /// the column matrices of forwarding are reused by calcGradient
+  cases.push_back({{"filters=5", "kernel_size=3,3", "padding=same",
+                    "conv_algorithm=im2col", "im2col_cache=true"},
+                   1, 3, 1, 1});
+  cases.push_back({{"filters=8", "kernel_size=3,3", "groups=4", "stride=2,2",
+                    "padding=1,1", "conv_algorithm=im2col",
+                    "im2col_cache=true"},
+                   4, 3, 2, 1});
+
+  for (auto &c : cases) {
+    StandaloneLayer conv(
+      nntrainer::createLayer<nntrainer::Conv2DLayer>(c.props),
+      {nntrainer::TensorDim(2, 4, 7, 6)});
+    auto &rc = *conv.context;
+    rc.getInput(0).setRandNormal();
+    rc.getOutputGradUnsafe(0).setRandNormal();
+    rc.getWeight(0).setRandNormal();
+
+    conv.layer->forwarding(rc, true);
+    conv.layer->calcGradient(rc);
+    conv.layer->calcDerivative(rc);
+
+    const nntrainer::Tensor &in = rc.getInput(0);
+    const nntrainer::Tensor &out = rc.getOutput(0);
+    const nntrainer::Tensor &filter = rc.getWeight(0);
+    const nntrainer::Tensor &deriv = rc.getIncomingDerivative(0);
+    ASSERT_EQ(filter.channel(), in.channel() / c.groups);
+
+    nntrainer::Tensor expected_out(out.getDim());
+    nntrainer::Tensor expected_in_deriv(in.getDim());
+    nntrainer::Tensor expected_grad(filter.getDim());
+    expected_out.setZero();
+    expected_in_deriv.setZero();
+    expected_grad.setZero();
+
+    unsigned int group_in = filter.channel();
+    unsigned int group_out = filter.batch() / c.groups;
+    for (unsigned int b = 0; b < in.batch(); ++b) {
+      for (unsigned int k = 0; k < out.channel(); ++k) {
+        for (unsigned int oh = 0; oh < out.height(); ++oh) {
+          for (unsigned int ow = 0; ow < out.width(); ++ow) {
+            float d = deriv.getValue(b, k, oh, ow);
+            for (unsigned int ch = 0; ch < group_in; ++ch) {
+              unsigned int ci = k / group_out * group_in + ch;
+              for (unsigned int kh = 0; kh < c.kernel; ++kh) {
+                for (unsigned int kw = 0; kw < c.kernel; ++kw) {
+                  int h = oh * c.stride + kh - c.pad;
+                  int w = ow * c.stride + kw - c.pad;
+                  if (h < 0 || w < 0 || h >= (int)in.height() ||
+                      w >= (int)in.width())
+                    continue;
+
+                  float x = in.getValue(b, ci, h, w);
+                  float wt = filter.getValue(k, ch, kh, kw);
+                  expected_out.addValue(b, k, oh, ow, x * wt, 1.0f);
+                  expected_in_deriv.addValue(b, ci, h, w, d * wt, 1.0f);
+                  expected_grad.addValue(k, ch, kh, kw, d * x, 1.0f);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /// bias is initialized to zero
+    auto check = [](const nntrainer::Tensor &result,
+                    const nntrainer::Tensor &expected) {
+      ASSERT_EQ(result.getDim(), expected.getDim());
+      for (unsigned int i = 0; i < expected.size(); ++i)
+        EXPECT_NEAR(result.getValue(i), expected.getValue(i), 1e-4);
+    };
+    check(out, expected_out);
+    check(rc.getOutgoingDerivative(0), expected_in_deriv);
+    check(rc.getWeightGrad(0), expected_grad);
+  }
+}
+
+/**
+ * @brief the input channels must be divisible by the groups, and winograd does
+ * not support groups
+ */
+TEST(Convolution2D, groups_n) {
+  for (auto &props : std::vector<std::vector<std::string>>{
+         {"filters=6", "kernel_size=3,3", "groups=3"},
+         {"filters=4", "kernel_size=3,3", "groups=2",
+          "conv_algorithm=winograd"}}) {
+    auto conv = nntrainer::createLayer<nntrainer::Conv2DLayer>(props);
+    nntrainer::InitLayerContext init_context(
+      {nntrainer::TensorDim(2, 4, 7, 6)}, {true}, false, "conv");
+    EXPECT_THROW(conv->finalize(init_context), std::invalid_argument);
+  }
+}
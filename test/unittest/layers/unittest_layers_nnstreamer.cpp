@@ -9,12 +9,15 @@
  * @author Parichay Kapoor <pk.kapoor@samsung.com>
  * @bug No known bugs except for NYI items
  */
+#include <chrono>
 #include <tuple>
 
 #include <gtest/gtest.h>
 
+#include <layer_context.h>
 #include <layers_common_tests.h>
 #include <nnstreamer_layer.h>
+#include <var_grad.h>
 
 auto semantic_nnstreamer = LayerSemanticsParamType(
   nntrainer::createLayer<nntrainer::NNStreamerLayer>,
@@ -23,3 +26,67 @@ auto semantic_nnstreamer = LayerSemanticsParamType(
 
 INSTANTIATE_TEST_CASE_P(NNStreamer, LayerSemantics,
                         ::testing::Values(semantic_nnstreamer));
+
+/**
+ * @brief layer of add.tflite, which adds 2 to a single value, with the
+ * contexts to run it
+ */
+class NNStreamerAddLayer {
+public:
+  /**
+   * @brief Construct and finalize the layer with its run context
+   */
+  NNStreamerAddLayer() :
+    in(nntrainer::TensorDim(1, 1, 1, 1), nntrainer::Tensor::Initializer::NONE,
+       false, true, "in"),
+    out(nntrainer::TensorDim(1, 1, 1, 1), nntrainer::Tensor::Initializer::NONE,
+        false, true, "out"),
+    context("nnstreamer", false, 0.0f, false, {}, {&in}, {&out}, {}) {
+    layer.setProperty({"model_path=../test/test_models/models/add.tflite"});
+    nntrainer::InitLayerContext init_context({in.getDim()}, {false}, false,
+                                             "nnstreamer");
+    layer.finalize(init_context);
+    EXPECT_EQ(init_context.getOutSpecs()[0].variable_spec.dim, out.getDim());
+  }
+
+  nntrainer::NNStreamerLayer layer;   /**< layer to run */
+  nntrainer::Var_Grad in;             /**< input of the layer */
+  nntrainer::Var_Grad out;            /**< output of the layer */
+  nntrainer::RunLayerContext context; /**< run context of the layer */
+};
+
+/**
+ * @brief each forwarding gives the output of its own input, although the
+ * output container of the backbone is reused
+ */
+TEST(NNStreamer, forwarding_p) {
+  NNStreamerAddLayer add;
+
+  for (float value : {1.0f, -3.5f, 0.25f}) {
+    add.context.getInput(0).setValue(value);
+    add.layer.forwarding(add.context, false);
+    EXPECT_FLOAT_EQ(add.context.getOutput(0).getValue(0), value + 2.0f);
+  }
+}
+
+/**
+ * @brief time a forwarding of the backbone. Run with
+ * --gtest_also_run_disabled_tests, the result is recorded as a property of
+ * the test in the gtest report, e.g. with --gtest_output=xml
+ */
+TEST(NNStreamer, DISABLED_forwarding_benchmark) {
+  constexpr unsigned int iterations = 1000;
+  NNStreamerAddLayer add;
+  add.context.getInput(0).setValue(1.0f);
+  add.layer.forwarding(add.context, false);
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iterations; ++i) {
+    add.layer.forwarding(add.context, false);
+  }
+  std::chrono::duration<double, std::micro> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  RecordProperty("nnstreamer_ns_per_forwarding",
+                 static_cast<int>(elapsed.count() * 1000 / iterations));
+}
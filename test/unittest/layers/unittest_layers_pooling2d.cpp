@@ -9,6 +9,8 @@
  * @author Parichay Kapoor <pk.kapoor@samsung.com>
  * @bug No known bugs except for NYI items
  */
+#include <algorithm>
+#include <limits>
 #include <tuple>
 
 #include <gtest/gtest.h>
@@ -39,3 +41,90 @@ INSTANTIATE_TEST_CASE_P(Pooling2DMax, LayerSemantics,
                                           semantic_pooling2d_avg,
                                           semantic_pooling2d_global_max,
                                           semantic_pooling2d_global_avg));
+
+/**
+ * @brief the specialized kernels, the generic ones with padding and the global
+ * pooling give the output and the derivative of a naive pooling
+ */
+TEST(Pooling2D, kernels_p) {
+  struct PoolingCase {
+    std::vector<std::string> props;
+    int pool, stride, pad;
+  };
+
+  std::vector<PoolingCase> cases = {
+    {{"pooling=max", "pool_size=2,2", "stride=2,2"}, 2, 2, 0},
+    {{"pooling=average", "pool_size=2,2", "stride=2,2"}, 2, 2, 0},
+    {{"pooling=max", "pool_size=3,3", "stride=2,2"}, 3, 2, 0},
+    {{"pooling=average", "pool_size=3,3", "stride=2,2"}, 3, 2, 0},
+    {{"pooling=max", "pool_size=3,3", "stride=2,2", "padding=1,1"}, 3, 2, 1},
+    {{"pooling=average", "pool_size=3,3", "stride=1,1", "padding=same"},
+     3,
+     1,
+     1},
+    {{"pooling=global_max"}, 24, 1, 0},
+    {{"pooling=global_average"}, 24, 1, 0},
+  };
+
+  for (auto &c : cases) {
+    StandaloneLayer pool(nntrainer::createLayer<nntrainer::Pooling2DLayer>(
+                           c.props),
+                         {nntrainer::TensorDim(4, 8, 24, 24)});
+    auto &rc = *pool.context;
+    const nntrainer::Tensor &in = rc.getInput(0);
+    const nntrainer::Tensor &out = rc.getOutput(0);
+    const nntrainer::Tensor &deriv = rc.getIncomingDerivative(0);
+    const nntrainer::Tensor &result = rc.getOutgoingDerivative(0);
+    rc.getInput(0).setRandNormal();
+    rc.getOutputGradUnsafe(0).setRandNormal();
+
+    pool.layer->forwarding(rc, true);
+    pool.layer->calcDerivative(rc);
+
+    bool is_max =
+      c.props[0] == "pooling=max" || c.props[0] == "pooling=global_max";
+    nntrainer::Tensor expected_result(in.getDim());
+    expected_result.setZero();
+    for (unsigned int b = 0; b < in.batch(); ++b) {
+      for (unsigned int ch = 0; ch < in.channel(); ++ch) {
+        for (unsigned int oh = 0; oh < out.height(); ++oh) {
+          for (unsigned int ow = 0; ow < out.width(); ++ow) {
+            int h0 = oh * c.stride - c.pad, w0 = ow * c.stride - c.pad;
+            int h_end = std::min(h0 + c.pool, (int)in.height());
+            int w_end = std::min(w0 + c.pool, (int)in.width());
+            float max_val = std::numeric_limits<float>::lowest();
+            float total = 0.0f;
+            int cnt = 0, max_h = 0, max_w = 0;
+            for (int h = std::max(h0, 0); h < h_end; ++h) {
+              for (int w = std::max(w0, 0); w < w_end; ++w) {
+                float val = in.getValue(b, ch, h, w);
+                if (max_val < val) {
+                  max_val = val;
+                  max_h = h;
+                  max_w = w;
+                }
+                total += val;
+                cnt++;
+              }
+            }
+
+            float d = deriv.getValue(b, ch, oh, ow);
+            if (is_max) {
+              EXPECT_FLOAT_EQ(out.getValue(b, ch, oh, ow), max_val);
+              expected_result.addValue(b, ch, max_h, max_w, d, 1.0f);
+              continue;
+            }
+
+            EXPECT_NEAR(out.getValue(b, ch, oh, ow), total / cnt, 1e-5);
+            for (int h = std::max(h0, 0); h < h_end; ++h)
+              for (int w = std::max(w0, 0); w < w_end; ++w)
+                expected_result.addValue(b, ch, h, w, d / cnt, 1.0f);
+          }
+        }
+      }
+    }
+
+    for (unsigned int i = 0; i < result.size(); ++i)
+      EXPECT_NEAR(result.getValue(i), expected_result.getValue(i), 1e-5);
+  }
+}
@@ -50,6 +50,28 @@ IniWrapper fc_relu_decay(
    IniSection("dense_1") + fc_base + "unit = 2" + "bias_decay=0.9",
    IniSection("act_1") + act_base + "Activation = sigmoid"});
 
+IniWrapper fc_sigmoid_mse_lr_multiplier(
+  "fc_sigmoid_mse_lr_multiplier",
+  {nn_base + "Loss=mse | batch_size = 3", sgd_base + "learning_rate = 4",
+   IniSection("input") + "type=input" + "input_shape = 1:1:3",
+   IniSection("dense") + fc_base + "unit = 5" +
+     "learning_rate_multiplier = 0.25",
+   IniSection("act") + act_base + "Activation = sigmoid",
+   IniSection("dense_1") + fc_base + "unit = 10" +
+     "learning_rate_multiplier = 0.5",
+   IniSection("act_1") + act_base + "Activation = softmax"});
+
+IniWrapper fc_sigmoid_mse_lr_step(
+  "fc_sigmoid_mse_lr_step",
+  {nn_base + "Loss=mse | batch_size = 3",
+   sgd_base + "learning_rate = 1" + "learning_rate_scheduler = step" +
+     "decay_rate = 0.5" + "decay_steps = 4",
+   IniSection("input") + "type=input" + "input_shape = 1:1:3",
+   IniSection("dense") + fc_base + "unit = 5",
+   IniSection("act") + act_base + "Activation = sigmoid",
+   IniSection("dense_1") + fc_base + "unit = 10",
+   IniSection("act_1") + act_base + "Activation = softmax"});
+
 static std::unique_ptr<NeuralNetwork> makeMolAttention() {
   std::unique_ptr<NeuralNetwork> nn(new NeuralNetwork());
   nn->setProperty({"batch_size=3"});
@@ -108,6 +130,12 @@ INSTANTIATE_TEST_CASE_P(
                  ModelTestOption::COMPARE_RUN_V2),
     mkModelIniTc(fc_relu_decay, DIM_UNUSED, NOT_USED_,
                  ModelTestOption::COMPARE_V2),
+    /// @todo compare with ALL_V2 once the goldens recorded by
+    /// genModelTests_v2.py are added to unittest_models_v2.tar.gz
+    mkModelIniTc(fc_sigmoid_mse_lr_multiplier, DIM_UNUSED, NOT_USED_,
+                 ModelTestOption::NO_THROW_RUN_V2),
+    mkModelIniTc(fc_sigmoid_mse_lr_step, DIM_UNUSED, NOT_USED_,
+                 ModelTestOption::NO_THROW_RUN_V2),
   }),
   [](const testing::TestParamInfo<nntrainerModelTest::ParamType> &info) {
     return std::get<1>(info.param);
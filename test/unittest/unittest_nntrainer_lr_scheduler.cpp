@@ -17,10 +17,39 @@
 #include <lr_scheduler.h>
 #include <lr_scheduler_constant.h>
 #include <lr_scheduler_exponential.h>
+#include <lr_scheduler_step.h>
+#include <neuralnet.h>
 #include <nntrainer_error.h>
+#include <optimizer_devel.h>
 
 #include "nntrainer_test_util.h"
 
+/**
+ * @brief create a learning rate scheduler from the app context
+ *
+ * @param type type of the scheduler
+ * @return std::unique_ptr<nntrainer::LearningRateScheduler> created scheduler
+ */
+static std::unique_ptr<nntrainer::LearningRateScheduler>
+createLRS(const std::string &type) {
+  auto &ac = nntrainer::AppContext::Global();
+  return ac.createObject<nntrainer::LearningRateScheduler>(type);
+}
+
+/**
+ * @brief create an optimizer from the app context
+ *
+ * @param type type of the optimizer
+ * @return std::unique_ptr<nntrainer::Optimizer> created optimizer
+ */
+static std::unique_ptr<nntrainer::Optimizer>
+createOptimizer(const std::string &type) {
+  auto &ac = nntrainer::AppContext::Global();
+  return std::unique_ptr<nntrainer::Optimizer>(
+    static_cast<nntrainer::Optimizer *>(
+      ac.createObject<ml::train::Optimizer>(type).release()));
+}
+
 /**
  * @brief test constructing lr scheduler
  *
@@ -147,6 +176,174 @@ TEST(lr_exponential, prop_02_p) {
   EXPECT_FLOAT_EQ(lr->getLearningRate(3), 1.0 * std::pow(0.9f, 3));
 }
 
+/**
+ * @brief test warmup of the learning rate
+ *
+ */
+TEST(lr_constant, warmup_01_p) {
+  auto lr = createLRS("constant");
+
+  EXPECT_NO_THROW(lr->setProperty({"learning_rate=1.0", "warmup_steps=4"}));
+  EXPECT_NO_THROW(lr->finalize());
+
+  EXPECT_FLOAT_EQ(lr->getLearningRate(0), 0.25f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(2), 0.75f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(3), 1.0f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(100), 1.0f);
+}
+
+/**
+ * @brief test warmup followed by the exponential decay
+ *
+ */
+TEST(lr_exponential, warmup_01_p) {
+  auto lr = createLRS("exponential");
+
+  EXPECT_NO_THROW(lr->setProperty({"learning_rate=1.0", "warmup_steps=2",
+                                   "decay_rate=0.9", "decay_steps=1"}));
+  EXPECT_NO_THROW(lr->finalize());
+
+  EXPECT_FLOAT_EQ(lr->getLearningRate(0), 0.5f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(2), 1.0f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(4), 1.0 * std::pow(0.9f, 2));
+}
+
+/**
+ * @brief test set and get learning rate
+ *
+ */
+TEST(lr_step, prop_01_n) {
+  auto lr = createLRS("step");
+
+  EXPECT_NO_THROW(lr->setProperty({"learning_rate=1.0", "decay_steps=2"}));
+  EXPECT_ANY_THROW(lr->finalize());
+  EXPECT_ANY_THROW(lr->setProperty({"decay_steps=0"}));
+  EXPECT_ANY_THROW(lr->setProperty({"min_learning_rate=0.1"}));
+}
+
+/**
+ * @brief test set and get learning rate
+ *
+ */
+TEST(lr_step, prop_02_p) {
+  auto lr = createLRS("step");
+
+  EXPECT_NO_THROW(lr->setProperty(
+    {"learning_rate=1.0", "decay_rate=0.5", "decay_steps=3"}));
+  EXPECT_NO_THROW(lr->finalize());
+
+  EXPECT_FLOAT_EQ(lr->getLearningRate(0), 1.0f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(2), 1.0f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(3), 0.5f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(8), 0.25f);
+}
+
+/**
+ * @brief test set and get learning rate
+ *
+ */
+TEST(lr_cosine, prop_01_n) {
+  auto lr = createLRS("cosine");
+
+  EXPECT_NO_THROW(lr->setProperty({"learning_rate=1.0"}));
+  EXPECT_ANY_THROW(lr->finalize());
+  EXPECT_ANY_THROW(lr->setProperty({"min_learning_rate=-0.1"}));
+  EXPECT_ANY_THROW(lr->setProperty({"decay_rate=0.9"}));
+}
+
+/**
+ * @brief test set and get learning rate
+ *
+ */
+TEST(lr_cosine, prop_02_p) {
+  auto lr = createLRS("cosine");
+
+  EXPECT_NO_THROW(lr->setProperty({"learning_rate=1.0", "decay_steps=4",
+                                   "min_learning_rate=0.2", "warmup_steps=2"}));
+  EXPECT_NO_THROW(lr->finalize());
+
+  EXPECT_FLOAT_EQ(lr->getLearningRate(0), 0.5f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(2), 1.0f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(4), 0.6f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(6), 0.2f);
+  EXPECT_FLOAT_EQ(lr->getLearningRate(100), 0.2f);
+}
+
+/**
+ * @brief test the learning rate of an optimizer given by its scheduler
+ *
+ */
+TEST(lr_optimizer, scheduler_01_p) {
+  auto opt = createOptimizer("sgd");
+
+  EXPECT_NO_THROW(opt->setProperty({"learning_rate=1.0"}));
+  EXPECT_NO_THROW(opt->setProperty(
+    {"learning_rate_scheduler=step", "decay_rate=0.5", "decay_steps=2"}));
+  EXPECT_NO_THROW(opt->finalize());
+
+  EXPECT_FLOAT_EQ(opt->getLearningRate(1), 1.0f);
+  EXPECT_FLOAT_EQ(opt->getLearningRate(2), 0.5f);
+
+  /** the learning rate set before the scheduler is kept by the scheduler */
+  EXPECT_NO_THROW(opt->setProperty({"learning_rate=2.0"}));
+  EXPECT_FLOAT_EQ(opt->getLearningRate(2), 1.0f);
+}
+
+/**
+ * @brief test the learning rate of an optimizer given by its scheduler
+ *
+ */
+TEST(lr_optimizer, scheduler_02_n) {
+  auto opt = createOptimizer("sgd");
+
+  EXPECT_ANY_THROW(opt->setProperty({"learning_rate_scheduler=unknown"}));
+
+  opt = createOptimizer("sgd");
+  EXPECT_NO_THROW(
+    opt->setProperty({"learning_rate=1.0", "learning_rate_scheduler=cosine"}));
+  EXPECT_ANY_THROW(opt->finalize());
+
+  opt = createOptimizer("sgd");
+  EXPECT_ANY_THROW(opt->setProperty(
+    {"learning_rate_scheduler=constant", "learning_rate=1.0",
+     "decay_steps=2"}));
+}
+
+/**
+ * @brief test the learning rate scheduler of an optimizer created from the
+ * context of the model the optimizer is set to
+ *
+ */
+TEST(lr_optimizer, scheduler_03_p) {
+  nntrainer::AppContext ac(nntrainer::AppContext::Global());
+  ac.registerFactory(nntrainer::createLearningRateScheduler<
+                       nntrainer::StepLearningRateScheduler>,
+                     "model_step");
+
+  /** not registered to the global context */
+  std::shared_ptr<nntrainer::Optimizer> opt = createOptimizer("sgd");
+  EXPECT_ANY_THROW(opt->setProperty({"learning_rate_scheduler=model_step"}));
+
+  nntrainer::NeuralNetwork model(ac);
+  opt = createOptimizer("sgd");
+  EXPECT_EQ(model.setOptimizer(opt), ML_ERROR_NONE);
+  EXPECT_NO_THROW(
+    opt->setProperty({"learning_rate=1.0", "learning_rate_scheduler=model_step",
+                      "decay_rate=0.5", "decay_steps=2"}));
+  EXPECT_NO_THROW(opt->finalize());
+  EXPECT_FLOAT_EQ(opt->getLearningRate(2), 0.5f);
+
+  /** the scheduler set before is created again with its properties */
+  nntrainer::NeuralNetwork other(ac);
+  opt = createOptimizer("sgd");
+  EXPECT_NO_THROW(
+    opt->setProperty({"learning_rate=1.0", "learning_rate_scheduler=step",
+                      "decay_rate=0.5", "decay_steps=2"}));
+  EXPECT_EQ(other.setOptimizer(opt), ML_ERROR_NONE);
+  EXPECT_NO_THROW(opt->finalize());
+  EXPECT_FLOAT_EQ(opt->getLearningRate(2), 0.5f);
+}
+
 int main(int argc, char **argv) {
   int result = -1;
 
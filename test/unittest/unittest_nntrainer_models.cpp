@@ -11,18 +11,28 @@
  *
  */
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include <data_producer.h>
+#include <databuffer.h>
 #include <input_layer.h>
 #include <layer.h>
 #include <neuralnet.h>
+#include <optimizer.h>
+#include <training_callbacks.h>
 
 #include <models_golden_test.h>
+#include <nntrainer_test_util.h>
 
 static nntrainer::IniSection nn_base("model", "type = NeuralNetwork");
 static std::string input_base = "type = input";
@@ -1113,6 +1123,677 @@ TEST(nntrainerModels, loadFromLayersRecurrent_p) {
   };
 }
 
+/**
+ * @brief make a conv2d / fully connected model followed by batch
+ * normalization and activation to check the inference fusion
+ *
+ * @param fusion true to enable the inference fusion
+ */
+static std::unique_ptr<nntrainer::NeuralNetwork> makeFusionModel(bool fusion) {
+  auto nn = std::make_unique<nntrainer::NeuralNetwork>();
+  const std::string bn_init = "moving_mean_initializer=lecun_normal|"
+                              "gamma_initializer=he_uniform|"
+                              "beta_initializer=lecun_uniform";
+
+  auto graph = makeGraph({
+    {"input", {"name=in", "input_shape=2:5:5"}},
+    {"conv2d", {"name=conv", "filters=4", "kernel_size=3,3", "padding=same"}},
+    {"batch_normalization", {"name=conv_bn", bn_init}},
+    {"activation", {"name=conv_act", "activation=relu"}},
+    {"flatten", {"name=flatten"}},
+    {"fully_connected", {"name=fc", "unit=6", "disable_bias=true"}},
+    {"batch_normalization", {"name=fc_bn", bn_init}},
+    {"activation", {"name=fc_act", "activation=sigmoid"}},
+    {"fully_connected", {"name=out", "unit=3"}},
+  });
+  for (auto &node : graph) {
+    nn->addLayer(node);
+  }
+
+  nn->setProperty({"loss=mse", "batch_size=3",
+                   std::string("inference_fusion=") + (fusion ? "true" : "false")});
+  return nn;
+}
+
+TEST(nntrainerModels, inference_fusion_p) {
+  const std::string model_file = "inference_fusion.bin";
+
+  auto reference = makeFusionModel(false);
+  ASSERT_EQ(reference->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(reference->initialize(), ML_ERROR_NONE);
+  reference->save(model_file);
+
+  auto fused = makeFusionModel(true);
+  ASSERT_EQ(fused->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(fused->initialize(), ML_ERROR_NONE);
+  fused->load(model_file);
+  /// batch normalization and the hidden activations are absorbed
+  EXPECT_EQ(fused->getFlatGraph().size(),
+            reference->getFlatGraph().size() - 4);
+
+  auto input = MAKE_SHARED_TENSOR(nntrainer::TensorDim(3, 2, 5, 5));
+  input->setRandNormal();
+
+  nntrainer::Tensor expected = *reference->inference({input}, false)[0];
+  /// run twice to check that the weights are folded only once
+  for (int i = 0; i < 2; ++i) {
+    auto out = fused->inference({input}, false)[0];
+    ASSERT_EQ(out->getDim(), expected.getDim());
+    for (unsigned int j = 0; j < expected.size(); ++j)
+      EXPECT_NEAR(out->getValue(j), expected.getValue(j), 1e-5);
+  }
+
+  /// the fused model cannot be trained
+  fused->setOptimizer(ml::train::optimizer::SGD({"learning_rate=0.1"}));
+  EXPECT_EQ(fused->train(), ML_ERROR_INVALID_PARAMETER);
+  std::remove(model_file.c_str());
+}
+
+/**
+ * @brief stream inference writes the same outputs as the inference into the
+ * given memory, across changes of the batch size
+ */
+TEST(nntrainerModels, stream_inference_p) {
+  auto nn = makeFusionModel(false);
+  ASSERT_EQ(nn->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(nn->initialize(), ML_ERROR_NONE);
+
+  for (unsigned int batch : {3u, 3u, 1u, 2u}) {
+    nntrainer::Tensor input(nntrainer::TensorDim(batch, 2, 5, 5));
+    input.setRandNormal();
+    std::vector<float> output(batch * 3, 0.0f);
+
+    nn->streamInference(batch, {input.getData()}, {output.data()});
+    auto expected = nn->inference(batch, {input.getData()}, {});
+    ASSERT_EQ(expected.size(), 1u);
+    for (unsigned int i = 0; i < output.size(); ++i)
+      EXPECT_NEAR(output[i], expected[0][i], 1e-5) << "batch " << batch;
+  }
+}
+
+/**
+ * @brief make a model which splits and concatenates along the channel, which
+ * is laid out contiguously with the batch size of 1
+ *
+ * @param optimize true to enable the memory optimization
+ */
+static std::unique_ptr<nntrainer::NeuralNetwork>
+makeSplitConcatModel(bool optimize) {
+  auto nn = std::make_unique<nntrainer::NeuralNetwork>();
+
+  auto graph = makeGraph({
+    {"input", {"name=in", "input_shape=2:3:3"}},
+    {"conv2d", {"name=conv", "filters=2", "kernel_size=1,1"}},
+    {"split", {"name=split", "axis=1"}},
+    {"conv2d",
+     {"name=a0", "input_layers=split(0)", "filters=1", "kernel_size=1,1"}},
+    {"conv2d",
+     {"name=a1", "input_layers=split(1)", "filters=1", "kernel_size=1,1"}},
+    {"concat", {"name=concat", "input_layers=a0,a1", "axis=1"}},
+    {"flatten", {"name=flatten"}},
+    {"fully_connected", {"name=out", "unit=2"}},
+  });
+  for (auto &node : graph) {
+    nn->addLayer(node);
+  }
+
+  nn->setProperty({"loss=mse", "batch_size=1",
+                   std::string("memory_optimization=") +
+                     (optimize ? "true" : "false")});
+  nn->setOptimizer(ml::train::optimizer::SGD({"learning_rate=0.1"}));
+  return nn;
+}
+
+TEST(nntrainerModels, zero_copy_split_concat_p) {
+  const std::string model_file = "zero_copy_split_concat.bin";
+
+  auto reference = makeSplitConcatModel(false);
+  ASSERT_EQ(reference->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(reference->initialize(), ML_ERROR_NONE);
+  reference->save(model_file);
+
+  auto optimized = makeSplitConcatModel(true);
+  ASSERT_EQ(optimized->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(optimized->initialize(), ML_ERROR_NONE);
+  optimized->load(model_file);
+  std::remove(model_file.c_str());
+
+  ASSERT_EQ(reference->allocate(), ML_ERROR_NONE);
+  ASSERT_EQ(optimized->allocate(), ML_ERROR_NONE);
+
+  /// inputs of concat and outputs of split are placed, not copied
+  for (auto &node : optimized->getFlatGraph()) {
+    auto &rc = node->getRunContext();
+    if (node->getType() == "concat") {
+      EXPECT_EQ(rc.getInput(0).getData(), rc.getOutput(0).getData());
+      EXPECT_EQ(rc.getInput(1).getData(), rc.getOutput(0).getData() + 9);
+      EXPECT_EQ(rc.getInputGrad(1).getData(),
+                rc.getOutputGradUnsafe(0).getData() + 9);
+    } else if (node->getType() == "split") {
+      EXPECT_EQ(rc.getOutput(1).getData(), rc.getInput(0).getData() + 9);
+    }
+  }
+
+  auto input = MAKE_SHARED_TENSOR(nntrainer::TensorDim(1, 2, 3, 3));
+  auto label = MAKE_SHARED_TENSOR(nntrainer::TensorDim(1, 1, 1, 2));
+  input->setRandNormal();
+  label->setRandNormal();
+
+  /// train a step and check the result of the inference
+  for (auto &nn : {reference.get(), optimized.get()}) {
+    nn->forwarding({input}, {label});
+    nn->backwarding(0);
+  }
+
+  nntrainer::Tensor expected = *reference->inference({input}, false)[0];
+  auto out = optimized->inference({input}, false)[0];
+  ASSERT_EQ(out->getDim(), expected.getDim());
+  for (unsigned int j = 0; j < expected.size(); ++j)
+    EXPECT_FLOAT_EQ(out->getValue(j), expected.getValue(j));
+}
+
+/**
+ * @brief time a training step of a convolution with and without the im2col
+ * cache, and the memory of its tensors. Run with
+ * --gtest_also_run_disabled_tests, the results are recorded as properties of
+ * the test in the gtest report, e.g. with --gtest_output=xml
+ */
+TEST(nntrainerModels, DISABLED_conv2d_im2col_cache_benchmark) {
+  constexpr unsigned int batch = 16, iterations = 20;
+
+  for (std::string cache : {"false", "true"}) {
+    auto nn = std::make_unique<nntrainer::NeuralNetwork>();
+    auto graph = makeGraph({
+      {"input", {"name=in", "input_shape=16:32:32"}},
+      {"conv2d",
+       {"name=conv", "filters=32", "kernel_size=3,3", "padding=same",
+        "conv_algorithm=im2col", "im2col_cache=" + cache}},
+      {"flatten", {"name=flatten"}},
+      {"fully_connected", {"name=out", "unit=10"}},
+    });
+    for (auto &node : graph) {
+      nn->addLayer(node);
+    }
+    nn->setProperty({"loss=mse", "batch_size=" + std::to_string(batch)});
+    nn->setOptimizer(ml::train::optimizer::SGD({"learning_rate=0.01"}));
+    ASSERT_EQ(nn->compile(), ML_ERROR_NONE);
+    ASSERT_EQ(nn->initialize(), ML_ERROR_NONE);
+    ASSERT_EQ(nn->allocate(), ML_ERROR_NONE);
+
+    auto input = MAKE_SHARED_TENSOR(nntrainer::TensorDim(batch, 16, 32, 32));
+    auto label = MAKE_SHARED_TENSOR(nntrainer::TensorDim(batch, 1, 1, 10));
+    input->setRandNormal();
+    label->setRandNormal();
+
+    std::shared_ptr<nntrainer::LayerNode> conv;
+    for (auto &node : nn->getFlatGraph()) {
+      if (node->getName() == "conv")
+        conv = node;
+    }
+    ASSERT_NE(conv, nullptr);
+
+    auto &rc = conv->getRunContext();
+    size_t bytes = 0;
+    for (unsigned int i = 0; i < rc.getNumTensors(); ++i)
+      bytes += rc.getTensor(i).bytes();
+
+    nn->forwarding({input}, {label});
+    nn->backwarding(0);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; ++i) {
+      nn->forwarding({input}, {label});
+      nn->backwarding(i + 1);
+    }
+    std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    RecordProperty("im2col_cache_" + cache + "_us_per_iteration",
+                   static_cast<int>(elapsed.count() * 1000 / iterations));
+    RecordProperty("im2col_cache_" + cache + "_tensor_bytes",
+                   static_cast<int>(bytes));
+  }
+}
+
+/**
+ * @brief make a model which fine-tunes a head on a frozen backbone, with a
+ * side branch which does not lead to the loss. The weights are initialized
+ * alike for every model
+ *
+ * @param optimize true to enable the memory optimization
+ */
+static std::unique_ptr<nntrainer::NeuralNetwork>
+makeFineTuneModel(bool optimize) {
+  auto nn = std::make_unique<nntrainer::NeuralNetwork>();
+
+  auto graph = makeGraph({
+    {"input", {"name=in", "input_shape=1:1:12"}},
+    {"fully_connected",
+     {"name=fc0", "unit=10", "trainable=false", "weight_initializer=ones"}},
+    {"activation", {"name=act0", "activation=relu"}},
+    {"fully_connected",
+     {"name=fc1", "unit=10", "trainable=false", "weight_initializer=ones"}},
+    {"fully_connected",
+     {"name=head", "unit=3", "input_layers=fc1", "weight_initializer=ones"}},
+    {"mse", {"name=loss", "input_layers=head"}},
+    {"fully_connected",
+     {"name=side", "unit=4", "input_layers=fc1", "weight_initializer=ones"}},
+  });
+  for (auto &node : graph) {
+    nn->addLayer(node);
+  }
+
+  nn->setProperty({"batch_size=3", std::string("memory_optimization=") +
+                                      (optimize ? "true" : "false")});
+  nn->setOptimizer(ml::train::optimizer::SGD({"learning_rate=0.1"}));
+  return nn;
+}
+
+TEST(nntrainerModels, trainable_subgraph_pruning_p) {
+  auto getNode = [](nntrainer::NeuralNetwork &nn, const std::string &name) {
+    std::shared_ptr<nntrainer::LayerNode> found;
+    for (auto &node : nn.getFlatGraph()) {
+      if (node->getName() == name)
+        found = node;
+    }
+    return found;
+  };
+
+  auto reference = makeFineTuneModel(false);
+  ASSERT_EQ(reference->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(reference->initialize(), ML_ERROR_NONE);
+  ASSERT_EQ(reference->allocate(), ML_ERROR_NONE);
+
+  auto nn = makeFineTuneModel(true);
+  ASSERT_EQ(nn->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(nn->initialize(), ML_ERROR_NONE);
+  ASSERT_EQ(nn->allocate(), ML_ERROR_NONE);
+
+  /// only the head is trained, and nothing before it gets a derivative
+  for (auto &node : nn->getFlatGraph()) {
+    if (node->getName() == "loss")
+      continue;
+
+    EXPECT_EQ(node->needsCalcGradient(), node->getName() == "head")
+      << node->getName();
+    EXPECT_FALSE(node->needsCalcDerivative()) << node->getName();
+    auto &rc = node->getRunContext();
+    for (unsigned int i = 0; i < rc.getNumWeights(); ++i)
+      EXPECT_EQ(rc.weightHasGradient(i), node->getName() == "head")
+        << node->getName();
+  }
+
+  auto input = MAKE_SHARED_TENSOR(nntrainer::TensorDim(3, 1, 1, 12));
+  auto label = MAKE_SHARED_TENSOR(nntrainer::TensorDim(3, 1, 1, 3));
+  input->setRandNormal();
+  label->setRandNormal();
+
+  nntrainer::Tensor side_weight =
+    getNode(*nn, "side")->getRunContext().getWeight(0).clone();
+  nntrainer::Tensor head_weight =
+    getNode(*nn, "head")->getRunContext().getWeight(0).clone();
+  for (auto *model : {reference.get(), nn.get()}) {
+    model->forwarding({input}, {label});
+    model->backwarding(0);
+  }
+
+  /// the inputs are set now, the derivatives are not allocated for them
+  for (auto &node : nn->getFlatGraph()) {
+    auto &rc = node->getRunContext();
+    for (unsigned int i = 0; node->getName() != "loss" && i < rc.getNumInputs();
+         ++i)
+      EXPECT_FALSE(rc.inputHasGradient(i)) << node->getName();
+  }
+
+  /// the side branch is not trained, the head is trained as usual
+  EXPECT_EQ(getNode(*nn, "side")->getRunContext().getWeight(0), side_weight);
+  const nntrainer::Tensor &expected =
+    getNode(*reference, "head")->getRunContext().getWeight(0);
+  const nntrainer::Tensor &result =
+    getNode(*nn, "head")->getRunContext().getWeight(0);
+  EXPECT_NE(result, head_weight);
+  ASSERT_EQ(result.getDim(), expected.getDim());
+  for (unsigned int i = 0; i < expected.size(); ++i)
+    EXPECT_FLOAT_EQ(result.getValue(i), expected.getValue(i));
+}
+
+/**
+ * @brief data producer which gives the same sample for the same index
+ */
+class IndexedDataProducer final : public nntrainer::DataProducer {
+public:
+  /**
+   * @brief Construct a new Indexed Data Producer object
+   *
+   * @param num_samples number of samples
+   */
+  IndexedDataProducer(unsigned int num_samples) : num_samples(num_samples) {}
+
+  /**
+   * @copydoc DataProducer::getType()
+   */
+  const std::string getType() const override { return "indexed"; }
+
+  /**
+   * @copydoc DataProducer::finalize()
+   */
+  Generator finalize(const std::vector<nntrainer::TensorDim> &input_dims,
+                     const std::vector<nntrainer::TensorDim> &label_dims,
+                     void *user_data = nullptr) override {
+    return [](unsigned int idx, std::vector<nntrainer::Tensor> &inputs,
+              std::vector<nntrainer::Tensor> &labels) {
+      for (unsigned int i = 0; i < inputs[0].size(); ++i) {
+        inputs[0].getData()[i] = std::sin(idx * 0.7f + i * 0.3f);
+      }
+      for (unsigned int i = 0; i < labels[0].size(); ++i) {
+        labels[0].getData()[i] = std::cos(idx * 0.5f + i * 0.2f);
+      }
+      return false;
+    };
+  }
+
+  /**
+   * @copydoc DataProducer::size()
+   */
+  unsigned int
+  size(const std::vector<nntrainer::TensorDim> &input_dims,
+       const std::vector<nntrainer::TensorDim> &label_dims) const override {
+    return num_samples;
+  }
+
+private:
+  unsigned int num_samples;
+};
+
+/**
+ * @brief layer which passes its input through and counts its forwardings
+ */
+class ForwardCounterLayer final : public nntrainer::Layer {
+public:
+  /**
+   * @brief Construct a new Forward Counter Layer object
+   *
+   * @param num_forwarded counter incremented on each forwarding
+   */
+  ForwardCounterLayer(unsigned int &num_forwarded) :
+    num_forwarded(num_forwarded) {}
+
+  /**
+   * @copydoc Layer::getType()
+   */
+  const std::string getType() const override { return "forward_counter"; }
+
+  /**
+   * @copydoc Layer::finalize(InitLayerContext &context)
+   */
+  void finalize(nntrainer::InitLayerContext &context) override {
+    context.setOutputDimensions(context.getInputDimensions());
+  }
+
+  /**
+   * @copydoc Layer::forwarding(RunLayerContext &context, bool training)
+   */
+  void forwarding(nntrainer::RunLayerContext &context,
+                  bool training) override {
+    context.getOutput(0).copy(context.getInput(0));
+    num_forwarded++;
+  }
+
+  /**
+   * @copydoc Layer::calcDerivative(RunLayerContext &context)
+   */
+  void calcDerivative(nntrainer::RunLayerContext &context) override {
+    context.getOutgoingDerivative(0).copy(context.getIncomingDerivative(0));
+  }
+
+  /**
+   * @copydoc Layer::setProperty(const std::vector<std::string> &values)
+   */
+  void setProperty(const std::vector<std::string> &values) override {}
+
+  /**
+   * @copydoc Layer::supportBackwarding()
+   */
+  bool supportBackwarding() const override { return true; }
+
+private:
+  unsigned int &num_forwarded;
+};
+
+/**
+ * @brief make a model of a frozen backbone and a trainable head
+ *
+ * @param props model properties
+ * @param[out] num_forwarded number of forwardings of the backbone
+ * @return std::unique_ptr<nntrainer::NeuralNetwork> trained model
+ */
+static std::unique_ptr<nntrainer::NeuralNetwork>
+trainFrozenBackboneModel(const std::vector<std::string> &props,
+                         unsigned int &num_forwarded) {
+  auto nn = std::make_unique<nntrainer::NeuralNetwork>();
+  auto graph = makeGraph({
+    {"input", {"name=in", "input_shape=1:1:4"}},
+    {"fully_connected",
+     {"name=backbone", "unit=6", "activation=sigmoid",
+      "weight_initializer=ones", "trainable=false"}},
+    {"fully_connected",
+     {"name=head", "unit=2", "weight_initializer=ones",
+      "input_layers=counter"}},
+    {"mse", {"name=loss"}},
+  });
+  graph.insert(graph.begin() + 2,
+               nntrainer::createLayerNode(
+                 std::make_unique<ForwardCounterLayer>(num_forwarded),
+                 {"name=counter", "input_layers=backbone"}));
+  for (auto &node : graph) {
+    nn->addLayer(node);
+  }
+
+  nn->setProperty({"batch_size=4", "epochs=3"});
+  nn->setProperty(props);
+  nn->setOptimizer(ml::train::optimizer::SGD({"learning_rate=0.1"}));
+  nn->setDataBuffer(ml::train::DatasetModeType::MODE_TRAIN,
+                    std::make_shared<nntrainer::DataBuffer>(
+                      std::make_unique<IndexedDataProducer>(8)));
+  EXPECT_EQ(nn->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(nn->initialize(), ML_ERROR_NONE);
+  EXPECT_EQ(nn->train(), ML_ERROR_NONE);
+  return nn;
+}
+
+/**
+ * @brief training with the cached features of the frozen backbone gives the
+ * same model as computing them on every epoch, and the backbone is only
+ * forwarded on the first epoch
+ */
+TEST(nntrainerModels, feature_cache_p) {
+  unsigned int num_forwarded = 0;
+  auto reference = trainFrozenBackboneModel({}, num_forwarded);
+  /// 8 samples of a batch of 4 for 3 epochs
+  EXPECT_EQ(num_forwarded, 6u);
+  const std::string cache_path = "feature_cache_p.cache";
+
+  for (auto &props : std::vector<std::vector<std::string>>{
+         {"feature_cache=true"},
+         {"feature_cache=true", "feature_cache_path=" + cache_path}}) {
+    num_forwarded = 0;
+    auto cached = trainFrozenBackboneModel(props, num_forwarded);
+    /// the samples are cached on the first epoch and read afterwards
+    EXPECT_EQ(num_forwarded, 2u);
+
+    auto input = MAKE_SHARED_TENSOR(nntrainer::TensorDim(4, 1, 1, 4));
+    input->setRandNormal();
+
+    auto expected = reference->inference({input}, false);
+    auto out = cached->inference({input}, false);
+    ASSERT_EQ(out.size(), expected.size());
+    for (unsigned int i = 0; i < out[0]->size(); ++i) {
+      EXPECT_NEAR(out[0]->getData()[i], expected[0]->getData()[i], 1e-5);
+    }
+  }
+
+  std::remove(cache_path.c_str());
+}
+
+/**
+ * @brief train a model of the given batch size on samples of the given number
+ *
+ * @param batch_size batch size of the model
+ * @param num_samples number of samples of the train and valid dataset
+ * @param learning_rate learning rate of the model
+ * @param batch_norm true to add a batch normalization layer
+ * @return std::unique_ptr<nntrainer::NeuralNetwork> trained model
+ */
+static std::unique_ptr<nntrainer::NeuralNetwork>
+trainIndexedModel(unsigned int batch_size, unsigned int num_samples,
+                  const std::string &learning_rate = "0.1",
+                  bool batch_norm = true) {
+  auto nn = std::make_unique<nntrainer::NeuralNetwork>();
+  auto graph = makeGraph({
+    {"input", {"name=in", "input_shape=1:1:4"}},
+    {"fully_connected",
+     {"name=fc0", "unit=6", "activation=sigmoid", "weight_initializer=ones"}},
+    {"fully_connected", {"name=fc1", "unit=2", "weight_initializer=ones"}},
+    {"mse", {"name=loss"}},
+  });
+  if (batch_norm) {
+    graph.insert(graph.begin() + 2,
+                 nntrainer::createLayerNode("batch_normalization", {"name=bn"}));
+  }
+  for (auto &node : graph) {
+    nn->addLayer(node);
+  }
+
+  nn->setProperty(
+    {"batch_size=" + std::to_string(batch_size), "epochs=3"});
+  nn->setOptimizer(
+    ml::train::optimizer::SGD({"learning_rate=" + learning_rate}));
+  for (auto mode : {ml::train::DatasetModeType::MODE_TRAIN,
+                    ml::train::DatasetModeType::MODE_VALID}) {
+    nn->setDataBuffer(mode, std::make_shared<nntrainer::DataBuffer>(
+                              std::make_unique<IndexedDataProducer>(
+                                num_samples)));
+  }
+  EXPECT_EQ(nn->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(nn->initialize(), ML_ERROR_NONE);
+  EXPECT_EQ(nn->train(), ML_ERROR_NONE);
+  return nn;
+}
+
+/**
+ * @brief the partial batch at the end of an epoch is trained on as a batch of
+ * its own size, instead of being dropped
+ */
+TEST(nntrainerModels, partial_batch_p) {
+  auto reference = trainIndexedModel(3, 3);
+  auto partial = trainIndexedModel(5, 3);
+
+  EXPECT_NEAR(partial->getTrainingLoss(), reference->getTrainingLoss(), 1e-5);
+  EXPECT_NEAR(partial->getValidationLoss(), reference->getValidationLoss(),
+              1e-5);
+
+  auto input = MAKE_SHARED_TENSOR(nntrainer::TensorDim(3, 1, 1, 4));
+  input->setRandNormal();
+
+  auto expected = reference->inference({input}, false);
+  auto out = partial->inference({input}, false);
+  ASSERT_EQ(out.size(), expected.size());
+  for (unsigned int i = 0; i < out[0]->size(); ++i) {
+    EXPECT_NEAR(out[0]->getData()[i], expected[0]->getData()[i], 1e-5);
+  }
+}
+
+/**
+ * @brief the loss of an epoch is the mean over the samples, so the partial
+ * batch is weighted by its size
+ */
+TEST(nntrainerModels, partial_batch_remainder_p) {
+  /** the model is not updated, so every batching sees the same model */
+  auto reference = trainIndexedModel(6, 6, "0", false);
+  auto partial = trainIndexedModel(4, 6, "0", false);
+
+  EXPECT_NEAR(partial->getTrainingLoss(), reference->getTrainingLoss(), 1e-5);
+  EXPECT_NEAR(partial->getValidationLoss(), reference->getValidationLoss(),
+              1e-5);
+}
+
+/**
+ * @brief make a model trained on a single batch of indexed samples per epoch
+ *
+ * @param learning_rate learning rate of the model
+ * @return std::unique_ptr<nntrainer::NeuralNetwork> initialized model
+ */
+static std::unique_ptr<nntrainer::NeuralNetwork>
+makeSingleBatchModel(const std::string &learning_rate) {
+  auto nn = std::make_unique<nntrainer::NeuralNetwork>();
+  auto graph = makeGraph({
+    {"input", {"name=in", "input_shape=1:1:4"}},
+    {"fully_connected",
+     {"name=fc0", "unit=6", "activation=sigmoid", "weight_initializer=ones"}},
+    {"fully_connected", {"name=fc1", "unit=2", "weight_initializer=ones"}},
+    {"mse", {"name=loss"}},
+  });
+  for (auto &node : graph) {
+    nn->addLayer(node);
+  }
+
+  nn->setProperty({"batch_size=4", "epochs=3"});
+  nn->setOptimizer(
+    ml::train::optimizer::SGD({"learning_rate=" + learning_rate}));
+  nn->setDataBuffer(ml::train::DatasetModeType::MODE_TRAIN,
+                    std::make_shared<nntrainer::DataBuffer>(
+                      std::make_unique<IndexedDataProducer>(4)));
+  EXPECT_EQ(nn->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(nn->initialize(), ML_ERROR_NONE);
+  return nn;
+}
+
+/**
+ * @brief the learning rate scale of the model scales the weight updates, and
+ * the scale reduced on a plateau applies to the following epochs
+ */
+TEST(nntrainerModels, learning_rate_scale_update_p) {
+  auto input = MAKE_SHARED_TENSOR(nntrainer::TensorDim(4, 1, 1, 4));
+  input->setRandNormal();
+  auto max_diff = [&input](nntrainer::NeuralNetwork &lhs,
+                           nntrainer::NeuralNetwork &rhs) {
+    auto l = lhs.inference({input}, false);
+    auto r = rhs.inference({input}, false);
+    float diff = 0.0f;
+    for (unsigned int i = 0; i < l[0]->size(); ++i) {
+      diff = std::max(diff, std::abs(l[0]->getData()[i] - r[0]->getData()[i]));
+    }
+    return diff;
+  };
+
+  auto halved = makeSingleBatchModel("0.05");
+  EXPECT_EQ(halved->train(), ML_ERROR_NONE);
+  auto scaled = makeSingleBatchModel("0.1");
+  scaled->setLearningRateScale(0.5f);
+  EXPECT_EQ(scaled->train(), ML_ERROR_NONE);
+  EXPECT_LT(max_diff(*scaled, *halved), 1e-6f);
+
+  /// the loss never improves by 100, so the scale is halved from epoch 3
+  auto reduced = makeSingleBatchModel("0.1");
+  reduced->addTrainingCallback(std::make_shared<nntrainer::ReduceLROnPlateau>(
+    std::vector<std::string>{"monitor=loss", "patience=1", "min_delta=100",
+                             "factor=0.5"}));
+  EXPECT_EQ(reduced->train(), ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ(reduced->getLearningRateScale(), 0.25f);
+
+  auto reference = makeSingleBatchModel("0.1");
+  reference->setProperty({"epochs=2"});
+  EXPECT_EQ(reference->train(), ML_ERROR_NONE);
+  reference->setProperty({"epochs=1", "continue_train=true"});
+  reference->setLearningRateScale(0.5f);
+  EXPECT_EQ(reference->train(), ML_ERROR_NONE);
+  EXPECT_LT(max_diff(*reduced, *reference), 1e-6f);
+
+  auto unscaled = makeSingleBatchModel("0.1");
+  EXPECT_EQ(unscaled->train(), ML_ERROR_NONE);
+  EXPECT_GT(max_diff(*reduced, *unscaled), 1e-4f);
+}
+
 /**
  * @brief Main gtest
  */
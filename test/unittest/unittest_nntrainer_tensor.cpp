@@ -1295,6 +1295,37 @@ TEST(nntrainer_Tensor, add_i_broadcast_not_broadcastable_02_n) {
   EXPECT_EQ(target.add_i(target2), ML_ERROR_INVALID_PARAMETER);
 }
 
+TEST(nntrainer_Tensor, add_i_broadcast_large_p) {
+  /// big enough to be split over the threads
+  nntrainer::Tensor t = ranged(4, 16, 32, 32);
+  nntrainer::Tensor bias = ranged(1, 16, 1, 1);
+  nntrainer::Tensor row = ranged(4, 1, 1, 32);
+
+  nntrainer::Tensor result = t.add(bias);
+  result.add_i(row, 2.0f);
+
+  bool equal = true;
+  for (unsigned int b = 0; b < t.batch(); ++b)
+    for (unsigned int c = 0; c < t.channel(); ++c)
+      for (unsigned int h = 0; h < t.height(); ++h)
+        for (unsigned int w = 0; w < t.width(); ++w) {
+          float expected = t.getValue(b, c, h, w) + bias.getValue(0, c, 0, 0) +
+                           2.0f * row.getValue(b, 0, 0, w);
+          if (result.getValue(b, c, h, w) != expected)
+            equal = false;
+        }
+
+  EXPECT_TRUE(equal);
+}
+
+TEST(nntrainer_Tensor, add_zero_alpha_p) {
+  nntrainer::Tensor t = ranged(3, 2, 4, 5);
+  nntrainer::Tensor m = ranged(1, 2, 1, 1);
+
+  nntrainer::Tensor result = t.add(m, 0.0f);
+  EXPECT_EQ(result, t);
+}
+
 TEST(nntrainer_Tensor, add_01_p) {
   int status = ML_ERROR_NONE;
   int batch = 3;
@@ -1858,6 +1889,213 @@ TEST(nntrainer_Tensor, multiple_sum_p) {
   EXPECT_EQ(actual, expected);
 }
 
+TEST(nntrainer_Tensor, multiple_sum_non_adjacent_p) {
+  nntrainer::Tensor t = ranged(3, 4, 5, 6);
+  const std::vector<std::vector<unsigned int>> axes_list = {
+    {0, 2}, {1, 3}, {0, 3}, {0, 1, 3}, {2, 0}};
+
+  for (auto &axes : axes_list) {
+    nntrainer::Tensor actual = t.sum(axes);
+
+    nntrainer::Tensor expected = t;
+    for (auto axis : axes)
+      expected = expected.sum(axis);
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST(nntrainer_Tensor, sum_beta_p) {
+  nntrainer::Tensor t = ranged(3, 2, 4, 5);
+
+  for (unsigned int axis = 0; axis < 4; ++axis) {
+    nntrainer::Tensor out = t.sum(axis);
+    nntrainer::Tensor expected = out.multiply(1.5);
+    t.sum(axis, out, 0.5, 1.0);
+    EXPECT_EQ(out, expected);
+  }
+}
+
+TEST(nntrainer_Tensor, sum_large_accuracy_p) {
+  /// naive float accumulation of 0.1 drifts visibly over a million elements
+  const unsigned int len = 1 << 20;
+  nntrainer::Tensor t = constant(0.1f, 1, 1, 1, len);
+  EXPECT_NEAR(t.sum(3).getValue(0, 0, 0, 0), len * 0.1, 1e-1);
+  EXPECT_NEAR(t.average().getValue(0, 0, 0, 0), 0.1, 1e-6);
+
+  t.reshape({1, 1, len, 1});
+  EXPECT_NEAR(t.sum(2).getValue(0, 0, 0, 0), len * 0.1, 1e-1);
+}
+
+TEST(nntrainer_Tensor, argmax_p) {
+  nntrainer::Tensor t = constant(0.0f, 4, 3, 17, 19);
+  unsigned int feature_len = t.getDim().getFeatureLen();
+  std::vector<unsigned int> expected = {0, 5, feature_len - 1, 900};
+
+  for (unsigned int b = 0; b < expected.size(); ++b) {
+    t.getData()[b * feature_len + expected[b]] = 1.0f;
+    /// the first maximum is reported
+    t.getData()[b * feature_len + feature_len - 1] = 1.0f;
+  }
+
+  EXPECT_EQ(t.argmax(), expected);
+}
+
+TEST(nntrainer_Tensor, argmax_nan_p) {
+  nntrainer::Tensor t = constant(0.0f, 3, 1, 1, 37);
+  float *data = t.getData();
+
+  /// NaN is taken as the maximum, the first one is reported
+  data[0 * 37 + 3] = 1.0f;
+  data[0 * 37 + 20] = std::nanf("");
+  data[0 * 37 + 30] = std::nanf("");
+  data[1 * 37 + 0] = std::nanf("");
+  data[2 * 37 + 36] = std::nanf("");
+
+  std::vector<unsigned int> expected = {20, 0, 36};
+  EXPECT_EQ(t.argmax(), expected);
+}
+
+TEST(nntrainer_Tensor, set_rand_normal_p) {
+  nntrainer::Tensor t(1, 1, 256, 257);
+  t.setRandNormal(1.0f, 2.0f);
+
+  const float *data = t.getData();
+  double sum = 0, sq_sum = 0;
+  for (unsigned int i = 0; i < t.size(); ++i) {
+    sum += data[i];
+    sq_sum += data[i] * data[i];
+  }
+  double mean = sum / t.size();
+  double stddev = std::sqrt(sq_sum / t.size() - mean * mean);
+  EXPECT_NEAR(mean, 1.0, 0.05);
+  EXPECT_NEAR(stddev, 2.0, 0.05);
+}
+
+TEST(nntrainer_Tensor, set_rand_bernoulli_p) {
+  nntrainer::Tensor t(1, 1, 256, 257);
+  t.setRandBernoulli(0.3f);
+
+  const float *data = t.getData();
+  unsigned int ones = 0;
+  for (unsigned int i = 0; i < t.size(); ++i) {
+    ASSERT_TRUE(data[i] == 0.0f || data[i] == 1.0f);
+    ones += data[i] == 1.0f;
+  }
+  EXPECT_NEAR((float)ones / t.size(), 0.3f, 0.01f);
+}
+
+TEST(nntrainer_Tensor, set_rand_consecutive_calls_differ_p) {
+  nntrainer::Tensor a(1, 1, 16, 16), b(1, 1, 16, 16);
+  a.setRandUniform(0.0f, 1.0f);
+  b.setRandUniform(0.0f, 1.0f);
+  EXPECT_NE(a, b);
+}
+
+TEST(nntrainer_Tensor, dropout_mask_p) {
+  nntrainer::Tensor t(1, 1, 256, 257);
+  t.dropout_mask(0.25f);
+
+  const float scale = 1.0f / (1.0f - 0.25f);
+  const float *data = t.getData();
+  unsigned int dropped = 0;
+  for (unsigned int i = 0; i < t.size(); ++i) {
+    ASSERT_TRUE(data[i] == 0.0f || data[i] == scale);
+    dropped += data[i] == 0.0f;
+  }
+  EXPECT_NEAR((float)dropped / t.size(), 0.25f, 0.01f);
+}
+
+TEST(nntrainer_Tensor, zoneout_mask_p) {
+  nntrainer::Tensor t(1, 1, 256, 257);
+  nntrainer::Tensor opposite = t.zoneout_mask(0.4f);
+
+  EXPECT_EQ(t.add(opposite), constant(1.0f, 1, 1, 256, 257));
+}
+
+TEST(nntrainer_Tensor, get_slice_p) {
+  nntrainer::Tensor t = ranged(2, 3, 4, 5);
+
+  for (unsigned int axis = 0; axis < 4; ++axis) {
+    nntrainer::TensorDim dim = t.getDim();
+    unsigned int len = dim.getTensorDim(axis) - 1;
+    nntrainer::Tensor slice = t.getSlice(axis, 1, len);
+
+    dim.setTensorDim(axis, len);
+    ASSERT_EQ(slice.getDim(), dim);
+    for (unsigned int b = 0; b < dim.batch(); ++b)
+      for (unsigned int c = 0; c < dim.channel(); ++c)
+        for (unsigned int h = 0; h < dim.height(); ++h)
+          for (unsigned int w = 0; w < dim.width(); ++w) {
+            unsigned int idx[] = {b, c, h, w};
+            idx[axis] += 1;
+            EXPECT_EQ(slice.getValue(b, c, h, w),
+                      t.getValue(idx[0], idx[1], idx[2], idx[3]));
+          }
+  }
+
+  /// slicing shares the memory
+  nntrainer::Tensor slice = t.getSlice(3, 2, 2);
+  slice.setValue(0, 0, 0, 0, -1.0f);
+  EXPECT_EQ(t.getValue(0, 0, 0, 2), -1.0f);
+}
+
+TEST(nntrainer_Tensor, get_slice_n) {
+  nntrainer::Tensor t = ranged(2, 3, 4, 5);
+  EXPECT_THROW(t.getSlice(4, 0, 1), std::invalid_argument);
+  EXPECT_THROW(t.getSlice(3, 3, 3), std::invalid_argument);
+  EXPECT_THROW(t.getSlice(2, 0, 0), std::invalid_argument);
+}
+
+TEST(nntrainer_Tensor, strided_ops_p) {
+  nntrainer::Tensor t = ranged(3, 1, 1, 12);
+  nntrainer::Tensor a = t.getSlice(3, 0, 4);
+  nntrainer::Tensor b = t.getSlice(3, 8, 4);
+  nntrainer::Tensor a_packed, b_packed;
+  a_packed.copy_with_stride(a);
+  b_packed.copy_with_stride(b);
+
+  EXPECT_EQ(a.multiply_strided(b), a_packed.multiply(b_packed));
+  EXPECT_EQ(a.add_strided(b, 2.0f), a_packed.add(b_packed, 2.0f));
+
+  nntrainer::Tensor t_copy = t.clone();
+  nntrainer::Tensor out = t_copy.getSlice(3, 4, 4);
+  nntrainer::Tensor expected, actual;
+  expected.copy_with_stride(out);
+  expected.add_i(a_packed.multiply(b_packed));
+  a.multiply_strided(b, out, 1.0f);
+  actual.copy_with_stride(out);
+  EXPECT_EQ(actual, expected);
+
+  EXPECT_EQ(a.sum(0), a_packed.sum(0));
+  EXPECT_EQ(a.sum({0, 3}), a_packed.sum({0, 3}));
+}
+
+TEST(nntrainer_Tensor, dot_strided_p) {
+  nntrainer::Tensor t = ranged(1, 1, 6, 10);
+  nntrainer::Tensor w = ranged(1, 1, 8, 12);
+  nntrainer::Tensor lhs = t.getSlice(3, 2, 8);
+  nntrainer::Tensor rhs = w.getSlice(3, 4, 5);
+  nntrainer::Tensor lhs_packed, rhs_packed;
+  lhs_packed.copy_with_stride(lhs);
+  rhs_packed.copy_with_stride(rhs);
+
+  EXPECT_EQ(lhs.dot(rhs), lhs_packed.dot(rhs_packed));
+  EXPECT_EQ(lhs.dot(lhs, true, false), lhs_packed.dot(lhs_packed, true, false));
+
+  /// accumulate into a strided output
+  nntrainer::Tensor out_mem = ranged(1, 1, 6, 9);
+  nntrainer::Tensor out = out_mem.getSlice(3, 1, 5);
+  nntrainer::Tensor expected;
+  expected.copy_with_stride(out);
+  lhs_packed.dot(rhs_packed, expected, false, false, 1.0f);
+  lhs.dot(rhs, out, false, false, 1.0f);
+  nntrainer::Tensor actual;
+  actual.copy_with_stride(out);
+  EXPECT_EQ(actual, expected);
+  EXPECT_EQ(out_mem.getValue(0, 0, 0, 0), 0.0f);
+  EXPECT_EQ(out_mem.getValue(0, 0, 0, 6), 6.0f);
+}
+
 TEST(nntrainer_Tensor, average_p) {
   nntrainer::Tensor t = constant(1.0, 2, 3, 5, 7);
 
@@ -2666,6 +2904,63 @@ TEST(nntrainer_Tensor, transpose_p) {
   }
 }
 
+TEST(nntrainer_Tensor, transpose_large_p) {
+  /// sizes are chosen so that both full and partial tiles are visited
+  nntrainer::Tensor t = ranged(2, 19, 37, 45);
+  const std::string directions[] = {"0:1:2", "0:2:1", "1:0:2",
+                                    "1:2:0", "2:0:1", "2:1:0"};
+  unsigned int in_dims[] = {19, 37, 45};
+
+  for (auto &direction : directions) {
+    unsigned int axes[] = {(unsigned int)(direction[0] - '0'),
+                           (unsigned int)(direction[2] - '0'),
+                           (unsigned int)(direction[4] - '0')};
+    nntrainer::Tensor m = t.transpose(direction);
+    ASSERT_EQ(m.getDim(), nntrainer::TensorDim(2, in_dims[axes[0]],
+                                               in_dims[axes[1]],
+                                               in_dims[axes[2]]));
+
+    bool equal = true;
+    for (unsigned int b = 0; b < 2; ++b)
+      for (unsigned int c = 0; c < 19; ++c)
+        for (unsigned int h = 0; h < 37; ++h)
+          for (unsigned int w = 0; w < 45; ++w) {
+            unsigned int idx[] = {c, h, w};
+            equal &= t.getValue(b, c, h, w) ==
+                     m.getValue(b, idx[axes[0]], idx[axes[1]], idx[axes[2]]);
+          }
+    EXPECT_TRUE(equal) << direction;
+  }
+}
+
+TEST(nntrainer_Tensor, transpose_inplace_square_p) {
+  const std::pair<std::string, nntrainer::TensorDim> cases[] = {
+    {"0:2:1", {2, 3, 33, 33}},
+    {"1:0:2", {2, 33, 33, 3}},
+    {"2:1:0", {2, 33, 3, 33}},
+    {"0:1:2", {2, 3, 4, 5}}};
+
+  for (auto &[direction, dim] : cases) {
+    nntrainer::Tensor t = ranged(dim.batch(), dim.channel(), dim.height(),
+                                 dim.width());
+    nntrainer::Tensor answer = t.transpose(direction);
+    float *data = t.getData();
+
+    t.transpose(direction, t);
+    EXPECT_EQ(t.getData(), data);
+    EXPECT_EQ(t, answer) << direction;
+  }
+}
+
+TEST(nntrainer_Tensor, transpose_inplace_non_square_p) {
+  nntrainer::Tensor t = ranged(2, 3, 4, 5);
+  nntrainer::Tensor answer = t.transpose("2:0:1");
+
+  nntrainer::Tensor out = t.getSharedDataTensor(t.getDim(), 0);
+  t.transpose("2:0:1", out);
+  EXPECT_EQ(out, answer);
+}
+
 TEST(nntrainer_Tensor, tranpose_dimension_not_match_n) {
   nntrainer::Tensor a(3, 2, 4, 5);
   nntrainer::Tensor b(3, 1, 2, 3);
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <basic_planner.h>
+#include <optimized_v1_planner.h>
 #include <tensor_pool.h>
 
 constexpr unsigned int MEM_BYTES = 128;
@@ -669,6 +670,78 @@ TEST(TensorPool, createOrExtend_unmanaged_n) {
     pool.requestOrExtend("t", {10}, {0}, nntrainer::TensorLifespan::UNMANAGED));
 }
 
+TEST(TensorPool, merge_into_p) {
+  constexpr auto fwd_ls = nntrainer::TensorLifespan::FORWARD_FUNC_LIFESPAN;
+  nntrainer::TensorPool pool;
+  // |-------- t1 -------|
+  // |-t2-|
+  //      |---- t3 -----|
+  // t4 is alive while t2, t3 is, so it must not overlap with t1
+  auto t1 = pool.request("t1", {10}, {2}, fwd_ls);
+  auto t2 = pool.request("t2", {4}, {0}, fwd_ls);
+  auto t3 = pool.request("t3", {6}, {1}, fwd_ls);
+  auto t4 = pool.request("t4", {10}, {0, 1}, fwd_ls);
+  auto t5 = pool.view("t5", "t3", {2}, {1}, fwd_ls, 1);
+  EXPECT_TRUE(pool.mergeInto("t2", "t1", 0));
+  EXPECT_TRUE(pool.mergeInto("t3", "t1", 4));
+  pool.finalize(nntrainer::OptimizedV1Planner(), 0, 2);
+  pool.allocate();
+
+  EXPECT_EQ(t1->getData(), t2->getData());
+  EXPECT_EQ(t1->getData() + 4, t3->getData());
+  EXPECT_EQ(t3->getData() + 1, t5->getData());
+  testNoOverlap(t1, t4);
+  pool.deallocate();
+
+  /// placements are decided again after clear
+  pool.clearMerged();
+  pool.finalize(nntrainer::BasicPlanner(), 0, 2);
+  pool.allocate();
+  testNoOverlap(t1, t2);
+  testNoOverlap(t1, t3);
+  pool.deallocate();
+}
+
+TEST(TensorPool, merge_into_chain_p) {
+  nntrainer::TensorPool pool;
+  // t1 placed in t2, which is placed in t3
+  auto t1 = pool.request("t1", {2}, {0}, max_ls);
+  auto t2 = pool.request("t2", {4}, {1}, max_ls);
+  auto t3 = pool.request("t3", {8}, {2}, max_ls);
+  EXPECT_TRUE(pool.mergeInto("t1", "t2", 2));
+  EXPECT_TRUE(pool.mergeInto("t2", "t3", 4));
+  pool.finalize(nntrainer::BasicPlanner(), 0, 2);
+  pool.allocate();
+
+  EXPECT_EQ(t3->getData() + 4, t2->getData());
+  EXPECT_EQ(t3->getData() + 6, t1->getData());
+  pool.deallocate();
+}
+
+TEST(TensorPool, merge_into_n) {
+  nntrainer::TensorPool pool;
+  pool.request("t1", {10}, {0}, max_ls);
+  pool.request("t2", {4}, {0}, max_ls);
+  pool.request("t3", {4}, {0}, max_ls);
+  pool.view("t4", "t3", {2}, {0}, max_ls, 2);
+  pool.placeholder("t5", {4});
+
+  /// does not fit
+  EXPECT_FALSE(pool.mergeInto("t2", "t1", 7));
+  /// view which does not cover its source
+  EXPECT_FALSE(pool.mergeInto("t4", "t1", 0));
+  /// unmanaged
+  EXPECT_FALSE(pool.mergeInto("t5", "t1", 0));
+  EXPECT_FALSE(pool.mergeInto("t2", "t5", 0));
+  /// already placed
+  EXPECT_TRUE(pool.mergeInto("t2", "t1", 0));
+  EXPECT_FALSE(pool.mergeInto("t2", "t1", 4));
+  /// cycle
+  pool.request("t6", {4}, {0}, max_ls);
+  EXPECT_TRUE(pool.mergeInto("t6", "t3", 0));
+  EXPECT_FALSE(pool.mergeInto("t3", "t6", 0));
+}
+
 /**
  * @brief Main gtest
  */